@@ -883,6 +883,8 @@ public:
 		return PieMenuGUI::Slice("", PieMenuGUI::PieSliceIndex::PSI_NONE, 0, false);
 	};
 
+	PieMenuGUI * GetPieMenu(int player) const { return (player >= Players::PlayerOne && player < Players::MaxPlayerCount) ? m_pPieMenu[player] : 0; }
+
 	std::vector<PieMenuGUI::Slice *> GetCurrentPieMenuSlices(int player) const 
 	{ 
 		//if (player >= Players::PlayerOne && player < Players::MaxPlayerCount)
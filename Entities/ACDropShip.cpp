@@ -136,56 +136,44 @@ int ACDropShip::Create(const ACDropShip &reference)
 
 int ACDropShip::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "RThruster")
-    {
-        delete m_pRThruster;
-        m_pRThruster = new AEmitter;
-        reader >> m_pRThruster;
-    }
-    else if (propName == "LThruster")
-    {
-        delete m_pLThruster;
-        m_pLThruster = new AEmitter;
-        reader >> m_pLThruster;
-    }
-    else if (propName == "URThruster")
-    {
-        delete m_pURThruster;
-        m_pURThruster = new AEmitter;
-        reader >> m_pURThruster;
-    }
-    else if (propName == "ULThruster")
-    {
-        delete m_pULThruster;
-        m_pULThruster = new AEmitter;
-        reader >> m_pULThruster;
-    }
-    else if (propName == "RHatchDoor")
-    {
-        delete m_pRHatch;
-        m_pRHatch = new Attachable;
-        reader >> m_pRHatch;
-    }
-    else if (propName == "LHatchDoor")
-    {
-        delete m_pLHatch;
-        m_pLHatch = new Attachable;
-        reader >> m_pLHatch;
-    }
-    else if (propName == "HatchDoorSwingRange")
-        reader >> m_HatchSwingRange;
-    else if (propName == "AutoStabilize")
-        reader >> m_AutoStabilize;
-    else if (propName == "ScuttleIfFlippedTime")
-        reader >> m_ScuttleIfFlippedTime;
-	else if (propName == "MaxEngineAngle")
-		reader >> m_MaxEngineAngle;
-	else if (propName == "LateralControlSpeed")
-		reader >> m_LateralControlSpeed;
-	else
-        return ACraft::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<ACDropShip> propertyReaders = {
+        { { "RThruster" }, [](ACDropShip &dropShip, Reader &reader) {
+            delete dropShip.m_pRThruster;
+            dropShip.m_pRThruster = new AEmitter;
+            reader >> dropShip.m_pRThruster;
+        } },
+        { { "LThruster" }, [](ACDropShip &dropShip, Reader &reader) {
+            delete dropShip.m_pLThruster;
+            dropShip.m_pLThruster = new AEmitter;
+            reader >> dropShip.m_pLThruster;
+        } },
+        { { "URThruster" }, [](ACDropShip &dropShip, Reader &reader) {
+            delete dropShip.m_pURThruster;
+            dropShip.m_pURThruster = new AEmitter;
+            reader >> dropShip.m_pURThruster;
+        } },
+        { { "ULThruster" }, [](ACDropShip &dropShip, Reader &reader) {
+            delete dropShip.m_pULThruster;
+            dropShip.m_pULThruster = new AEmitter;
+            reader >> dropShip.m_pULThruster;
+        } },
+        { { "RHatchDoor" }, [](ACDropShip &dropShip, Reader &reader) {
+            delete dropShip.m_pRHatch;
+            dropShip.m_pRHatch = new Attachable;
+            reader >> dropShip.m_pRHatch;
+        } },
+        { { "LHatchDoor" }, [](ACDropShip &dropShip, Reader &reader) {
+            delete dropShip.m_pLHatch;
+            dropShip.m_pLHatch = new Attachable;
+            reader >> dropShip.m_pLHatch;
+        } },
+        { { "HatchDoorSwingRange" }, [](ACDropShip &dropShip, Reader &reader) { reader >> dropShip.m_HatchSwingRange; } },
+        { { "AutoStabilize" }, [](ACDropShip &dropShip, Reader &reader) { reader >> dropShip.m_AutoStabilize; } },
+        { { "ScuttleIfFlippedTime" }, [](ACDropShip &dropShip, Reader &reader) { reader >> dropShip.m_ScuttleIfFlippedTime; } },
+        { { "MaxEngineAngle" }, [](ACDropShip &dropShip, Reader &reader) { reader >> dropShip.m_MaxEngineAngle; } },
+        { { "LateralControlSpeed" }, [](ACDropShip &dropShip, Reader &reader) { reader >> dropShip.m_LateralControlSpeed; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : ACraft::ReadProperty(propName, reader);
 }
 
 
@@ -168,77 +168,62 @@ int ACRocket::Create(const ACRocket &reference)
 
 int ACRocket::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "RLeg")
-    {
-        delete m_pRLeg;
-        m_pRLeg = new Leg;
-        reader >> m_pRLeg;
-    }
-    else if (propName == "LLeg")
-    {
-        delete m_pLLeg;
-        m_pLLeg = new Leg;
-        reader >> m_pLLeg;
-        m_pLLeg->SetHFlipped(true);
-    }
-    else if (propName == "RFootGroup")
-    {
-        delete m_pRFootGroup;
-        m_pRFootGroup = new AtomGroup();
-        reader >> m_pRFootGroup;
-        m_pRFootGroup->SetOwner(this);
-    }
-    else if (propName == "LFootGroup")
-    {
-        delete m_pLFootGroup;
-        m_pLFootGroup = new AtomGroup();
-        reader >> m_pLFootGroup;
-        m_pLFootGroup->SetOwner(this);
-    }
-    else if (propName == "MThruster")
-    {   
-        delete m_pMThruster;
-        m_pMThruster = new AEmitter;
-        reader >> m_pMThruster;
-    }
-    else if (propName == "RThruster")
-    {
-        delete m_pRThruster;
-        m_pRThruster = new AEmitter;
-        reader >> m_pRThruster;
-    }
-    else if (propName == "LThruster")
-    {
-        delete m_pLThruster;
-        m_pLThruster = new AEmitter;
-        reader >> m_pLThruster;
-    }
-    else if (propName == "URThruster")
-    {
-        delete m_pURThruster;
-        m_pURThruster = new AEmitter;
-        reader >> m_pURThruster;
-    }
-    else if (propName == "ULThruster")
-    {
-        delete m_pULThruster;
-        m_pULThruster = new AEmitter;
-        reader >> m_pULThruster;
-    }
-    else if (propName == "RaisedGearLimbPath")
-        reader >> m_Paths[RIGHT][RAISED];
-    else if (propName == "LoweredGearLimbPath")
-        reader >> m_Paths[RIGHT][LOWERED];
-    else if (propName == "LoweringGearLimbPath")
-        reader >> m_Paths[RIGHT][LOWERING];
-    else if (propName == "RaisingGearLimbPath")
-        reader >> m_Paths[RIGHT][RAISING];
-    else if (propName == "ScuttleIfFlippedTime")
-        reader >> m_ScuttleIfFlippedTime;
-    else
-        return ACraft::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<ACRocket> propertyReaders = {
+        { { "RLeg" }, [](ACRocket &rocket, Reader &reader) {
+            delete rocket.m_pRLeg;
+            rocket.m_pRLeg = new Leg;
+            reader >> rocket.m_pRLeg;
+        } },
+        { { "LLeg" }, [](ACRocket &rocket, Reader &reader) {
+            delete rocket.m_pLLeg;
+            rocket.m_pLLeg = new Leg;
+            reader >> rocket.m_pLLeg;
+            rocket.m_pLLeg->SetHFlipped(true);
+        } },
+        { { "RFootGroup" }, [](ACRocket &rocket, Reader &reader) {
+            delete rocket.m_pRFootGroup;
+            rocket.m_pRFootGroup = new AtomGroup();
+            reader >> rocket.m_pRFootGroup;
+            rocket.m_pRFootGroup->SetOwner(&rocket);
+        } },
+        { { "LFootGroup" }, [](ACRocket &rocket, Reader &reader) {
+            delete rocket.m_pLFootGroup;
+            rocket.m_pLFootGroup = new AtomGroup();
+            reader >> rocket.m_pLFootGroup;
+            rocket.m_pLFootGroup->SetOwner(&rocket);
+        } },
+        { { "MThruster" }, [](ACRocket &rocket, Reader &reader) {
+            delete rocket.m_pMThruster;
+            rocket.m_pMThruster = new AEmitter;
+            reader >> rocket.m_pMThruster;
+        } },
+        { { "RThruster" }, [](ACRocket &rocket, Reader &reader) {
+            delete rocket.m_pRThruster;
+            rocket.m_pRThruster = new AEmitter;
+            reader >> rocket.m_pRThruster;
+        } },
+        { { "LThruster" }, [](ACRocket &rocket, Reader &reader) {
+            delete rocket.m_pLThruster;
+            rocket.m_pLThruster = new AEmitter;
+            reader >> rocket.m_pLThruster;
+        } },
+        { { "URThruster" }, [](ACRocket &rocket, Reader &reader) {
+            delete rocket.m_pURThruster;
+            rocket.m_pURThruster = new AEmitter;
+            reader >> rocket.m_pURThruster;
+        } },
+        { { "ULThruster" }, [](ACRocket &rocket, Reader &reader) {
+            delete rocket.m_pULThruster;
+            rocket.m_pULThruster = new AEmitter;
+            reader >> rocket.m_pULThruster;
+        } },
+        { { "RaisedGearLimbPath" }, [](ACRocket &rocket, Reader &reader) { reader >> rocket.m_Paths[RIGHT][RAISED]; } },
+        { { "LoweredGearLimbPath" }, [](ACRocket &rocket, Reader &reader) { reader >> rocket.m_Paths[RIGHT][LOWERED]; } },
+        { { "LoweringGearLimbPath" }, [](ACRocket &rocket, Reader &reader) { reader >> rocket.m_Paths[RIGHT][LOWERING]; } },
+        { { "RaisingGearLimbPath" }, [](ACRocket &rocket, Reader &reader) { reader >> rocket.m_Paths[RIGHT][RAISING]; } },
+        { { "ScuttleIfFlippedTime" }, [](ACRocket &rocket, Reader &reader) { reader >> rocket.m_ScuttleIfFlippedTime; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : ACraft::ReadProperty(propName, reader);
 }
 
 
@@ -255,94 +255,75 @@ int ACrab::Create(const ACrab &reference)
 
 int ACrab::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "Turret")
-    {
-        delete m_pTurret;
-        m_pTurret = new Turret;
-        reader >> m_pTurret;
-		if (!m_pTurret->IsDamageMultiplierRedefined())
-			m_pTurret->SetDamageMultiplier(5);
-    }
-    else if (propName == "Jetpack")
-    {
-        delete m_pJetpack;
-        m_pJetpack = new AEmitter;
-        reader >> m_pJetpack;
-    }
-    else if (propName == "JumpTime")
-    {
-        reader >> m_JetTimeTotal;
-        // Convert to ms
-        m_JetTimeTotal *= 1000;
-    }
-    else if (propName == "LFGLeg")
-    {
-        delete m_pLFGLeg;
-        m_pLFGLeg = new Leg;
-        reader >> m_pLFGLeg;
-    }
-    else if (propName == "LBGLeg")
-    {
-        delete m_pLBGLeg;
-        m_pLBGLeg = new Leg;
-        reader >> m_pLBGLeg;
-    }
-    else if (propName == "RFGLeg")
-    {
-        delete m_pRFGLeg;
-        m_pRFGLeg = new Leg;
-        reader >> m_pRFGLeg;
-    }
-    else if (propName == "RBGLeg")
-    {
-        delete m_pRBGLeg;
-        m_pRBGLeg = new Leg;
-        reader >> m_pRBGLeg;
-    }
-    else if (propName == "LFootGroup")
-    {
-        delete m_pLFGFootGroup;
-        delete m_pLBGFootGroup;
-        m_pLFGFootGroup = new AtomGroup();
-        m_pLBGFootGroup = new AtomGroup();
-        reader >> m_pLFGFootGroup;
-        m_pLBGFootGroup->Create(*m_pLFGFootGroup);
-        m_pLFGFootGroup->SetOwner(this);
-        m_pLBGFootGroup->SetOwner(this);
-    }
-    else if (propName == "RFootGroup")
-    {
-        delete m_pRFGFootGroup;
-        delete m_pRBGFootGroup;
-        m_pRFGFootGroup = new AtomGroup();
-        m_pRBGFootGroup = new AtomGroup();
-        reader >> m_pRFGFootGroup;
-        m_pRBGFootGroup->Create(*m_pRFGFootGroup);
-        m_pRFGFootGroup->SetOwner(this);
-        m_pRBGFootGroup->SetOwner(this);
-    }
-    else if (propName == "StrideSound")
-        reader >> m_StrideSound;
-    else if (propName == "LStandLimbPath")
-        reader >> m_Paths[LEFTSIDE][FGROUND][STAND];
-    else if (propName == "LWalkLimbPath")
-        reader >> m_Paths[LEFTSIDE][FGROUND][WALK];
-    else if (propName == "LDislodgeLimbPath")
-        reader >> m_Paths[LEFTSIDE][FGROUND][DISLODGE];
-    else if (propName == "RStandLimbPath")
-        reader >> m_Paths[RIGHTSIDE][FGROUND][STAND];
-    else if (propName == "RWalkLimbPath")
-        reader >> m_Paths[RIGHTSIDE][FGROUND][WALK];
-    else if (propName == "RDislodgeLimbPath")
-        reader >> m_Paths[RIGHTSIDE][FGROUND][DISLODGE];
-    else if (propName == "AimRangeUpperLimit")
-        reader >> m_AimRangeUpperLimit;
-    else if (propName == "AimRangeLowerLimit")
-        reader >> m_AimRangeLowerLimit;
-    else
-        return Actor::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<ACrab> propertyReaders = {
+        { { "Turret" }, [](ACrab &crab, Reader &reader) {
+            delete crab.m_pTurret;
+            crab.m_pTurret = new Turret;
+            reader >> crab.m_pTurret;
+            if (!crab.m_pTurret->IsDamageMultiplierRedefined())
+                crab.m_pTurret->SetDamageMultiplier(5);
+        } },
+        { { "Jetpack" }, [](ACrab &crab, Reader &reader) {
+            delete crab.m_pJetpack;
+            crab.m_pJetpack = new AEmitter;
+            reader >> crab.m_pJetpack;
+        } },
+        { { "JumpTime" }, [](ACrab &crab, Reader &reader) {
+            reader >> crab.m_JetTimeTotal;
+            // Convert to ms
+            crab.m_JetTimeTotal *= 1000;
+        } },
+        { { "LFGLeg" }, [](ACrab &crab, Reader &reader) {
+            delete crab.m_pLFGLeg;
+            crab.m_pLFGLeg = new Leg;
+            reader >> crab.m_pLFGLeg;
+        } },
+        { { "LBGLeg" }, [](ACrab &crab, Reader &reader) {
+            delete crab.m_pLBGLeg;
+            crab.m_pLBGLeg = new Leg;
+            reader >> crab.m_pLBGLeg;
+        } },
+        { { "RFGLeg" }, [](ACrab &crab, Reader &reader) {
+            delete crab.m_pRFGLeg;
+            crab.m_pRFGLeg = new Leg;
+            reader >> crab.m_pRFGLeg;
+        } },
+        { { "RBGLeg" }, [](ACrab &crab, Reader &reader) {
+            delete crab.m_pRBGLeg;
+            crab.m_pRBGLeg = new Leg;
+            reader >> crab.m_pRBGLeg;
+        } },
+        { { "LFootGroup" }, [](ACrab &crab, Reader &reader) {
+            delete crab.m_pLFGFootGroup;
+            delete crab.m_pLBGFootGroup;
+            crab.m_pLFGFootGroup = new AtomGroup();
+            crab.m_pLBGFootGroup = new AtomGroup();
+            reader >> crab.m_pLFGFootGroup;
+            crab.m_pLBGFootGroup->Create(*crab.m_pLFGFootGroup);
+            crab.m_pLFGFootGroup->SetOwner(&crab);
+            crab.m_pLBGFootGroup->SetOwner(&crab);
+        } },
+        { { "RFootGroup" }, [](ACrab &crab, Reader &reader) {
+            delete crab.m_pRFGFootGroup;
+            delete crab.m_pRBGFootGroup;
+            crab.m_pRFGFootGroup = new AtomGroup();
+            crab.m_pRBGFootGroup = new AtomGroup();
+            reader >> crab.m_pRFGFootGroup;
+            crab.m_pRBGFootGroup->Create(*crab.m_pRFGFootGroup);
+            crab.m_pRFGFootGroup->SetOwner(&crab);
+            crab.m_pRBGFootGroup->SetOwner(&crab);
+        } },
+        { { "StrideSound" }, [](ACrab &crab, Reader &reader) { reader >> crab.m_StrideSound; } },
+        { { "LStandLimbPath" }, [](ACrab &crab, Reader &reader) { reader >> crab.m_Paths[LEFTSIDE][FGROUND][STAND]; } },
+        { { "LWalkLimbPath" }, [](ACrab &crab, Reader &reader) { reader >> crab.m_Paths[LEFTSIDE][FGROUND][WALK]; } },
+        { { "LDislodgeLimbPath" }, [](ACrab &crab, Reader &reader) { reader >> crab.m_Paths[LEFTSIDE][FGROUND][DISLODGE]; } },
+        { { "RStandLimbPath" }, [](ACrab &crab, Reader &reader) { reader >> crab.m_Paths[RIGHTSIDE][FGROUND][STAND]; } },
+        { { "RWalkLimbPath" }, [](ACrab &crab, Reader &reader) { reader >> crab.m_Paths[RIGHTSIDE][FGROUND][WALK]; } },
+        { { "RDislodgeLimbPath" }, [](ACrab &crab, Reader &reader) { reader >> crab.m_Paths[RIGHTSIDE][FGROUND][DISLODGE]; } },
+        { { "AimRangeUpperLimit" }, [](ACrab &crab, Reader &reader) { reader >> crab.m_AimRangeUpperLimit; } },
+        { { "AimRangeLowerLimit" }, [](ACrab &crab, Reader &reader) { reader >> crab.m_AimRangeLowerLimit; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Actor::ReadProperty(propName, reader);
 }
 
 
@@ -344,30 +344,21 @@ int ACraft::Create(const ACraft &reference)
 
 int ACraft::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "HatchDelay")
-        reader >> m_HatchDelay;
-    else if (propName == "HatchOpenSound")
-        reader >> m_HatchOpenSound;
-    else if (propName == "CrashSound")
-        reader >> m_CrashSound;
-    else if (propName == "AddExit")
-    {
-        Exit exit;
-        reader >> exit;
-        m_Exits.push_back(exit);
-    }
-    else if (propName == "DeliveryDelayMultiplier")
-        reader >> m_DeliveryDelayMultiplier;
-	else if (propName == "ExitInterval")
-		reader >> m_ExitInterval;
-	else if (propName == "CanLand")
-        reader >> m_LandingCraft;
-    else if (propName == "MaxPassengers")
-        reader >> m_MaxPassengers;
-    else
-        return Actor::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<ACraft> propertyReaders = {
+        { { "HatchDelay" }, [](ACraft &craft, Reader &reader) { reader >> craft.m_HatchDelay; } },
+        { { "HatchOpenSound" }, [](ACraft &craft, Reader &reader) { reader >> craft.m_HatchOpenSound; } },
+        { { "CrashSound" }, [](ACraft &craft, Reader &reader) { reader >> craft.m_CrashSound; } },
+        { { "AddExit" }, [](ACraft &craft, Reader &reader) {
+            Exit exit;
+            reader >> exit;
+            craft.m_Exits.push_back(exit);
+        } },
+        { { "DeliveryDelayMultiplier" }, [](ACraft &craft, Reader &reader) { reader >> craft.m_DeliveryDelayMultiplier; } },
+        { { "ExitInterval" }, [](ACraft &craft, Reader &reader) { reader >> craft.m_ExitInterval; } },
+        { { "CanLand" }, [](ACraft &craft, Reader &reader) { reader >> craft.m_LandingCraft; } },
+        { { "MaxPassengers" }, [](ACraft &craft, Reader &reader) { reader >> craft.m_MaxPassengers; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Actor::ReadProperty(propName, reader);
 }
 
 
@@ -84,61 +84,54 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int ADoor::ReadProperty(std::string propName, Reader &reader) {
-		if (propName == "Door") {
-			delete m_Door;
-			m_Door = new Attachable;
-			reader >> m_Door;
-			m_DoorMaterialID = m_Door->GetMaterial()->GetIndex();
-		} else if (propName == "OpenOffset") {
-			reader >> m_OpenOffset;
-		} else if (propName == "ClosedOffset") {
-			reader >> m_ClosedOffset;
-		} else if (propName == "OpenClosedOffset") {
-			reader >> m_OpenOffset;
-			m_ClosedOffset = m_OpenOffset;
-		} else if (propName == "OpenAngle") {
-			Matrix rotation;
-			reader >> rotation;
-			m_OpenAngle = rotation.GetRadAngle();
-			if (m_OpenAngle < 0) { reader.ReportError("Door OpenAngle cannot be less than 0."); }
-		} else if (propName == "ClosedAngle") {
-			Matrix rotation;
-			reader >> rotation;
-			m_ClosedAngle = rotation.GetRadAngle();
-			if (m_ClosedAngle < 0) { reader.ReportError("Door ClosedAngle cannot be less than 0."); }
-		} else if (propName == "OpenClosedAngle") {
-			Matrix rotation;
-			reader >> rotation;
-			m_OpenAngle = rotation.GetRadAngle();
-			m_ClosedAngle = rotation.GetRadAngle();
-		} else if (propName == "DoorMoveTime") {
-			reader >> m_DoorMoveTime;
-		} else if (propName == "ClosedByDefault") {
-			reader >> m_ClosedByDefault;
-		} else if (propName == "ResetDefaultDelay") {
-			reader >> m_ResetToDefaultStateDelay;
-		} else if (propName == "SensorInterval") {
-			reader >> m_SensorInterval;
-		} else if (propName == "AddSensor") {
-			ADSensor sensor;
-			reader >> sensor;
-			m_Sensors.push_back(sensor);
-		} else if (propName == "DrawMaterialLayerWhenOpen") {
-			reader >> m_DrawMaterialLayerWhenOpen;
-		} else if (propName == "DrawMaterialLayerWhenClosed") {
-			reader >> m_DrawMaterialLayerWhenClosed;
-		} else if (propName == "DoorMoveStartSound") {
-			reader >> m_DoorMoveStartSound;
-		} else if (propName == "DoorMoveSound") {
-			reader >> m_DoorMoveSound;
-		} else if (propName == "DoorDirectionChangeSound") {
-			reader >> m_DoorDirectionChangeSound;
-		} else if (propName == "DoorMoveEndSound") {
-			reader >> m_DoorMoveEndSound;
-		} else {
-			return Actor::ReadProperty(propName, reader);
-		}
-		return 0;
+		static const PropertyReaderMap<ADoor> propertyReaders = {
+			{ { "Door" }, [](ADoor &door, Reader &reader) {
+				delete door.m_Door;
+				door.m_Door = new Attachable;
+				reader >> door.m_Door;
+				door.m_DoorMaterialID = door.m_Door->GetMaterial()->GetIndex();
+			} },
+			{ { "OpenOffset" }, [](ADoor &door, Reader &reader) { reader >> door.m_OpenOffset; } },
+			{ { "ClosedOffset" }, [](ADoor &door, Reader &reader) { reader >> door.m_ClosedOffset; } },
+			{ { "OpenClosedOffset" }, [](ADoor &door, Reader &reader) {
+				reader >> door.m_OpenOffset;
+				door.m_ClosedOffset = door.m_OpenOffset;
+			} },
+			{ { "OpenAngle" }, [](ADoor &door, Reader &reader) {
+				Matrix rotation;
+				reader >> rotation;
+				door.m_OpenAngle = rotation.GetRadAngle();
+				if (door.m_OpenAngle < 0) { reader.ReportError("Door OpenAngle cannot be less than 0."); }
+			} },
+			{ { "ClosedAngle" }, [](ADoor &door, Reader &reader) {
+				Matrix rotation;
+				reader >> rotation;
+				door.m_ClosedAngle = rotation.GetRadAngle();
+				if (door.m_ClosedAngle < 0) { reader.ReportError("Door ClosedAngle cannot be less than 0."); }
+			} },
+			{ { "OpenClosedAngle" }, [](ADoor &door, Reader &reader) {
+				Matrix rotation;
+				reader >> rotation;
+				door.m_OpenAngle = rotation.GetRadAngle();
+				door.m_ClosedAngle = rotation.GetRadAngle();
+			} },
+			{ { "DoorMoveTime" }, [](ADoor &door, Reader &reader) { reader >> door.m_DoorMoveTime; } },
+			{ { "ClosedByDefault" }, [](ADoor &door, Reader &reader) { reader >> door.m_ClosedByDefault; } },
+			{ { "ResetDefaultDelay" }, [](ADoor &door, Reader &reader) { reader >> door.m_ResetToDefaultStateDelay; } },
+			{ { "SensorInterval" }, [](ADoor &door, Reader &reader) { reader >> door.m_SensorInterval; } },
+			{ { "AddSensor" }, [](ADoor &door, Reader &reader) {
+				ADSensor sensor;
+				reader >> sensor;
+				door.m_Sensors.push_back(sensor);
+			} },
+			{ { "DrawMaterialLayerWhenOpen" }, [](ADoor &door, Reader &reader) { reader >> door.m_DrawMaterialLayerWhenOpen; } },
+			{ { "DrawMaterialLayerWhenClosed" }, [](ADoor &door, Reader &reader) { reader >> door.m_DrawMaterialLayerWhenClosed; } },
+			{ { "DoorMoveStartSound" }, [](ADoor &door, Reader &reader) { reader >> door.m_DoorMoveStartSound; } },
+			{ { "DoorMoveSound" }, [](ADoor &door, Reader &reader) { reader >> door.m_DoorMoveSound; } },
+			{ { "DoorDirectionChangeSound" }, [](ADoor &door, Reader &reader) { reader >> door.m_DoorDirectionChangeSound; } },
+			{ { "DoorMoveEndSound" }, [](ADoor &door, Reader &reader) { reader >> door.m_DoorMoveEndSound; } }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : Actor::ReadProperty(propName, reader);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,86 +131,58 @@ int AEmitter::Create(const AEmitter &reference)
 
 int AEmitter::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "AddEmission")
-    {
-        Emission * emission = new Emission();
-        reader >> *emission;
-        m_EmissionList.push_back(emission);
-    }
-    else if (propName == "EmissionSound")
-        reader >> m_EmissionSound;
-    else if (propName == "BurstSound")
-        reader >> m_BurstSound;
-    else if (propName == "EndSound")
-        reader >> m_EndSound;
-    else if (propName == "EmissionEnabled")
-        reader >> m_EmitEnabled;
-    else if (propName == "EmissionCount")
-        reader >> m_EmitCount;
-    else if (propName == "EmissionCountLimit")
-        reader >> m_EmitCountLimit;
-    else if (propName == "ParticlesPerMinute")
-    {
-        float ppm;
-        reader >> ppm;
-        // Go through all emissions and set the rate so that it emulates the way it used to work, for mod backwards compatibility
-        for (list<Emission *>::iterator eItr = m_EmissionList.begin(); eItr != m_EmissionList.end(); ++eItr)
-            (*eItr)->m_PPM = ppm / m_EmissionList.size();
-    }
-    else if (propName == "MinThrottleRange")
-        reader >> m_MinThrottleRange;
-    else if (propName == "MaxThrottleRange")
-        reader >> m_MaxThrottleRange;
-    else if (propName == "Throttle")
-        reader >> m_Throttle;
-    else if (propName == "EmissionsIgnoreThis")
-        reader >> m_EmissionsIgnoreThis;
-    else if (propName == "BurstSize")
-    {
-        int burstSize;
-        reader >> burstSize;
-        // Go through all emissions and set the rate so that it emulates the way it used to work, for mod backwards compatibility
-        for (list<Emission *>::iterator eItr = m_EmissionList.begin(); eItr != m_EmissionList.end(); ++eItr)
-            (*eItr)->m_BurstSize = std::ceil((float)burstSize / (float)m_EmissionList.size());
-    }
-    else if (propName == "BurstScale")
-        reader >> m_BurstScale;
-    else if (propName == "BurstDamage")
-        reader >> m_BurstDamage;
-	else if (propName == "EmitterDamageMultiplier")
-		reader >> m_EmitterDamageMultiplier;
-	else if (propName == "BurstSpacing")
-        reader >> m_BurstSpacing;
-    else if (propName == "BurstTriggered")
-        reader >> m_BurstTriggered;
-    else if (propName == "EmissionAngle")
-        reader >> m_EmitAngle;
-    else if (propName == "EmissionOffset")
-        reader >> m_EmissionOffset;
-    else if (propName == "EmissionDamage")
-        reader >> m_EmitDamage;
-    else if (propName == "Flash")
-    {
-        const Entity *pObj = g_PresetMan.GetEntityPreset(reader);
-        if (pObj)
-        {
-            m_pFlash = dynamic_cast<Attachable *>(pObj->Clone());
-            if (m_pFlash)
-                m_pFlash->Attach(this);
-        }
-    }
-    else if (propName == "FlashScale")
-        reader >> m_FlashScale;
-    else if (propName == "FlashOnlyOnBurst")
-        reader >> m_FlashOnlyOnBurst;
-    else if (propName == "LoudnessOnEmit")
-        reader >> m_LoudnessOnEmit;
-    else
-    {
-        return Attachable::ReadProperty(propName, reader);
-    }
-
-    return 0;
+    static const PropertyReaderMap<AEmitter> propertyReaders = {
+        { { "AddEmission" }, [](AEmitter &emitter, Reader &reader) {
+            Emission * emission = new Emission();
+            reader >> *emission;
+            emitter.m_EmissionList.push_back(emission);
+        } },
+        { { "EmissionSound" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_EmissionSound; } },
+        { { "BurstSound" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_BurstSound; } },
+        { { "EndSound" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_EndSound; } },
+        { { "EmissionEnabled" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_EmitEnabled; } },
+        { { "EmissionCount" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_EmitCount; } },
+        { { "EmissionCountLimit" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_EmitCountLimit; } },
+        { { "ParticlesPerMinute" }, [](AEmitter &emitter, Reader &reader) {
+            float ppm;
+            reader >> ppm;
+            // Go through all emissions and set the rate so that it emulates the way it used to work, for mod backwards compatibility
+            for (list<Emission *>::iterator eItr = emitter.m_EmissionList.begin(); eItr != emitter.m_EmissionList.end(); ++eItr)
+                (*eItr)->m_PPM = ppm / emitter.m_EmissionList.size();
+        } },
+        { { "MinThrottleRange" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_MinThrottleRange; } },
+        { { "MaxThrottleRange" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_MaxThrottleRange; } },
+        { { "Throttle" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_Throttle; } },
+        { { "EmissionsIgnoreThis" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_EmissionsIgnoreThis; } },
+        { { "BurstSize" }, [](AEmitter &emitter, Reader &reader) {
+            int burstSize;
+            reader >> burstSize;
+            // Go through all emissions and set the rate so that it emulates the way it used to work, for mod backwards compatibility
+            for (list<Emission *>::iterator eItr = emitter.m_EmissionList.begin(); eItr != emitter.m_EmissionList.end(); ++eItr)
+                (*eItr)->m_BurstSize = std::ceil((float)burstSize / (float)emitter.m_EmissionList.size());
+        } },
+        { { "BurstScale" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_BurstScale; } },
+        { { "BurstDamage" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_BurstDamage; } },
+        { { "EmitterDamageMultiplier" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_EmitterDamageMultiplier; } },
+        { { "BurstSpacing" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_BurstSpacing; } },
+        { { "BurstTriggered" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_BurstTriggered; } },
+        { { "EmissionAngle" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_EmitAngle; } },
+        { { "EmissionOffset" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_EmissionOffset; } },
+        { { "EmissionDamage" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_EmitDamage; } },
+        { { "Flash" }, [](AEmitter &emitter, Reader &reader) {
+            const Entity *pObj = g_PresetMan.GetEntityPreset(reader);
+            if (pObj)
+            {
+                emitter.m_pFlash = dynamic_cast<Attachable *>(pObj->Clone());
+                if (emitter.m_pFlash)
+                    emitter.m_pFlash->Attach(&emitter);
+            }
+        } },
+        { { "FlashScale" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_FlashScale; } },
+        { { "FlashOnlyOnBurst" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_FlashOnlyOnBurst; } },
+        { { "LoudnessOnEmit" }, [](AEmitter &emitter, Reader &reader) { reader >> emitter.m_LoudnessOnEmit; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Attachable::ReadProperty(propName, reader);
 }
 
 
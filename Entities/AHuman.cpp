@@ -225,101 +225,79 @@ int AHuman::Create(const AHuman &reference)
 
 int AHuman::ReadProperty(std::string propName, Reader &reader)
 {
-	if (propName == "ThrowPrepTime")
-		reader >> m_ThrowPrepTime;
-	else if (propName == "Head")
-    {
-        delete m_pHead;
-        m_pHead = new Attachable;
-        reader >> m_pHead;
-		if (!m_pHead->IsDamageMultiplierRedefined())
-			m_pHead->SetDamageMultiplier(5);
-    }
-    else if (propName == "Jetpack")
-    {
-        delete m_pJetpack;
-        m_pJetpack = new AEmitter;
-        reader >> m_pJetpack;
-    }
-    else if (propName == "JumpTime")
-    {
-        reader >> m_JetTimeTotal;
-        // Convert to ms
-        m_JetTimeTotal *= 1000;
-    }
-    else if (propName == "FGArm")
-    {
-        delete m_pFGArm;
-        m_pFGArm = new Arm;
-        reader >> m_pFGArm;
-    }
-    else if (propName == "BGArm")
-    {
-        delete m_pBGArm;
-        m_pBGArm = new Arm;
-        reader >> m_pBGArm;
-    }
-    else if (propName == "FGLeg")
-    {
-        delete m_pFGLeg;
-        m_pFGLeg = new Leg;
-        reader >> m_pFGLeg;
-    }
-    else if (propName == "BGLeg")
-    {
-        delete m_pBGLeg;
-        m_pBGLeg = new Leg;
-        reader >> m_pBGLeg;
-    }
-    else if (propName == "HandGroup")
-    {
-        delete m_pFGHandGroup;
-        delete m_pBGHandGroup;
-        m_pFGHandGroup = new AtomGroup();
-        m_pBGHandGroup = new AtomGroup();
-        reader >> m_pFGHandGroup;
-        m_pBGHandGroup->Create(*m_pFGHandGroup);
-        m_pFGHandGroup->SetOwner(this);
-        m_pBGHandGroup->SetOwner(this);
-    }
-    else if (propName == "FGFootGroup")
-    {
-        delete m_pFGFootGroup;
-        m_pFGFootGroup = new AtomGroup();
-        reader >> m_pFGFootGroup;
-        m_pFGFootGroup->SetOwner(this);
-    }
-    else if (propName == "BGFootGroup")
-    {
-        delete m_pBGFootGroup;
-        m_pBGFootGroup = new AtomGroup();
-        reader >> m_pBGFootGroup;
-        m_pBGFootGroup->SetOwner(this);
-    }
-    else if (propName == "StrideSound")
-        reader >> m_StrideSound;
-    else if (propName == "StandLimbPath")
-        reader >> m_Paths[FGROUND][STAND];
-    else if (propName == "StandLimbPathBG")
-        reader >> m_Paths[BGROUND][STAND];
-    else if (propName == "WalkLimbPath")
-        reader >> m_Paths[FGROUND][WALK];
-    else if (propName == "CrouchLimbPath")
-        reader >> m_Paths[FGROUND][CROUCH];
-    else if (propName == "CrawlLimbPath")
-        reader >> m_Paths[FGROUND][CRAWL];
-    else if (propName == "ArmCrawlLimbPath")
-        reader >> m_Paths[FGROUND][ARMCRAWL];
-    else if (propName == "ClimbLimbPath")
-        reader >> m_Paths[FGROUND][CLIMB];
-    else if (propName == "JumpLimbPath")
-        reader >> m_Paths[FGROUND][JUMP];
-    else if (propName == "DislodgeLimbPath")
-        reader >> m_Paths[FGROUND][DISLODGE];
-    else
-        return Actor::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<AHuman> propertyReaders = {
+        { { "ThrowPrepTime" }, [](AHuman &human, Reader &reader) { reader >> human.m_ThrowPrepTime; } },
+        { { "Head" }, [](AHuman &human, Reader &reader) {
+            delete human.m_pHead;
+            human.m_pHead = new Attachable;
+            reader >> human.m_pHead;
+            if (!human.m_pHead->IsDamageMultiplierRedefined())
+                human.m_pHead->SetDamageMultiplier(5);
+        } },
+        { { "Jetpack" }, [](AHuman &human, Reader &reader) {
+            delete human.m_pJetpack;
+            human.m_pJetpack = new AEmitter;
+            reader >> human.m_pJetpack;
+        } },
+        { { "JumpTime" }, [](AHuman &human, Reader &reader) {
+            reader >> human.m_JetTimeTotal;
+            // Convert to ms
+            human.m_JetTimeTotal *= 1000;
+        } },
+        { { "FGArm" }, [](AHuman &human, Reader &reader) {
+            delete human.m_pFGArm;
+            human.m_pFGArm = new Arm;
+            reader >> human.m_pFGArm;
+        } },
+        { { "BGArm" }, [](AHuman &human, Reader &reader) {
+            delete human.m_pBGArm;
+            human.m_pBGArm = new Arm;
+            reader >> human.m_pBGArm;
+        } },
+        { { "FGLeg" }, [](AHuman &human, Reader &reader) {
+            delete human.m_pFGLeg;
+            human.m_pFGLeg = new Leg;
+            reader >> human.m_pFGLeg;
+        } },
+        { { "BGLeg" }, [](AHuman &human, Reader &reader) {
+            delete human.m_pBGLeg;
+            human.m_pBGLeg = new Leg;
+            reader >> human.m_pBGLeg;
+        } },
+        { { "HandGroup" }, [](AHuman &human, Reader &reader) {
+            delete human.m_pFGHandGroup;
+            delete human.m_pBGHandGroup;
+            human.m_pFGHandGroup = new AtomGroup();
+            human.m_pBGHandGroup = new AtomGroup();
+            reader >> human.m_pFGHandGroup;
+            human.m_pBGHandGroup->Create(*human.m_pFGHandGroup);
+            human.m_pFGHandGroup->SetOwner(&human);
+            human.m_pBGHandGroup->SetOwner(&human);
+        } },
+        { { "FGFootGroup" }, [](AHuman &human, Reader &reader) {
+            delete human.m_pFGFootGroup;
+            human.m_pFGFootGroup = new AtomGroup();
+            reader >> human.m_pFGFootGroup;
+            human.m_pFGFootGroup->SetOwner(&human);
+        } },
+        { { "BGFootGroup" }, [](AHuman &human, Reader &reader) {
+            delete human.m_pBGFootGroup;
+            human.m_pBGFootGroup = new AtomGroup();
+            reader >> human.m_pBGFootGroup;
+            human.m_pBGFootGroup->SetOwner(&human);
+        } },
+        { { "StrideSound" }, [](AHuman &human, Reader &reader) { reader >> human.m_StrideSound; } },
+        { { "StandLimbPath" }, [](AHuman &human, Reader &reader) { reader >> human.m_Paths[FGROUND][STAND]; } },
+        { { "StandLimbPathBG" }, [](AHuman &human, Reader &reader) { reader >> human.m_Paths[BGROUND][STAND]; } },
+        { { "WalkLimbPath" }, [](AHuman &human, Reader &reader) { reader >> human.m_Paths[FGROUND][WALK]; } },
+        { { "CrouchLimbPath" }, [](AHuman &human, Reader &reader) { reader >> human.m_Paths[FGROUND][CROUCH]; } },
+        { { "CrawlLimbPath" }, [](AHuman &human, Reader &reader) { reader >> human.m_Paths[FGROUND][CRAWL]; } },
+        { { "ArmCrawlLimbPath" }, [](AHuman &human, Reader &reader) { reader >> human.m_Paths[FGROUND][ARMCRAWL]; } },
+        { { "ClimbLimbPath" }, [](AHuman &human, Reader &reader) { reader >> human.m_Paths[FGROUND][CLIMB]; } },
+        { { "JumpLimbPath" }, [](AHuman &human, Reader &reader) { reader >> human.m_Paths[FGROUND][JUMP]; } },
+        { { "DislodgeLimbPath" }, [](AHuman &human, Reader &reader) { reader >> human.m_Paths[FGROUND][DISLODGE]; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Actor::ReadProperty(propName, reader);
 }
 
 
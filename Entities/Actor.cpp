@@ -325,83 +325,58 @@ int Actor::Create(const Actor &reference)
 
 int Actor::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "BodyHitSound")
-        reader >> m_BodyHitSound;
-    else if (propName == "AlarmSound")
-        reader >> m_AlarmSound;
-    else if (propName == "PainSound")
-        reader >> m_PainSound;
-    else if (propName == "DeathSound")
-        reader >> m_DeathSound;
-    else if (propName == "DeviceSwitchSound")
-        reader >> m_DeviceSwitchSound;
-    else if (propName == "Status")
-        reader >> m_Status;
-    else if (propName == "DeploymentID")
-        reader >> m_DeploymentID;
-    else if (propName == "PassengerSlots")
-        reader >> m_PassengerSlots;
-    else if (propName == "Health")
-    {
-        reader >> m_Health;
-        m_PrevHealth = m_Health;
-		if (m_Health > m_MaxHealth)
-			m_MaxHealth = m_Health;
-    }
-    else if (propName == "MaxHealth")
-	{
-		reader >> m_MaxHealth;
-		if (m_MaxHealth < m_Health)
-		{
-			m_Health = m_MaxHealth;
-	        m_PrevHealth = m_Health;
-		}
-	}
-    else if (propName == "ImpulseDamageThreshold")
-        reader >> m_TravelImpulseDamage;
-    else if (propName == "StableVelocityThreshold")
-        reader >> m_StableVel;
-    else if (propName == "AimAngle")
-        reader >> m_AimAngle;
-    else if (propName == "AimRange")
-        reader >> m_AimRange;
-    else if (propName == "AimDistance")
-        reader >> m_AimDistance;
-    else if (propName == "SharpAimDelay")
-        reader >> m_SharpAimDelay;
-    else if (propName == "SightDistance")
-        reader >> m_SightDistance;
-    else if (propName == "Perceptiveness")
-        reader >> m_Perceptiveness;
-    else if (propName == "CharHeight")
-        reader >> m_CharHeight;
-    else if (propName == "HolsterOffset")
-        reader >> m_HolsterOffset;
-    else if (propName == "AddInventoryDevice" || propName == "AddInventory")
-    {
-        MovableObject *pInvMO = dynamic_cast<MovableObject *>(g_PresetMan.ReadReflectedPreset(reader));
-        RTEAssert(pInvMO, "Reader has been fed bad Inventory MovableObject in Actor::Create");
-        m_Inventory.push_back(pInvMO);
-    }
-    else if (propName == "MaxMass")
-        reader >> m_MaxMass;
-    else if (propName == "AddPieSlice")
-    {
-        PieMenuGUI::Slice newSlice;
-        reader >> newSlice;
-        m_PieSlices.push_back(newSlice);
-		PieMenuGUI::AddAvailableSlice(newSlice);
-    }
-    else if (propName == "AIMode")
-    {
-        int mode;
-        reader >> mode;
-        m_AIMode = static_cast<AIMode>(mode);
-    }
-    else
-        return MOSRotating::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<Actor> propertyReaders = {
+        { { "BodyHitSound" }, [](Actor &actor, Reader &reader) { reader >> actor.m_BodyHitSound; } },
+        { { "AlarmSound" }, [](Actor &actor, Reader &reader) { reader >> actor.m_AlarmSound; } },
+        { { "PainSound" }, [](Actor &actor, Reader &reader) { reader >> actor.m_PainSound; } },
+        { { "DeathSound" }, [](Actor &actor, Reader &reader) { reader >> actor.m_DeathSound; } },
+        { { "DeviceSwitchSound" }, [](Actor &actor, Reader &reader) { reader >> actor.m_DeviceSwitchSound; } },
+        { { "Status" }, [](Actor &actor, Reader &reader) { reader >> actor.m_Status; } },
+        { { "DeploymentID" }, [](Actor &actor, Reader &reader) { reader >> actor.m_DeploymentID; } },
+        { { "PassengerSlots" }, [](Actor &actor, Reader &reader) { reader >> actor.m_PassengerSlots; } },
+        { { "Health" }, [](Actor &actor, Reader &reader) {
+            reader >> actor.m_Health;
+            actor.m_PrevHealth = actor.m_Health;
+            if (actor.m_Health > actor.m_MaxHealth)
+                actor.m_MaxHealth = actor.m_Health;
+        } },
+        { { "MaxHealth" }, [](Actor &actor, Reader &reader) {
+            reader >> actor.m_MaxHealth;
+            if (actor.m_MaxHealth < actor.m_Health)
+            {
+                actor.m_Health = actor.m_MaxHealth;
+                actor.m_PrevHealth = actor.m_Health;
+            }
+        } },
+        { { "ImpulseDamageThreshold" }, [](Actor &actor, Reader &reader) { reader >> actor.m_TravelImpulseDamage; } },
+        { { "StableVelocityThreshold" }, [](Actor &actor, Reader &reader) { reader >> actor.m_StableVel; } },
+        { { "AimAngle" }, [](Actor &actor, Reader &reader) { reader >> actor.m_AimAngle; } },
+        { { "AimRange" }, [](Actor &actor, Reader &reader) { reader >> actor.m_AimRange; } },
+        { { "AimDistance" }, [](Actor &actor, Reader &reader) { reader >> actor.m_AimDistance; } },
+        { { "SharpAimDelay" }, [](Actor &actor, Reader &reader) { reader >> actor.m_SharpAimDelay; } },
+        { { "SightDistance" }, [](Actor &actor, Reader &reader) { reader >> actor.m_SightDistance; } },
+        { { "Perceptiveness" }, [](Actor &actor, Reader &reader) { reader >> actor.m_Perceptiveness; } },
+        { { "CharHeight" }, [](Actor &actor, Reader &reader) { reader >> actor.m_CharHeight; } },
+        { { "HolsterOffset" }, [](Actor &actor, Reader &reader) { reader >> actor.m_HolsterOffset; } },
+        { { "AddInventoryDevice", "AddInventory" }, [](Actor &actor, Reader &reader) {
+            MovableObject *pInvMO = dynamic_cast<MovableObject *>(g_PresetMan.ReadReflectedPreset(reader));
+            RTEAssert(pInvMO, "Reader has been fed bad Inventory MovableObject in Actor::Create");
+            actor.m_Inventory.push_back(pInvMO);
+        } },
+        { { "MaxMass" }, [](Actor &actor, Reader &reader) { reader >> actor.m_MaxMass; } },
+        { { "AddPieSlice" }, [](Actor &actor, Reader &reader) {
+            PieMenuGUI::Slice newSlice;
+            reader >> newSlice;
+            actor.m_PieSlices.push_back(newSlice);
+            PieMenuGUI::AddAvailableSlice(newSlice);
+        } },
+        { { "AIMode" }, [](Actor &actor, Reader &reader) {
+            int mode;
+            reader >> mode;
+            actor.m_AIMode = static_cast<AIMode>(mode);
+        } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : MOSRotating::ReadProperty(propName, reader);
 }
 
 
@@ -96,35 +96,28 @@ int Arm::Create(const Arm &reference)
 
 int Arm::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "HeldDevice")
-    {
-        const Entity *pEntity;
-        pEntity = g_PresetMan.GetEntityPreset(reader);
-        if (pEntity)
-        {
-            m_pHeldMO = dynamic_cast<MovableObject *>(pEntity->Clone());
-            if (m_pHeldMO->IsDevice())
-                dynamic_cast<HeldDevice *>(m_pHeldMO)->Attach(this, dynamic_cast<HeldDevice *>(m_pHeldMO)->GetParentOffset());
-        }
-        pEntity = 0;
-    }
-    else if (propName == "Hand")
-    {
-        reader >> m_HandFile;
-        m_pHand = m_HandFile.GetAsBitmap();
-    }
-    else if (propName == "MaxLength")
-        reader >> m_MaxLength;
-    else if (propName == "IdleOffset")
-        reader >> m_IdleOffset;
-    else if (propName == "WillIdle")
-        reader >> m_WillIdle;
-    else if (propName == "MoveSpeed")
-        reader >> m_MoveSpeed;
-    else
-        return Attachable::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<Arm> propertyReaders = {
+        { { "HeldDevice" }, [](Arm &arm, Reader &reader) {
+            const Entity *pEntity;
+            pEntity = g_PresetMan.GetEntityPreset(reader);
+            if (pEntity)
+            {
+                arm.m_pHeldMO = dynamic_cast<MovableObject *>(pEntity->Clone());
+                if (arm.m_pHeldMO->IsDevice())
+                    dynamic_cast<HeldDevice *>(arm.m_pHeldMO)->Attach(&arm, dynamic_cast<HeldDevice *>(arm.m_pHeldMO)->GetParentOffset());
+            }
+            pEntity = 0;
+        } },
+        { { "Hand" }, [](Arm &arm, Reader &reader) {
+            reader >> arm.m_HandFile;
+            arm.m_pHand = arm.m_HandFile.GetAsBitmap();
+        } },
+        { { "MaxLength" }, [](Arm &arm, Reader &reader) { reader >> arm.m_MaxLength; } },
+        { { "IdleOffset" }, [](Arm &arm, Reader &reader) { reader >> arm.m_IdleOffset; } },
+        { { "WillIdle" }, [](Arm &arm, Reader &reader) { reader >> arm.m_WillIdle; } },
+        { { "MoveSpeed" }, [](Arm &arm, Reader &reader) { reader >> arm.m_MoveSpeed; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Attachable::ReadProperty(propName, reader);
 }
 
 
@@ -104,33 +104,29 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int AtomGroup::ReadProperty(std::string propName, Reader &reader) {
-		if (propName == "Material") {
-			Material mat;
-			mat.Reset();
-			reader >> mat;
-			m_Material = mat.GetIndex() ? g_SceneMan.GetMaterialFromID(mat.GetIndex()) : g_SceneMan.GetMaterial(mat.GetPresetName());
-
-			if (!m_Material) {
-				g_ConsoleMan.PrintString("ERROR: Failed to find matching Material preset \"" + mat.GetPresetName() + "\" " + GetFormattedReaderPosition() + ". Was it defined with AddMaterial?");
-				m_Material = g_SceneMan.GetMaterialFromID(g_MaterialAir);
-				RTEAssert(m_Material, "Failed to find matching Material preset \"" + mat.GetPresetName() + "\" or even fall back to \"Air\" " + GetFormattedReaderPosition() + ".\nAborting!");
-			}
-		} else if (propName == "AutoGenerate") {
-			reader >> m_AutoGenerate;
-		} else if (propName == "Resolution") {
-			reader >> m_Resolution;
-		} else if (propName == "Depth") {
-			reader >> m_Depth;
-		} else if (propName == "AddAtom") {
-			Atom *atom = new Atom;
-			reader >> *atom;
-			m_Atoms.push_back(atom);
-		} else if (propName == "JointOffset") {
-			reader >> m_JointOffset;
-		} else {
-			return Entity::ReadProperty(propName, reader);
-		}
-		return 0;
+		static const PropertyReaderMap<AtomGroup> propertyReaders = {
+			{ { "Material" }, [](AtomGroup &atomGroup, Reader &reader) {
+				Material mat;
+				mat.Reset();
+				reader >> mat;
+				atomGroup.m_Material = mat.GetIndex() ? g_SceneMan.GetMaterialFromID(mat.GetIndex()) : g_SceneMan.GetMaterial(mat.GetPresetName());
+				if (!atomGroup.m_Material) {
+					g_ConsoleMan.PrintString("ERROR: Failed to find matching Material preset \"" + mat.GetPresetName() + "\" " + atomGroup.GetFormattedReaderPosition() + ". Was it defined with AddMaterial?");
+					atomGroup.m_Material = g_SceneMan.GetMaterialFromID(g_MaterialAir);
+					RTEAssert(atomGroup.m_Material, "Failed to find matching Material preset \"" + mat.GetPresetName() + "\" or even fall back to \"Air\" " + atomGroup.GetFormattedReaderPosition() + ".\nAborting!");
+				}
+			} },
+			{ { "AutoGenerate" }, [](AtomGroup &atomGroup, Reader &reader) { reader >> atomGroup.m_AutoGenerate; } },
+			{ { "Resolution" }, [](AtomGroup &atomGroup, Reader &reader) { reader >> atomGroup.m_Resolution; } },
+			{ { "Depth" }, [](AtomGroup &atomGroup, Reader &reader) { reader >> atomGroup.m_Depth; } },
+			{ { "AddAtom" }, [](AtomGroup &atomGroup, Reader &reader) {
+				Atom *atom = new Atom;
+				reader >> *atom;
+				atomGroup.m_Atoms.push_back(atom);
+			} },
+			{ { "JointOffset" }, [](AtomGroup &atomGroup, Reader &reader) { reader >> atomGroup.m_JointOffset; } }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : Entity::ReadProperty(propName, reader);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
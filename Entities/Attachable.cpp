@@ -104,28 +104,18 @@ int Attachable::Create(const Attachable &reference)
 
 int Attachable::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "ParentOffset")
-        reader >> m_ParentOffset;
-    else if (propName == "JointStrength" || propName == "Strength")
-        reader >> m_JointStrength;
-    else if (propName == "JointStiffness" || propName == "Stiffness")
-        reader >> m_JointStiffness;
-    else if (propName == "BreakWound")
-        m_pBreakWound = dynamic_cast<const AEmitter *>(g_PresetMan.GetEntityPreset(reader));
-    else if (propName == "JointOffset")
-        reader >> m_JointOffset;
-    else if (propName == "InheritsRotAngle")
-        reader >> m_InheritsRotAngle;
-    else if (propName == "DrawAfterParent")
-        reader >> m_DrawAfterParent;
-    else if (propName == "CollidesWithTerrainWhenAttached")
-        reader >> m_CanCollideWithTerrainWhenAttached;
-	else if (propName == "DeleteWithParent")
-		reader >> m_DeleteWithParent;
-    else
-        return MOSRotating::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<Attachable> propertyReaders = {
+        { { "ParentOffset" }, [](Attachable &attachable, Reader &reader) { reader >> attachable.m_ParentOffset; } },
+        { { "JointStrength", "Strength" }, [](Attachable &attachable, Reader &reader) { reader >> attachable.m_JointStrength; } },
+        { { "JointStiffness", "Stiffness" }, [](Attachable &attachable, Reader &reader) { reader >> attachable.m_JointStiffness; } },
+        { { "BreakWound" }, [](Attachable &attachable, Reader &reader) { attachable.m_pBreakWound = dynamic_cast<const AEmitter *>(g_PresetMan.GetEntityPreset(reader)); } },
+        { { "JointOffset" }, [](Attachable &attachable, Reader &reader) { reader >> attachable.m_JointOffset; } },
+        { { "InheritsRotAngle" }, [](Attachable &attachable, Reader &reader) { reader >> attachable.m_InheritsRotAngle; } },
+        { { "DrawAfterParent" }, [](Attachable &attachable, Reader &reader) { reader >> attachable.m_DrawAfterParent; } },
+        { { "CollidesWithTerrainWhenAttached" }, [](Attachable &attachable, Reader &reader) { reader >> attachable.m_CanCollideWithTerrainWhenAttached; } },
+        { { "DeleteWithParent" }, [](Attachable &attachable, Reader &reader) { reader >> attachable.m_DeleteWithParent; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : MOSRotating::ReadProperty(propName, reader);
 }
 
 
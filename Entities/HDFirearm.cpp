@@ -17,6 +17,8 @@
 #include "ThrownDevice.h"
 #include "MOPixel.h"
 #include "Actor.h"
+#include "AHuman.h"
+#include "NetworkServer.h"
 
 namespace RTE {
 
@@ -156,96 +158,75 @@ int HDFirearm::Create(const HDFirearm &reference)
 
 int HDFirearm::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "Magazine")
-    {
-        const Entity *pObj = g_PresetMan.GetEntityPreset(reader);
-        if (pObj)
-        {
-            m_pMagazineReference = dynamic_cast<const Magazine *>(pObj);
-
-            delete m_pMagazine;
-            m_pMagazine = dynamic_cast<Magazine *>(m_pMagazineReference->Clone());
-        }
-    }
-    else if (propName == "Flash")
-    {
-        const Entity *pObj = g_PresetMan.GetEntityPreset(reader);
-        if (pObj)
-        {
-            m_pFlash = dynamic_cast<Attachable *>(pObj->Clone());
-            if (m_pFlash)
-                m_pFlash->Attach(this);
-        }
-    } else if (propName == "PreFireSound") {
-        reader >> m_PreFireSound;
-        m_DeactivationSound.SetSoundOverlapMode(SoundContainer::SoundOverlapMode::IGNORE_PLAY);
-    } else if (propName == "FireSound")
-        reader >> m_FireSound;
-    else if (propName == "FireEchoSound") {
-        reader >> m_FireEchoSound;
-        m_FireEchoSound.SetSoundOverlapMode(SoundContainer::SoundOverlapMode::RESTART);
-    } else if (propName == "ActiveSound") {
-        reader >> m_ActiveSound;
-    } else if (propName == "DeactivationSound") {
-        reader >> m_DeactivationSound;
-        m_DeactivationSound.SetSoundOverlapMode(SoundContainer::SoundOverlapMode::IGNORE_PLAY);
-    } else if (propName == "EmptySound")
-        reader >> m_EmptySound;
-    else if (propName == "ReloadStartSound")
-        reader >> m_ReloadStartSound;
-    else if (propName == "ReloadEndSound")
-        reader >> m_ReloadEndSound;
-    else if (propName == "RateOfFire")
-        reader >> m_RateOfFire;
-    else if (propName == "ActivationDelay")
-        reader >> m_ActivationDelay;
-    else if (propName == "DeactivationDelay")
-        reader >> m_DeactivationDelay;
-    else if (propName == "ReloadTime")
-        reader >> m_ReloadTime;
-    else if (propName == "FullAuto")
-        reader >> m_FullAuto;
-    else if (propName == "FireIgnoresThis")
-        reader >> m_FireIgnoresThis;
-    else if (propName == "RecoilTransmission")
-        reader >> m_RecoilTransmission;
-	else if (propName == "IsAnimatedManually")
-		reader >> m_IsAnimatedManually;
-	else if (propName == "ShakeRange")
-    {
-        reader >> m_ShakeRange;
-        m_ShakeRange /= 2;
-    }
-    else if (propName == "SharpShakeRange")
-    {
-        reader >> m_SharpShakeRange;
-        m_SharpShakeRange /= 2;
-    }
-    else if (propName == "NoSupportFactor")
-        reader >> m_NoSupportFactor;
-    else if (propName == "ParticleSpreadRange")
-    {
-        reader >> m_ParticleSpreadRange;
-        m_ParticleSpreadRange /= 2;
-    }
-    else if (propName == "ShellSpreadRange")
-    {
-        reader >> m_ShellSpreadRange;
-        m_ShellSpreadRange /= 2;
-    }
-    else if (propName == "ShellAngVelRange")
-    {
-        reader >> m_ShellAngVelRange;
-        m_ShellAngVelRange /= 2;
-    }
-    else if (propName == "MuzzleOffset")
-        reader >> m_MuzzleOff;
-    else if (propName == "EjectionOffset")
-        reader >> m_EjectOff;
-    else
-        return HeldDevice::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<HDFirearm> propertyReaders = {
+        { { "Magazine" }, [](HDFirearm &firearm, Reader &reader) {
+            const Entity *pObj = g_PresetMan.GetEntityPreset(reader);
+            if (pObj)
+            {
+                firearm.m_pMagazineReference = dynamic_cast<const Magazine *>(pObj);
+                delete firearm.m_pMagazine;
+                firearm.m_pMagazine = dynamic_cast<Magazine *>(firearm.m_pMagazineReference->Clone());
+            }
+        } },
+        { { "Flash" }, [](HDFirearm &firearm, Reader &reader) {
+            const Entity *pObj = g_PresetMan.GetEntityPreset(reader);
+            if (pObj)
+            {
+                firearm.m_pFlash = dynamic_cast<Attachable *>(pObj->Clone());
+                if (firearm.m_pFlash)
+                    firearm.m_pFlash->Attach(&firearm);
+            }
+        } },
+        { { "PreFireSound" }, [](HDFirearm &firearm, Reader &reader) {
+            reader >> firearm.m_PreFireSound;
+            firearm.m_DeactivationSound.SetSoundOverlapMode(SoundContainer::SoundOverlapMode::IGNORE_PLAY);
+        } },
+        { { "FireSound" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_FireSound; } },
+        { { "FireEchoSound" }, [](HDFirearm &firearm, Reader &reader) {
+            reader >> firearm.m_FireEchoSound;
+            firearm.m_FireEchoSound.SetSoundOverlapMode(SoundContainer::SoundOverlapMode::RESTART);
+        } },
+        { { "ActiveSound" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_ActiveSound; } },
+        { { "DeactivationSound" }, [](HDFirearm &firearm, Reader &reader) {
+            reader >> firearm.m_DeactivationSound;
+            firearm.m_DeactivationSound.SetSoundOverlapMode(SoundContainer::SoundOverlapMode::IGNORE_PLAY);
+        } },
+        { { "EmptySound" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_EmptySound; } },
+        { { "ReloadStartSound" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_ReloadStartSound; } },
+        { { "ReloadEndSound" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_ReloadEndSound; } },
+        { { "RateOfFire" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_RateOfFire; } },
+        { { "ActivationDelay" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_ActivationDelay; } },
+        { { "DeactivationDelay" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_DeactivationDelay; } },
+        { { "ReloadTime" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_ReloadTime; } },
+        { { "FullAuto" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_FullAuto; } },
+        { { "FireIgnoresThis" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_FireIgnoresThis; } },
+        { { "RecoilTransmission" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_RecoilTransmission; } },
+        { { "IsAnimatedManually" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_IsAnimatedManually; } },
+        { { "ShakeRange" }, [](HDFirearm &firearm, Reader &reader) {
+            reader >> firearm.m_ShakeRange;
+            firearm.m_ShakeRange /= 2;
+        } },
+        { { "SharpShakeRange" }, [](HDFirearm &firearm, Reader &reader) {
+            reader >> firearm.m_SharpShakeRange;
+            firearm.m_SharpShakeRange /= 2;
+        } },
+        { { "NoSupportFactor" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_NoSupportFactor; } },
+        { { "ParticleSpreadRange" }, [](HDFirearm &firearm, Reader &reader) {
+            reader >> firearm.m_ParticleSpreadRange;
+            firearm.m_ParticleSpreadRange /= 2;
+        } },
+        { { "ShellSpreadRange" }, [](HDFirearm &firearm, Reader &reader) {
+            reader >> firearm.m_ShellSpreadRange;
+            firearm.m_ShellSpreadRange /= 2;
+        } },
+        { { "ShellAngVelRange" }, [](HDFirearm &firearm, Reader &reader) {
+            reader >> firearm.m_ShellAngVelRange;
+            firearm.m_ShellAngVelRange /= 2;
+        } },
+        { { "MuzzleOffset" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_MuzzleOff; } },
+        { { "EjectionOffset" }, [](HDFirearm &firearm, Reader &reader) { reader >> firearm.m_EjectOff; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : HeldDevice::ReadProperty(propName, reader);
 }
 
 
@@ -1184,6 +1165,14 @@ void HDFirearm::DrawHUD(BITMAP *pTargetBitmap, const Vector &targetPos, int whic
 
     float sharpLength = m_MaxSharpLength * m_SharpAim;
 
+    if (playerControlled && g_FrameMan.IsInMultiplayerMode())
+    {
+        // Network clients draw the reticle of the gun their actor holds themselves, so it follows their mouse without waiting for the server
+        const AHuman *pHolder = dynamic_cast<const AHuman *>(GetRootParent());
+        if (pHolder && pHolder->GetEquippedItem() == this && g_NetworkServer.IsInputOverlayDrawnByClient(g_ActivityMan.GetActivity()->PlayerOfScreen(whichScreen)))
+            return;
+    }
+
     if (playerControlled)
     {
         Vector aimPoint1(sharpLength - 9, 0);
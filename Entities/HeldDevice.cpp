@@ -148,33 +148,23 @@ int HeldDevice::Create(const HeldDevice &reference)
 
 int HeldDevice::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "HeldDeviceType")
-        reader >> m_HeldDeviceType;
-    else if (propName == "OneHanded")
-        reader >> m_OneHanded;
-	else if (propName == "DualWieldable")
-		reader >> m_DualWieldable;
-	else if (propName == "StanceOffset")
-        reader >> m_StanceOffset;
-    else if (propName == "SharpStanceOffset")
-        reader >> m_SharpStanceOffset;
-    else if (propName == "SupportOffset")
-        reader >> m_SupportOffset;
-    else if (propName == "SharpLength")
-        reader >> m_MaxSharpLength;
-    else if (propName == "Loudness")
-        reader >> m_Loudness;
-    else if (propName == "AddPieSlice")
-    {
-        PieMenuGUI::Slice newSlice;
-        reader >> newSlice;
-        m_PieSlices.push_back(newSlice);
-		PieMenuGUI::AddAvailableSlice(newSlice);
-    }
-    else
-        return Attachable::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<HeldDevice> propertyReaders = {
+        { { "HeldDeviceType" }, [](HeldDevice &heldDevice, Reader &reader) { reader >> heldDevice.m_HeldDeviceType; } },
+        { { "OneHanded" }, [](HeldDevice &heldDevice, Reader &reader) { reader >> heldDevice.m_OneHanded; } },
+        { { "DualWieldable" }, [](HeldDevice &heldDevice, Reader &reader) { reader >> heldDevice.m_DualWieldable; } },
+        { { "StanceOffset" }, [](HeldDevice &heldDevice, Reader &reader) { reader >> heldDevice.m_StanceOffset; } },
+        { { "SharpStanceOffset" }, [](HeldDevice &heldDevice, Reader &reader) { reader >> heldDevice.m_SharpStanceOffset; } },
+        { { "SupportOffset" }, [](HeldDevice &heldDevice, Reader &reader) { reader >> heldDevice.m_SupportOffset; } },
+        { { "SharpLength" }, [](HeldDevice &heldDevice, Reader &reader) { reader >> heldDevice.m_MaxSharpLength; } },
+        { { "Loudness" }, [](HeldDevice &heldDevice, Reader &reader) { reader >> heldDevice.m_Loudness; } },
+        { { "AddPieSlice" }, [](HeldDevice &heldDevice, Reader &reader) {
+            PieMenuGUI::Slice newSlice;
+            reader >> newSlice;
+            heldDevice.m_PieSlices.push_back(newSlice);
+            PieMenuGUI::AddAvailableSlice(newSlice);
+        } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Attachable::ReadProperty(propName, reader);
 }
 
 
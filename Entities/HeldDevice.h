@@ -282,6 +282,16 @@ ClassInfoGetters
 	void SetSupportOffset(Vector newOffset) { m_SupportOffset = newOffset; }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetSharpAim
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the degree to which this is being aimed sharp.
+// Arguments:       None.
+// Return value:    A normalized scalar between 0 (no sharp aim) to 1.0 (best aim).
+
+    float GetSharpAim() const { return m_SharpAim; }
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          SetSharpAim
 //////////////////////////////////////////////////////////////////////////////////////////
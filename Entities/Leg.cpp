@@ -106,45 +106,36 @@ int Leg::Create(const Leg &reference)
 
 int Leg::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "Foot")
-    {
-        const Entity *pObj = g_PresetMan.GetEntityPreset(reader);
-        if (pObj)
-        {
-            m_pFoot = dynamic_cast<Attachable *>(pObj->Clone());
-        }
-    }
-    else if (propName == "ContractedOffset")
-    {
-        reader >> m_ContractedOffset;
-        m_MinExtension = m_ContractedOffset.GetMagnitude();
-    }
-    else if (propName == "ExtendedOffset")
-    {
-        reader >> m_ExtendedOffset;
-        m_MaxExtension = m_ExtendedOffset.GetMagnitude();
-    }
-    else if (propName == "MaxLength")
-    {
-        // For backward compatibiltiy with before
-        float maxLength;
-        reader >> maxLength;
-
-        m_MinExtension = maxLength / 2;
-        m_ContractedOffset.SetXY(m_MinExtension, 0);
-        m_MaxExtension = maxLength;
-        m_ExtendedOffset.SetXY(m_MaxExtension, 0);
-    }
-    else if (propName == "IdleOffset")
-        reader >> m_IdleOffset;
-    else if (propName == "WillIdle")
-        reader >> m_WillIdle;
-    else if (propName == "MoveSpeed")
-        reader >> m_MoveSpeed;
-    else
-        return Attachable::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<Leg> propertyReaders = {
+        { { "Foot" }, [](Leg &leg, Reader &reader) {
+            const Entity *pObj = g_PresetMan.GetEntityPreset(reader);
+            if (pObj)
+            {
+                leg.m_pFoot = dynamic_cast<Attachable *>(pObj->Clone());
+            }
+        } },
+        { { "ContractedOffset" }, [](Leg &leg, Reader &reader) {
+            reader >> leg.m_ContractedOffset;
+            leg.m_MinExtension = leg.m_ContractedOffset.GetMagnitude();
+        } },
+        { { "ExtendedOffset" }, [](Leg &leg, Reader &reader) {
+            reader >> leg.m_ExtendedOffset;
+            leg.m_MaxExtension = leg.m_ExtendedOffset.GetMagnitude();
+        } },
+        { { "MaxLength" }, [](Leg &leg, Reader &reader) {
+            // For backward compatibiltiy with before
+            float maxLength;
+            reader >> maxLength;
+            leg.m_MinExtension = maxLength / 2;
+            leg.m_ContractedOffset.SetXY(leg.m_MinExtension, 0);
+            leg.m_MaxExtension = maxLength;
+            leg.m_ExtendedOffset.SetXY(leg.m_MaxExtension, 0);
+        } },
+        { { "IdleOffset" }, [](Leg &leg, Reader &reader) { reader >> leg.m_IdleOffset; } },
+        { { "WillIdle" }, [](Leg &leg, Reader &reader) { reader >> leg.m_WillIdle; } },
+        { { "MoveSpeed" }, [](Leg &leg, Reader &reader) { reader >> leg.m_MoveSpeed; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Attachable::ReadProperty(propName, reader);
 }
 
 
@@ -30,7 +30,7 @@ void LimbPath::Clear()
 {
     m_Start.Reset();
     m_StartSegCount = 0;
-    m_Segments.clear();
+    m_Segments.Reset();
 //    m_CurrentSegment = 0;
     m_SegProgress = 0.0;
     for (int i = 0; i < SPEEDCOUNT; ++i)
@@ -62,10 +62,10 @@ int LimbPath::Create()
     if (Entity::Create() < 0)
         return -1;
 
-    if (m_Segments.size() > 0)
-        m_CurrentSegment = m_Segments.begin();
+    if (m_Segments.Get().size() > 0)
+        m_CurrentSegment = m_Segments.Get().begin();
     else
-        m_CurrentSegment = m_Segments.end();
+        m_CurrentSegment = m_Segments.Get().end();
 
     Terminate();
 
@@ -111,14 +111,13 @@ int LimbPath::Create(const LimbPath &reference)
     m_Start = reference.m_Start;
     m_StartSegCount = reference.m_StartSegCount;
 
-    deque<Vector>::const_iterator itr;
-    for (itr = reference.m_Segments.begin(); itr != reference.m_Segments.end(); ++itr)
-        m_Segments.push_back(*itr);
+    // The segments are shared with the reference until either changes them
+    m_Segments = reference.m_Segments;
 
-    if (m_Segments.size() > 0)
-        m_CurrentSegment = m_Segments.begin();
+    if (m_Segments.Get().size() > 0)
+        m_CurrentSegment = m_Segments.Get().begin();
     else
-        m_CurrentSegment = m_Segments.end();
+        m_CurrentSegment = m_Segments.Get().end();
 
     m_SegProgress = reference.m_SegProgress;
     for (int i = 0; i < SPEEDCOUNT; ++i)
@@ -146,43 +145,35 @@ int LimbPath::Create(const LimbPath &reference)
 
 int LimbPath::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "StartOffset")
-        reader >> m_Start;
-    else if (propName == "StartSegCount")
-        reader >> m_StartSegCount;
-    else if (propName == "AddSegment")
-    {
-        Vector segment;
-        reader >> segment;
-        m_Segments.push_back(segment);
-        m_TotalLength += segment.GetMagnitude();
-        if (m_Segments.size() >= m_StartSegCount)
-            m_RegularLength += segment.GetMagnitude();
-    }
-	else if (propName == "SlowTravelSpeed")
-	{
-		reader >> m_TravelSpeed[SLOW];
-		//m_TravelSpeed[SLOW] = m_TravelSpeed[SLOW] * 2;
-	}
-	else if (propName == "NormalTravelSpeed")
-	{
-		reader >> m_TravelSpeed[NORMAL];
-		//m_TravelSpeed[NORMAL] = m_TravelSpeed[NORMAL] * 2;
-	}
-	else if (propName == "FastTravelSpeed")
-	{
-		reader >> m_TravelSpeed[FAST];
-		//m_TravelSpeed[FAST] = m_TravelSpeed[FAST] * 2;
-	}
-	else if (propName == "PushForce")
-	{
-		reader >> m_PushForce;
-		//m_PushForce = m_PushForce / 1.5;
-	}
-    else
-        return Entity::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<LimbPath> propertyReaders = {
+        { { "StartOffset" }, [](LimbPath &limbPath, Reader &reader) { reader >> limbPath.m_Start; } },
+        { { "StartSegCount" }, [](LimbPath &limbPath, Reader &reader) { reader >> limbPath.m_StartSegCount; } },
+        { { "AddSegment" }, [](LimbPath &limbPath, Reader &reader) {
+            Vector segment;
+            reader >> segment;
+            limbPath.m_Segments.GetForWriting().push_back(segment);
+            limbPath.m_TotalLength += segment.GetMagnitude();
+            if (limbPath.m_Segments.Get().size() >= limbPath.m_StartSegCount)
+                limbPath.m_RegularLength += segment.GetMagnitude();
+        } },
+        { { "SlowTravelSpeed" }, [](LimbPath &limbPath, Reader &reader) {
+            reader >> limbPath.m_TravelSpeed[SLOW];
+            //m_TravelSpeed[SLOW] = m_TravelSpeed[SLOW] * 2;
+        } },
+        { { "NormalTravelSpeed" }, [](LimbPath &limbPath, Reader &reader) {
+            reader >> limbPath.m_TravelSpeed[NORMAL];
+            //m_TravelSpeed[NORMAL] = m_TravelSpeed[NORMAL] * 2;
+        } },
+        { { "FastTravelSpeed" }, [](LimbPath &limbPath, Reader &reader) {
+            reader >> limbPath.m_TravelSpeed[FAST];
+            //m_TravelSpeed[FAST] = m_TravelSpeed[FAST] * 2;
+        } },
+        { { "PushForce" }, [](LimbPath &limbPath, Reader &reader) {
+            reader >> limbPath.m_PushForce;
+            //m_PushForce = m_PushForce / 1.5;
+        } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Entity::ReadProperty(propName, reader);
 }
 
 
@@ -200,7 +191,7 @@ int LimbPath::Save(Writer &writer) const
     writer << m_Start;
     writer.NewProperty("StartSegCount");
     writer << m_StartSegCount;
-    for (deque<Vector>::const_iterator itr = m_Segments.begin(); itr != m_Segments.end(); ++itr)
+    for (deque<Vector>::const_iterator itr = m_Segments.Get().begin(); itr != m_Segments.Get().end(); ++itr)
     {
         writer.NewProperty("AddSegment");
         writer << *itr;
@@ -248,11 +239,11 @@ Vector LimbPath::GetProgressPos()
 
     // Add all the segments before the current one
 	deque<Vector>::const_iterator itr;
-    for (itr = m_Segments.begin(); itr != m_CurrentSegment; ++itr)
+    for (itr = m_Segments.Get().begin(); itr != m_CurrentSegment; ++itr)
         returnVec += (*itr) * m_Rotation;
 
     // Add any from the progress made on the current one
-    if (itr != m_Segments.end())
+    if (itr != m_Segments.Get().end())
         returnVec += ((*(m_CurrentSegment)) * m_SegProgress) * m_Rotation;
 
     return returnVec;
@@ -272,10 +263,10 @@ Vector LimbPath::GetCurrentSegTarget()
     Vector returnVec(m_JointPos.GetFloored() + m_Start * m_Rotation);
 	deque<Vector>::const_iterator itr;
 
-    for (itr = m_Segments.begin(); itr != m_CurrentSegment; ++itr)
+    for (itr = m_Segments.Get().begin(); itr != m_CurrentSegment; ++itr)
         returnVec += (*itr) * m_Rotation;
 
-    if (itr != m_Segments.end())
+    if (itr != m_Segments.Get().end())
         returnVec += *(m_CurrentSegment) * m_Rotation;
 
     return returnVec;
@@ -380,7 +371,7 @@ void LimbPath::ReportProgress(const Vector &limbPos)
 // TODO: Don't hardcode this!")
         if (distance < 1.5)
         {
-            if (++(m_CurrentSegment) == m_Segments.end())
+            if (++(m_CurrentSegment) == m_Segments.Get().end())
             {
                 --(m_CurrentSegment);
                 // Get normalized progress measure toward the target.
@@ -423,7 +414,7 @@ float LimbPath::GetTotalProgress()
         return 0.0;
 
     float prog = 0;
-    for (deque<Vector>::const_iterator itr = m_Segments.begin(); itr != m_CurrentSegment; ++itr)
+    for (deque<Vector>::const_iterator itr = m_Segments.Get().begin(); itr != m_CurrentSegment; ++itr)
         prog += itr->GetMagnitude();
 
     prog += (*(m_CurrentSegment)).GetMagnitude() * m_SegProgress;
@@ -445,7 +436,7 @@ float LimbPath::GetRegularProgress()
         return 0.0;
 
     float prog = m_RegularLength - m_TotalLength;
-    for (deque<Vector>::const_iterator itr = m_Segments.begin(); itr != m_CurrentSegment; ++itr)
+    for (deque<Vector>::const_iterator itr = m_Segments.Get().begin(); itr != m_CurrentSegment; ++itr)
         prog += itr->GetMagnitude();
     prog += (*(m_CurrentSegment)).GetMagnitude() * m_SegProgress;
 
@@ -493,7 +484,7 @@ void LimbPath::Terminate()
         m_Ended = true;
     }
     else {
-        m_CurrentSegment = --(m_Segments.end());
+        m_CurrentSegment = --(m_Segments.Get().end());
         m_SegProgress = 1.0;
         m_Ended = true;
     }
@@ -508,7 +499,7 @@ void LimbPath::Terminate()
 
 void LimbPath::Restart()
 {
-    m_CurrentSegment = m_Segments.begin();
+    m_CurrentSegment = m_Segments.Get().begin();
     m_PathTimer.Reset();
     m_SegTimer.Reset();
     m_SegProgress = 0;
@@ -530,7 +521,7 @@ void LimbPath::Restart()
 
 bool LimbPath::RestartFree(Vector &limbPos, MOID MOIDToIgnore, int ignoreTeam)
 {
-    deque<Vector>::iterator prevSeg = m_CurrentSegment;
+    deque<Vector>::const_iterator prevSeg = m_CurrentSegment;
     float prevProg = m_SegProgress;
     m_SegProgress = 0;
     bool found = false;
@@ -558,7 +549,7 @@ bool LimbPath::RestartFree(Vector &limbPos, MOID MOIDToIgnore, int ignoreTeam)
 		Vector notUsed;
 		
         // Start at the very beginning of the path
-        m_CurrentSegment = m_Segments.begin();
+        m_CurrentSegment = m_Segments.Get().begin();
 
         // Find the first start segment that has an obstacle on it
         int i = 0;
@@ -579,7 +570,7 @@ bool LimbPath::RestartFree(Vector &limbPos, MOID MOIDToIgnore, int ignoreTeam)
                 break;
             }
             // If obstacle was found on first pixel, report last segment as restarting pos, if there was a last segment
-            else if (result == 0 && m_CurrentSegment != m_Segments.begin())
+            else if (result == 0 && m_CurrentSegment != m_Segments.Get().begin())
             {
                 // Use last segment
                 --(m_CurrentSegment);
@@ -590,14 +581,14 @@ bool LimbPath::RestartFree(Vector &limbPos, MOID MOIDToIgnore, int ignoreTeam)
                 break;
             }
             // If obstacle was found on the first pixel of the first segment, then just report that we couldn't find any free space
-            else if (result == 0 && m_CurrentSegment == m_Segments.begin())
+            else if (result == 0 && m_CurrentSegment == m_Segments.Get().begin())
             {
                 found = false;
                 break;
             }
 
             // Check next segment, and quit if it's the end
-            if (++(m_CurrentSegment) == m_Segments.end())
+            if (++(m_CurrentSegment) == m_Segments.Get().end())
             {
                 found = false;
                 break;
@@ -605,7 +596,7 @@ bool LimbPath::RestartFree(Vector &limbPos, MOID MOIDToIgnore, int ignoreTeam)
         }
 
         // If we couldn't find any obstacles on the starting segments, then set it to the first non-starting seg and report success
-        if (!found && i == m_StartSegCount && m_CurrentSegment != m_Segments.end())
+        if (!found && i == m_StartSegCount && m_CurrentSegment != m_Segments.Get().end())
         {
             limbPos = GetProgressPos();
             m_SegProgress = 0;
@@ -643,7 +634,7 @@ void LimbPath::Draw(BITMAP *pTargetBitmap,
     acquire_bitmap(pTargetBitmap);
     Vector prevPoint = m_JointPos.GetFloored() + (m_Start * m_Rotation) - targetPos;
     Vector nextPoint = prevPoint;
-    for (deque<Vector>::const_iterator itr = m_Segments.begin(); itr != m_Segments.end(); ++itr)
+    for (deque<Vector>::const_iterator itr = m_Segments.Get().begin(); itr != m_Segments.Get().end(); ++itr)
     {
         nextPoint += (*itr) * m_Rotation;
         line(pTargetBitmap, prevPoint.m_X, prevPoint.m_Y, nextPoint.m_X, nextPoint.m_Y, color);
@@ -18,6 +18,7 @@
 #include "Vector.h"
 #include "ActivityMan.h"
 #include "Atom.h"
+#include "CopyOnWrite.h"
 
 namespace RTE
 {
@@ -159,7 +160,7 @@ ClassInfoGetters
 // Arguments:       None.
 // Return value:    An int with he count.
 
-    unsigned int GetSegCount() const { return m_Segments.size(); }
+    unsigned int GetSegCount() const { return m_Segments.Get().size(); }
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -519,7 +520,7 @@ ClassInfoGetters
 // Arguments:       None.
 // Return value:    A bool with the answer.
 
-    bool PathIsAtStart() const { return m_CurrentSegment == m_Segments.begin() && m_SegProgress == 0; }
+    bool PathIsAtStart() const { return m_CurrentSegment == m_Segments.Get().begin() && m_SegProgress == 0; }
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -573,7 +574,7 @@ ClassInfoGetters
 // Arguments:       None.
 // Return value:    Whether this has been Create:ed yet.
 
-    bool IsInitialized() { return !m_Start.IsZero() || !m_Segments.empty(); }
+    bool IsInitialized() { return !m_Start.IsZero() || !m_Segments.Get().empty(); }
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -585,7 +586,7 @@ ClassInfoGetters
 // Arguments:       None.
 // Return value:    None.
 
-    bool IsStaticPoint() { return m_Segments.empty(); }
+    bool IsStaticPoint() { return m_Segments.Get().empty(); }
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -616,11 +617,11 @@ protected:
     // yields a starting position that is clear of terrain is found.
     int m_StartSegCount;
 
-    // Array containing the actual 'waypoints' or segments for the path.
-    std::deque<Vector> m_Segments;
+    // Array containing the actual 'waypoints' or segments for the path. Shared with the preset this was cloned from until changed
+    CopyOnWrite<std::deque<Vector>> m_Segments;
 
     // The iterator to the segment of the path that the limb ended up on the end of
-	std::deque<Vector>::iterator m_CurrentSegment;
+	std::deque<Vector>::const_iterator m_CurrentSegment;
 
     // Normalized measure of how far the limb has progressed toward the
     // current segment's target. 0.0 means its farther away than the
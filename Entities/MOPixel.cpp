@@ -64,20 +64,17 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int MOPixel::ReadProperty(std::string propName, Reader &reader) {
-		if (propName == "Atom") {
-			if (!m_Atom) { m_Atom = new Atom; }
-			reader >> m_Atom;
-			m_Atom->SetOwner(this);
-		} else if (propName == "Color") {
-			reader >> m_Color;
-		} else if (propName == "MinLethalRange") {
-			reader >> m_MinLethalRange;
-		} else if (propName == "MaxLethalRange") {
-			reader >> m_MaxLethalRange;
-		} else {
-			return MovableObject::ReadProperty(propName, reader);
-		}
-		return 0;
+		static const PropertyReaderMap<MOPixel> propertyReaders = {
+			{ { "Atom" }, [](MOPixel &moPixel, Reader &reader) {
+				if (!moPixel.m_Atom) { moPixel.m_Atom = new Atom; }
+				reader >> moPixel.m_Atom;
+				moPixel.m_Atom->SetOwner(&moPixel);
+			} },
+			{ { "Color" }, [](MOPixel &moPixel, Reader &reader) { reader >> moPixel.m_Color; } },
+			{ { "MinLethalRange" }, [](MOPixel &moPixel, Reader &reader) { reader >> moPixel.m_MinLethalRange; } },
+			{ { "MaxLethalRange" }, [](MOPixel &moPixel, Reader &reader) { reader >> moPixel.m_MaxLethalRange; } }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : MovableObject::ReadProperty(propName, reader);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -37,14 +37,14 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int MOSParticle::ReadProperty(std::string propName, Reader &reader) {
-		if (propName == "Atom") {
-			if (!m_Atom) { m_Atom = new Atom; }
-			reader >> *m_Atom;
-			m_Atom->SetOwner(this);
-		} else {
-			return MOSprite::ReadProperty(propName, reader);
-		}
-		return 0;
+		static const PropertyReaderMap<MOSParticle> propertyReaders = {
+			{ { "Atom" }, [](MOSParticle &mosParticle, Reader &reader) {
+				if (!mosParticle.m_Atom) { mosParticle.m_Atom = new Atom; }
+				reader >> *mosParticle.m_Atom;
+				mosParticle.m_Atom->SetOwner(&mosParticle);
+			} }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : MOSprite::ReadProperty(propName, reader);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
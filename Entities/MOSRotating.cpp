@@ -63,7 +63,7 @@ void MOSRotating::Clear()
     m_Wounds.clear();
     m_Attachables.clear();
     m_AllAttachables.clear();
-    m_Gibs.clear();
+    m_Gibs.Reset();
     m_GibImpulseLimit = 0;
     m_GibWoundLimit = 0;
     m_GibSound.Reset();
@@ -256,11 +256,8 @@ int MOSRotating::Create(const MOSRotating &reference)
         pAttachable = 0;
     }
 
-	// Gib copies
-    for (list<Gib>::const_iterator gItr = reference.m_Gibs.begin(); gItr != reference.m_Gibs.end(); ++gItr)
-    {
-        m_Gibs.push_back(*gItr);
-    }
+	// Gibs are shared with the reference until either changes them
+    m_Gibs = reference.m_Gibs;
 
     m_StringValueMap = reference.m_StringValueMap;
     m_NumberValueMap = reference.m_NumberValueMap;
@@ -300,59 +297,46 @@ int MOSRotating::Create(const MOSRotating &reference)
 
 int MOSRotating::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "AtomGroup")
-    {
-        delete m_pAtomGroup;
-        m_pAtomGroup = new AtomGroup();
-        reader >> *m_pAtomGroup;
-    }
-    else if (propName == "DeepGroup")
-    {
-        delete m_pDeepGroup;
-        m_pDeepGroup = new AtomGroup();
-        reader >> *m_pDeepGroup;
-    }
-    else if (propName == "DeepCheck")
-        reader >> m_DeepCheck;
-    else if (propName == "OrientToVel")
-        reader >> m_OrientToVel;
-    else if (propName == "AddEmitter")
-    {
-        AEmitter *pEmitter = new AEmitter;
-        reader >> pEmitter;
-		m_Attachables.push_back(pEmitter);
-    }
-    else if (propName == "AddAttachable")
-    {
-        Attachable *pAttachable = new Attachable;
-        reader >> pAttachable;
-        m_Attachables.push_back(pAttachable);
-    }
-    else if (propName == "AddGib")
-    {
-        Gib gib;
-        reader >> gib;
-        m_Gibs.push_back(gib);
-    }
-    else if (propName == "GibImpulseLimit")
-        reader >> m_GibImpulseLimit;
-    else if (propName == "GibWoundLimit" || propName == "WoundLimit")
-        reader >> m_GibWoundLimit;
-    else if (propName == "GibSound")
-        reader >> m_GibSound;
-    else if (propName == "EffectOnGib")
-        reader >> m_EffectOnGib;
-    else if (propName == "LoudnessOnGib")
-        reader >> m_LoudnessOnGib;
-	else if (propName == "DamageMultiplier") {
-		reader >> m_DamageMultiplier;
-		m_DamageMultiplierRedefined = true;
-    } else if (propName == "AddCustomValue") {
-        ReadCustomValueProperty(reader);
-    } else
-        return MOSprite::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<MOSRotating> propertyReaders = {
+        { { "AtomGroup" }, [](MOSRotating &mosRotating, Reader &reader) {
+            delete mosRotating.m_pAtomGroup;
+            mosRotating.m_pAtomGroup = new AtomGroup();
+            reader >> *mosRotating.m_pAtomGroup;
+        } },
+        { { "DeepGroup" }, [](MOSRotating &mosRotating, Reader &reader) {
+            delete mosRotating.m_pDeepGroup;
+            mosRotating.m_pDeepGroup = new AtomGroup();
+            reader >> *mosRotating.m_pDeepGroup;
+        } },
+        { { "DeepCheck" }, [](MOSRotating &mosRotating, Reader &reader) { reader >> mosRotating.m_DeepCheck; } },
+        { { "OrientToVel" }, [](MOSRotating &mosRotating, Reader &reader) { reader >> mosRotating.m_OrientToVel; } },
+        { { "AddEmitter" }, [](MOSRotating &mosRotating, Reader &reader) {
+            AEmitter *pEmitter = new AEmitter;
+            reader >> pEmitter;
+            mosRotating.m_Attachables.push_back(pEmitter);
+        } },
+        { { "AddAttachable" }, [](MOSRotating &mosRotating, Reader &reader) {
+            Attachable *pAttachable = new Attachable;
+            reader >> pAttachable;
+            mosRotating.m_Attachables.push_back(pAttachable);
+        } },
+        { { "AddGib" }, [](MOSRotating &mosRotating, Reader &reader) {
+            Gib gib;
+            reader >> gib;
+            mosRotating.m_Gibs.GetForWriting().push_back(gib);
+        } },
+        { { "GibImpulseLimit" }, [](MOSRotating &mosRotating, Reader &reader) { reader >> mosRotating.m_GibImpulseLimit; } },
+        { { "GibWoundLimit", "WoundLimit" }, [](MOSRotating &mosRotating, Reader &reader) { reader >> mosRotating.m_GibWoundLimit; } },
+        { { "GibSound" }, [](MOSRotating &mosRotating, Reader &reader) { reader >> mosRotating.m_GibSound; } },
+        { { "EffectOnGib" }, [](MOSRotating &mosRotating, Reader &reader) { reader >> mosRotating.m_EffectOnGib; } },
+        { { "LoudnessOnGib" }, [](MOSRotating &mosRotating, Reader &reader) { reader >> mosRotating.m_LoudnessOnGib; } },
+        { { "DamageMultiplier" }, [](MOSRotating &mosRotating, Reader &reader) {
+            reader >> mosRotating.m_DamageMultiplier;
+            mosRotating.m_DamageMultiplierRedefined = true;
+        } },
+        { { "AddCustomValue" }, [](MOSRotating &mosRotating, Reader &reader) { mosRotating.ReadCustomValueProperty(reader); } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : MOSprite::ReadProperty(propName, reader);
 }
 
 void MOSRotating::ReadCustomValueProperty(Reader &reader) {
@@ -408,7 +392,7 @@ int MOSRotating::Save(Writer &writer) const
         writer << (*aItr);
     }
 */
-    for (list<Gib>::const_iterator gItr = m_Gibs.begin(); gItr != m_Gibs.end(); ++gItr)
+    for (list<Gib>::const_iterator gItr = m_Gibs.Get().begin(); gItr != m_Gibs.Get().end(); ++gItr)
     {
         writer.NewProperty("AddGib");
         writer << (*gItr);
@@ -920,7 +904,7 @@ void MOSRotating::GibThis(Vector impactImpulse, float internalBlast, MovableObje
     MovableObject *pGib = 0;
     float velMin, velRange, spread, angularVel;
     Vector gibROffset, gibVel;
-    for (list<Gib>::iterator gItr = m_Gibs.begin(); gItr != m_Gibs.end(); ++gItr)
+    for (list<Gib>::const_iterator gItr = m_Gibs.Get().begin(); gItr != m_Gibs.Get().end(); ++gItr)
     {
 		// Throwing out gibs
         for (int i = 0; i < (*gItr).GetCount(); ++i)
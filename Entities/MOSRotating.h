@@ -16,6 +16,7 @@
 
 #include "MOSprite.h"
 #include "Gib.h"
+#include "CopyOnWrite.h"
 #include "PostProcessMan.h"
 #include "SoundContainer.h"
 
@@ -205,10 +206,11 @@ ClassInfoGetters
 // Method:          GetGibList
 //////////////////////////////////////////////////////////////////////////////////////////
 // Description:     Gets direct access to the list of object this is to generate upon gibbing.
+//                  This gets its own copy of the list first if it's shared with its preset.
 // Arguments:       None.
 // Return value:    A pointer to the list of gibs. Ownership is NOT transferred!
 
-    std::list<Gib> * GetGibList() { return &m_Gibs; }
+    std::list<Gib> * GetGibList() { return &m_Gibs.GetForWriting(); }
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -390,6 +392,17 @@ ClassInfoGetters
 	void DetachOrDestroyAll(bool destroy);
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetAllAttachables
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the list of all Attachables of this MOSRotating, including both
+//                  hardcoded ones and those added through ini or lua.
+// Arguments:       None.
+// Return value:    The list of all Attachables. Ownership is NOT transferred!
+
+	const std::list<Attachable *> & GetAllAttachables() const { return m_AllAttachables; }
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual method:  ResetAllTimers
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -819,8 +832,8 @@ protected:
     std::list<Attachable *> m_Attachables;
     // The list of all Attachables, including both hardcoded attachables and those added through ini or lua
     std::list<Attachable *> m_AllAttachables;
-    // The list of Gib:s this will create when gibbed
-    std::list<Gib> m_Gibs;
+    // The list of Gib:s this will create when gibbed. Shared with the preset this was cloned from until changed
+    CopyOnWrite<std::list<Gib>> m_Gibs;
     // The amount of impulse force required to gib this, in kg * (m/s). 0 means no limit
     float m_GibImpulseLimit;
     // The number of wound emitters allowed before this gets gibbed. 0 means this can't get gibbed
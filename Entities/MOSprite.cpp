@@ -172,50 +172,24 @@ int MOSprite::Create(const MOSprite &reference)
 
 int MOSprite::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "SpriteFile")
-        reader >> m_SpriteFile;
-    else if (propName == "FrameCount")
-        reader >> m_FrameCount;
-    else if (propName == "SpriteOffset")
-        reader >> m_SpriteOffset;
-    else if (propName == "SpriteAnimMode")
-    {
-//        string mode;
-//        reader >> mode;
-        int mode;
-        reader >> mode;
-        m_SpriteAnimMode = (SpriteAnimMode)mode;
-/*
-        if (mode == "NOANIM")
-            m_SpriteAnimMode = NOANIM;
-        else if (mode == "ALWAYSLOOP")
-            m_SpriteAnimMode = ALWAYSLOOP;
-        else if (mode == "ALWAYSPINGPONG")
-            m_SpriteAnimMode = ALWAYSPINGPONG;
-        else if (mode == "LOOPWHENMOVING")
-            m_SpriteAnimMode = LOOPWHENMOVING;
-        else
-            Abort
-*/
-    }
-    else if (propName == "SpriteAnimDuration")
-        reader >> m_SpriteAnimDuration;
-    else if (propName == "HFlipped")
-        reader >> m_HFlipped;
-    else if (propName == "Rotation")
-        reader >> m_Rotation;
-    else if (propName == "AngularVel")
-        reader >> m_AngularVel;
-    else if (propName == "SettleMaterialDisabled")
-        reader >> m_SettleMaterialDisabled;
-    else if (propName == "EntryWound")
-        m_pEntryWound = dynamic_cast<const AEmitter *>(g_PresetMan.GetEntityPreset(reader));
-    else if (propName == "ExitWound")
-        m_pExitWound = dynamic_cast<const AEmitter *>(g_PresetMan.GetEntityPreset(reader));
-    else
-        return MovableObject::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<MOSprite> propertyReaders = {
+        { { "SpriteFile" }, [](MOSprite &moSprite, Reader &reader) { reader >> moSprite.m_SpriteFile; } },
+        { { "FrameCount" }, [](MOSprite &moSprite, Reader &reader) { reader >> moSprite.m_FrameCount; } },
+        { { "SpriteOffset" }, [](MOSprite &moSprite, Reader &reader) { reader >> moSprite.m_SpriteOffset; } },
+        { { "SpriteAnimMode" }, [](MOSprite &moSprite, Reader &reader) {
+            int mode;
+            reader >> mode;
+            moSprite.m_SpriteAnimMode = (SpriteAnimMode)mode;
+        } },
+        { { "SpriteAnimDuration" }, [](MOSprite &moSprite, Reader &reader) { reader >> moSprite.m_SpriteAnimDuration; } },
+        { { "HFlipped" }, [](MOSprite &moSprite, Reader &reader) { reader >> moSprite.m_HFlipped; } },
+        { { "Rotation" }, [](MOSprite &moSprite, Reader &reader) { reader >> moSprite.m_Rotation; } },
+        { { "AngularVel" }, [](MOSprite &moSprite, Reader &reader) { reader >> moSprite.m_AngularVel; } },
+        { { "SettleMaterialDisabled" }, [](MOSprite &moSprite, Reader &reader) { reader >> moSprite.m_SettleMaterialDisabled; } },
+        { { "EntryWound" }, [](MOSprite &moSprite, Reader &reader) { moSprite.m_pEntryWound = dynamic_cast<const AEmitter *>(g_PresetMan.GetEntityPreset(reader)); } },
+        { { "ExitWound" }, [](MOSprite &moSprite, Reader &reader) { moSprite.m_pExitWound = dynamic_cast<const AEmitter *>(g_PresetMan.GetEntityPreset(reader)); } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : MovableObject::ReadProperty(propName, reader);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -194,6 +194,18 @@ public:
     BITMAP * GetSpriteFrame(int whichFrame = 0) const { return (whichFrame >= 0 && whichFrame < m_FrameCount) ? m_aSprite[whichFrame] : 0; }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          SetSpriteFrame
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Replaces a frame of this MOSprite's BITMAP array, e.g. with a copy of
+//                  it that can be drawn into without changing the loaded one.
+// Arguments:       Which frame to replace, and the BITMAP to replace it with. It should be
+//                  the same size as the frame it replaces. Ownership is NOT transferred!
+// Return value:    None.
+
+    void SetSpriteFrame(int whichFrame, BITMAP *newFrame) { if (whichFrame >= 0 && whichFrame < m_FrameCount) { m_aSprite[whichFrame] = newFrame; } }
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          GetSpriteWidth
 //////////////////////////////////////////////////////////////////////////////////////////
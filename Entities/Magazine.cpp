@@ -111,25 +111,18 @@ int Magazine::Create(const Magazine &reference)
 
 int Magazine::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "RoundCount")
-    {
-        reader >> m_RoundCount;
-        m_FullCapacity = m_RoundCount;
-    }
-    else if (propName == "RTTRatio")
-        reader >> m_RTTRatio;
-    else if (propName == "RegularRound")
-        m_pRegularRound = dynamic_cast<const Round *>(g_PresetMan.GetEntityPreset(reader));
-    else if (propName == "TracerRound")
-        m_pTracerRound = dynamic_cast<const Round *>(g_PresetMan.GetEntityPreset(reader));
-    else if (propName == "Discardable")
-        reader >> m_Discardable;
-    else if (propName == "AIBlastRadius")
-        reader >> m_AIBlastRadius;
-    else
-        return Attachable::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<Magazine> propertyReaders = {
+        { { "RoundCount" }, [](Magazine &magazine, Reader &reader) {
+            reader >> magazine.m_RoundCount;
+            magazine.m_FullCapacity = magazine.m_RoundCount;
+        } },
+        { { "RTTRatio" }, [](Magazine &magazine, Reader &reader) { reader >> magazine.m_RTTRatio; } },
+        { { "RegularRound" }, [](Magazine &magazine, Reader &reader) { magazine.m_pRegularRound = dynamic_cast<const Round *>(g_PresetMan.GetEntityPreset(reader)); } },
+        { { "TracerRound" }, [](Magazine &magazine, Reader &reader) { magazine.m_pTracerRound = dynamic_cast<const Round *>(g_PresetMan.GetEntityPreset(reader)); } },
+        { { "Discardable" }, [](Magazine &magazine, Reader &reader) { reader >> magazine.m_Discardable; } },
+        { { "AIBlastRadius" }, [](Magazine &magazine, Reader &reader) { reader >> magazine.m_AIBlastRadius; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Attachable::ReadProperty(propName, reader);
 }
 
 
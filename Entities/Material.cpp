@@ -55,48 +55,39 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int Material::ReadProperty(std::string propName, Reader &reader) {
-		if (propName == "Index") {
-			// TODO: Check for index collisions here
-			reader >> m_Index;	
-		} else if (propName == "Priority") {
-			reader >> m_Priority;
-		} else if (propName == "Integrity" || propName == "StructuralIntegrity") {
-			reader >> m_Integrity;
-		} else if (propName == "Restitution" || propName == "Bounce") {
-			reader >> m_Restitution;
-		} else if (propName == "Friction") {
-			reader >> m_Friction;
-		} else if (propName == "Stickiness") {
-			reader >> m_Stickiness;
-		} else if (propName == "DensityKGPerVolumeL") {
-			reader >> m_VolumeDensity;
-			// Overrides the pixel density
-			m_PixelDensity = m_VolumeDensity * c_LPP;
-		} else if (propName == "DensityKGPerPixel") {
-			reader >> m_PixelDensity;
-			// Overrides the volume density
-			m_VolumeDensity = m_PixelDensity * c_PPL;
-		} else if (propName == "GibImpulseLimitPerVolumeL") {
-			reader >> m_GibImpulseLimitPerLiter;
-		} else if (propName == "GibWoundLimitPerVolumeL") {
-			reader >> m_GibWoundLimitPerLiter;
-		} else if (propName == "SettleMaterial") {
-			reader >> m_SettleMaterialIndex;
-		} else if (propName == "SpawnMaterial" || propName == "TransformsInto") {
-			reader >> m_SpawnMaterialIndex;
-		} else if (propName == "IsScrap") {
-			reader >> m_IsScrap;
-		} else if (propName == "Color") {
-			reader >> m_Color;
-		} else if (propName == "UseOwnColor") {
-			reader >> m_UseOwnColor;
-		} else if (propName == "TextureFile") {
-			reader >> m_TextureFile;
-			m_TerrainTexture = m_TextureFile.GetAsBitmap();
-		} else {
-			return Entity::ReadProperty(propName, reader);
-		}
-		return 0;
+		static const PropertyReaderMap<Material> propertyReaders = {
+			{ { "Index" }, [](Material &material, Reader &reader) {
+				// TODO: Check for index collisions here
+				reader >> material.m_Index;
+			} },
+			{ { "Priority" }, [](Material &material, Reader &reader) { reader >> material.m_Priority; } },
+			{ { "Integrity", "StructuralIntegrity" }, [](Material &material, Reader &reader) { reader >> material.m_Integrity; } },
+			{ { "Restitution", "Bounce" }, [](Material &material, Reader &reader) { reader >> material.m_Restitution; } },
+			{ { "Friction" }, [](Material &material, Reader &reader) { reader >> material.m_Friction; } },
+			{ { "Stickiness" }, [](Material &material, Reader &reader) { reader >> material.m_Stickiness; } },
+			{ { "DensityKGPerVolumeL" }, [](Material &material, Reader &reader) {
+				reader >> material.m_VolumeDensity;
+				// Overrides the pixel density
+				material.m_PixelDensity = material.m_VolumeDensity * c_LPP;
+			} },
+			{ { "DensityKGPerPixel" }, [](Material &material, Reader &reader) {
+				reader >> material.m_PixelDensity;
+				// Overrides the volume density
+				material.m_VolumeDensity = material.m_PixelDensity * c_PPL;
+			} },
+			{ { "GibImpulseLimitPerVolumeL" }, [](Material &material, Reader &reader) { reader >> material.m_GibImpulseLimitPerLiter; } },
+			{ { "GibWoundLimitPerVolumeL" }, [](Material &material, Reader &reader) { reader >> material.m_GibWoundLimitPerLiter; } },
+			{ { "SettleMaterial" }, [](Material &material, Reader &reader) { reader >> material.m_SettleMaterialIndex; } },
+			{ { "SpawnMaterial", "TransformsInto" }, [](Material &material, Reader &reader) { reader >> material.m_SpawnMaterialIndex; } },
+			{ { "IsScrap" }, [](Material &material, Reader &reader) { reader >> material.m_IsScrap; } },
+			{ { "Color" }, [](Material &material, Reader &reader) { reader >> material.m_Color; } },
+			{ { "UseOwnColor" }, [](Material &material, Reader &reader) { reader >> material.m_UseOwnColor; } },
+			{ { "TextureFile" }, [](Material &material, Reader &reader) {
+				reader >> material.m_TextureFile;
+				material.m_TerrainTexture = material.m_TextureFile.GetAsBitmap();
+			} }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : Entity::ReadProperty(propName, reader);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -265,119 +265,83 @@ int MovableObject::Create(const MovableObject &reference)
 
 int MovableObject::ReadProperty(std::string propName, Reader &reader)
 {
-	if (propName == "Mass")
-	{
-		reader >> m_Mass;
-		if (m_Mass == 0)
-			m_Mass = 0.0001;
-	}
-	else if (propName == "Velocity")
-		reader >> m_Vel;
-	else if (propName == "Scale")
-		reader >> m_Scale;
-	else if (propName == "GlobalAccScalar")
-		reader >> m_GlobalAccScalar;
-	else if (propName == "AirResistance")
-	{
-		reader >> m_AirResistance;
-		// Backwards compatibility after we made this value scaled over time
-		m_AirResistance /= 0.01666;
-	}
-	else if (propName == "AirThreshold")
-		reader >> m_AirThreshold;
-	else if (propName == "PinStrength")
-		reader >> m_PinStrength;
-	else if (propName == "RestThreshold")
-		reader >> m_RestThreshold;
-	else if (propName == "LifeTime")
-		reader >> m_Lifetime;
-	else if (propName == "Sharpness")
-		reader >> m_Sharpness;
-	else if (propName == "HitsMOs")
-		reader >> m_HitsMOs;
-	else if (propName == "GetsHitByMOs")
-		reader >> m_GetsHitByMOs;
-	else if (propName == "IgnoresTeamHits")
-		reader >> m_IgnoresTeamHits;
-	else if (propName == "IgnoresAtomGroupHits")
-		reader >> m_IgnoresAtomGroupHits;
-	else if (propName == "IgnoresAGHitsWhenSlowerThan")
-		reader >> m_IgnoresAGHitsWhenSlowerThan;
-	else if (propName == "RemoveOrphanTerrainRadius")
-	{
-		reader >> m_RemoveOrphanTerrainRadius;
-		if (m_RemoveOrphanTerrainRadius > MAXORPHANRADIUS)
-			m_RemoveOrphanTerrainRadius = MAXORPHANRADIUS;
-	}
-	else if (propName == "RemoveOrphanTerrainMaxArea")
-	{
-		reader >> m_RemoveOrphanTerrainMaxArea;
-		if (m_RemoveOrphanTerrainMaxArea > MAXORPHANRADIUS * MAXORPHANRADIUS)
-			m_RemoveOrphanTerrainMaxArea = MAXORPHANRADIUS * MAXORPHANRADIUS;
-	}
-	else if (propName == "RemoveOrphanTerrainRate")
-		reader >> m_RemoveOrphanTerrainRate;
-	else if (propName == "MissionCritical")
-		reader >> m_MissionCritical;
-	else if (propName == "CanBeSquished")
-		reader >> m_CanBeSquished;
-	else if (propName == "HUDVisible")
-		reader >> m_HUDVisible;
-	else if (propName == "ProvidesPieMenuContext")
-		reader >> m_ProvidesPieMenuContext;
-	else if (propName == "AddPieSlice")
-	{
-		PieMenuGUI::Slice newSlice;
-		reader >> newSlice;
-		PieMenuGUI::AddAvailableSlice(newSlice);
-	}
-	else if (propName == "ScriptPath") {
-		std::string scriptPath = reader.ReadPropValue();
-		CorrectBackslashesInPaths(scriptPath);
-		if (LoadScript(scriptPath) == -2) { reader.ReportError("Duplicate script path " + scriptPath); }
-	} else if (propName == "ScreenEffect") {
-        reader >> m_ScreenEffectFile;
-        m_pScreenEffect = m_ScreenEffectFile.GetAsBitmap();
-		m_ScreenEffectHash = m_ScreenEffectFile.GetHash();
-    }
-    else if (propName == "EffectStartTime")
-        reader >> m_EffectStartTime;
-	else if (propName == "EffectRotAngle")
-		reader >> m_EffectRotAngle;
-	else if (propName == "InheritEffectRotAngle")
-		reader >> m_InheritEffectRotAngle;
-	else if (propName == "RandomizeEffectRotAngle")
-		reader >> m_RandomizeEffectRotAngle;
-	else if (propName == "RandomizeEffectRotAngleEveryFrame")
-		reader >> m_RandomizeEffectRotAngleEveryFrame;
-	else if (propName == "EffectStopTime")
-        reader >> m_EffectStopTime;
-    else if (propName == "EffectStartStrength")
-    {
-        float strength;
-        reader >> strength;
-        m_EffectStartStrength = std::floor((float)255 * strength);
-    }
-    else if (propName == "EffectStopStrength")
-    {
-        float strength;
-        reader >> strength;
-        m_EffectStopStrength = std::floor((float)255 * strength);
-    }
-    else if (propName == "EffectAlwaysShows")
-        reader >> m_EffectAlwaysShows;
-	else if (propName == "DamageOnCollision")
-		reader >> m_DamageOnCollision;
-	else if (propName == "DamageOnPenetration")
-		reader >> m_DamageOnPenetration;
-	else if (propName == "WoundDamageMultiplier")
-		reader >> m_WoundDamageMultiplier;
-	else if (propName == "IgnoreTerrain")
-		reader >> m_IgnoreTerrain;
-	else
-        return SceneObject::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<MovableObject> propertyReaders = {
+        { { "Mass" }, [](MovableObject &movableObject, Reader &reader) {
+            reader >> movableObject.m_Mass;
+            if (movableObject.m_Mass == 0)
+                movableObject.m_Mass = 0.0001;
+        } },
+        { { "Velocity" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_Vel; } },
+        { { "Scale" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_Scale; } },
+        { { "GlobalAccScalar" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_GlobalAccScalar; } },
+        { { "AirResistance" }, [](MovableObject &movableObject, Reader &reader) {
+            reader >> movableObject.m_AirResistance;
+            // Backwards compatibility after we made this value scaled over time
+            movableObject.m_AirResistance /= 0.01666;
+        } },
+        { { "AirThreshold" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_AirThreshold; } },
+        { { "PinStrength" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_PinStrength; } },
+        { { "RestThreshold" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_RestThreshold; } },
+        { { "LifeTime" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_Lifetime; } },
+        { { "Sharpness" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_Sharpness; } },
+        { { "HitsMOs" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_HitsMOs; } },
+        { { "GetsHitByMOs" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_GetsHitByMOs; } },
+        { { "IgnoresTeamHits" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_IgnoresTeamHits; } },
+        { { "IgnoresAtomGroupHits" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_IgnoresAtomGroupHits; } },
+        { { "IgnoresAGHitsWhenSlowerThan" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_IgnoresAGHitsWhenSlowerThan; } },
+        { { "RemoveOrphanTerrainRadius" }, [](MovableObject &movableObject, Reader &reader) {
+            reader >> movableObject.m_RemoveOrphanTerrainRadius;
+            if (movableObject.m_RemoveOrphanTerrainRadius > MAXORPHANRADIUS)
+                movableObject.m_RemoveOrphanTerrainRadius = MAXORPHANRADIUS;
+        } },
+        { { "RemoveOrphanTerrainMaxArea" }, [](MovableObject &movableObject, Reader &reader) {
+            reader >> movableObject.m_RemoveOrphanTerrainMaxArea;
+            if (movableObject.m_RemoveOrphanTerrainMaxArea > MAXORPHANRADIUS * MAXORPHANRADIUS)
+                movableObject.m_RemoveOrphanTerrainMaxArea = MAXORPHANRADIUS * MAXORPHANRADIUS;
+        } },
+        { { "RemoveOrphanTerrainRate" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_RemoveOrphanTerrainRate; } },
+        { { "MissionCritical" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_MissionCritical; } },
+        { { "CanBeSquished" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_CanBeSquished; } },
+        { { "HUDVisible" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_HUDVisible; } },
+        { { "ProvidesPieMenuContext" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_ProvidesPieMenuContext; } },
+        { { "AddPieSlice" }, [](MovableObject &movableObject, Reader &reader) {
+            PieMenuGUI::Slice newSlice;
+            reader >> newSlice;
+            PieMenuGUI::AddAvailableSlice(newSlice);
+        } },
+        { { "ScriptPath" }, [](MovableObject &movableObject, Reader &reader) {
+            std::string scriptPath = reader.ReadPropValue();
+            movableObject.CorrectBackslashesInPaths(scriptPath);
+            if (movableObject.LoadScript(scriptPath) == -2) { reader.ReportError("Duplicate script path " + scriptPath); }
+        } },
+        { { "ScreenEffect" }, [](MovableObject &movableObject, Reader &reader) {
+            reader >> movableObject.m_ScreenEffectFile;
+            movableObject.m_pScreenEffect = movableObject.m_ScreenEffectFile.GetAsBitmap();
+            movableObject.m_ScreenEffectHash = movableObject.m_ScreenEffectFile.GetHash();
+        } },
+        { { "EffectStartTime" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_EffectStartTime; } },
+        { { "EffectRotAngle" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_EffectRotAngle; } },
+        { { "InheritEffectRotAngle" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_InheritEffectRotAngle; } },
+        { { "RandomizeEffectRotAngle" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_RandomizeEffectRotAngle; } },
+        { { "RandomizeEffectRotAngleEveryFrame" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_RandomizeEffectRotAngleEveryFrame; } },
+        { { "EffectStopTime" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_EffectStopTime; } },
+        { { "EffectStartStrength" }, [](MovableObject &movableObject, Reader &reader) {
+            float strength;
+            reader >> strength;
+            movableObject.m_EffectStartStrength = std::floor((float)255 * strength);
+        } },
+        { { "EffectStopStrength" }, [](MovableObject &movableObject, Reader &reader) {
+            float strength;
+            reader >> strength;
+            movableObject.m_EffectStopStrength = std::floor((float)255 * strength);
+        } },
+        { { "EffectAlwaysShows" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_EffectAlwaysShows; } },
+        { { "DamageOnCollision" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_DamageOnCollision; } },
+        { { "DamageOnPenetration" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_DamageOnPenetration; } },
+        { { "WoundDamageMultiplier" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_WoundDamageMultiplier; } },
+        { { "IgnoreTerrain" }, [](MovableObject &movableObject, Reader &reader) { reader >> movableObject.m_IgnoreTerrain; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : SceneObject::ReadProperty(propName, reader);
 }
 
 
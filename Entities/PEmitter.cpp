@@ -115,72 +115,47 @@ namespace RTE {
 	//                  is called. If the property isn't recognized by any of the base classes,
 	//                  false is returned, and the reader's position is untouched.
 
-	int PEmitter::ReadProperty(std::string propName, Reader &reader)
-	{
-		if (propName == "AddEmission")
-		{
-			Emission emission;
-			reader >> emission;
-			m_EmissionList.push_back(emission);
-		}
-		else if (propName == "EmissionSound")
-			reader >> m_EmissionSound;
-		else if (propName == "BurstSound")
-			reader >> m_BurstSound;
-		else if (propName == "EndSound")
-			reader >> m_EndSound;
-		else if (propName == "EmissionEnabled")
-			reader >> m_EmitEnabled;
-		else if (propName == "EmissionCount")
-			reader >> m_EmitCount;
-		else if (propName == "EmissionCountLimit")
-			reader >> m_EmitCountLimit;
-		else if (propName == "ParticlesPerMinute")
-		{
-			float ppm;
-			reader >> ppm;
-			// Go through all emissions and set the rate so that it emulates the way it used to work, for mod backwards compatibility
-			for (list<Emission>::iterator eItr = m_EmissionList.begin(); eItr != m_EmissionList.end(); ++eItr)
-				(*eItr).m_PPM = ppm / m_EmissionList.size();
-		}
-		else if (propName == "MinThrottleRange")
-			reader >> m_MinThrottleRange;
-		else if (propName == "MaxThrottleRange")
-			reader >> m_MaxThrottleRange;
-		else if (propName == "Throttle")
-			reader >> m_Throttle;
-		else if (propName == "EmissionsIgnoreThis")
-			reader >> m_EmissionsIgnoreThis;
-		else if (propName == "BurstSize")
-		{
-			int burstSize;
-			reader >> burstSize;
-			// Go through all emissions and set the rate so that it emulates the way it used to work, for mod backwards compatibility
-			for (list<Emission>::iterator eItr = m_EmissionList.begin(); eItr != m_EmissionList.end(); ++eItr)
-				(*eItr).m_BurstSize = std::ceil((float)burstSize / (float)m_EmissionList.size());
-		}
-		else if (propName == "BurstScale")
-			reader >> m_BurstScale;
-		else if (propName == "BurstSpacing")
-			reader >> m_BurstSpacing;
-		else if (propName == "BurstTriggered")
-			reader >> m_BurstTriggered;
-		else if (propName == "EmissionAngle")
-			reader >> m_EmitAngle;
-		else if (propName == "EmissionOffset")
-			reader >> m_EmissionOffset;
-		else if (propName == "FlashScale")
-			reader >> m_FlashScale;
-		else if (propName == "FlashOnlyOnBurst")
-			reader >> m_FlashOnlyOnBurst;
-		else if (propName == "LoudnessOnEmit")
-			reader >> m_LoudnessOnEmit;
-		else
-		{
-			return MOSParticle::ReadProperty(propName, reader);
-		}
-
-		return 0;
+	int PEmitter::ReadProperty(std::string propName, Reader &reader) {
+		static const PropertyReaderMap<PEmitter> propertyReaders = {
+			{ { "AddEmission" }, [](PEmitter &emitter, Reader &reader) {
+				Emission emission;
+				reader >> emission;
+				emitter.m_EmissionList.push_back(emission);
+			} },
+			{ { "EmissionSound" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_EmissionSound; } },
+			{ { "BurstSound" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_BurstSound; } },
+			{ { "EndSound" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_EndSound; } },
+			{ { "EmissionEnabled" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_EmitEnabled; } },
+			{ { "EmissionCount" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_EmitCount; } },
+			{ { "EmissionCountLimit" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_EmitCountLimit; } },
+			{ { "ParticlesPerMinute" }, [](PEmitter &emitter, Reader &reader) {
+				float ppm;
+				reader >> ppm;
+				// Go through all emissions and set the rate so that it emulates the way it used to work, for mod backwards compatibility
+				for (list<Emission>::iterator eItr = emitter.m_EmissionList.begin(); eItr != emitter.m_EmissionList.end(); ++eItr)
+					(*eItr).m_PPM = ppm / emitter.m_EmissionList.size();
+			} },
+			{ { "MinThrottleRange" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_MinThrottleRange; } },
+			{ { "MaxThrottleRange" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_MaxThrottleRange; } },
+			{ { "Throttle" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_Throttle; } },
+			{ { "EmissionsIgnoreThis" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_EmissionsIgnoreThis; } },
+			{ { "BurstSize" }, [](PEmitter &emitter, Reader &reader) {
+				int burstSize;
+				reader >> burstSize;
+				// Go through all emissions and set the rate so that it emulates the way it used to work, for mod backwards compatibility
+				for (list<Emission>::iterator eItr = emitter.m_EmissionList.begin(); eItr != emitter.m_EmissionList.end(); ++eItr)
+					(*eItr).m_BurstSize = std::ceil((float)burstSize / (float)emitter.m_EmissionList.size());
+			} },
+			{ { "BurstScale" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_BurstScale; } },
+			{ { "BurstSpacing" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_BurstSpacing; } },
+			{ { "BurstTriggered" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_BurstTriggered; } },
+			{ { "EmissionAngle" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_EmitAngle; } },
+			{ { "EmissionOffset" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_EmissionOffset; } },
+			{ { "FlashScale" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_FlashScale; } },
+			{ { "FlashOnlyOnBurst" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_FlashOnlyOnBurst; } },
+			{ { "LoudnessOnEmit" }, [](PEmitter &emitter, Reader &reader) { reader >> emitter.m_LoudnessOnEmit; } }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : MOSParticle::ReadProperty(propName, reader);
 	}
 
 
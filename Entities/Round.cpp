@@ -64,31 +64,22 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int Round::ReadProperty(std::string propName, Reader &reader) {
-		if (propName == "Particle") {
-			m_Particle = dynamic_cast<const MovableObject *>(g_PresetMan.GetEntityPreset(reader));
-			RTEAssert(m_Particle, "Stream suggests allocating an unallocable type in Round::Create!");
-		} else if (propName == "ParticleCount") {
-			reader >> m_ParticleCount;
-		} else if (propName == "FireVelocity") {
-			reader >> m_FireVel;
-		} else if (propName == "Separation") {
-			reader >> m_Separation;
-		} else if (propName == "Shell") {
-			m_Shell = dynamic_cast<const MovableObject *>(g_PresetMan.GetEntityPreset(reader));
-		} else if (propName == "ShellVelocity") {
-			reader >> m_ShellVel;
-		} else if (propName == "FireSound") {
-			reader >> m_FireSound;
-		} else if (propName == "AILifeTime") {
-			reader >> m_AILifeTime;
-		} else if (propName == "AIFireVel") {
-			reader >> m_AIFireVel;
-		} else if (propName == "AIPenetration") {
-			reader >> m_AIPenetration;
-		} else {
-			return Entity::ReadProperty(propName, reader);
-		}
-		return 0;
+		static const PropertyReaderMap<Round> propertyReaders = {
+			{ { "Particle" }, [](Round &round, Reader &reader) {
+				round.m_Particle = dynamic_cast<const MovableObject *>(g_PresetMan.GetEntityPreset(reader));
+				RTEAssert(round.m_Particle, "Stream suggests allocating an unallocable type in Round::Create!");
+			} },
+			{ { "ParticleCount" }, [](Round &round, Reader &reader) { reader >> round.m_ParticleCount; } },
+			{ { "FireVelocity" }, [](Round &round, Reader &reader) { reader >> round.m_FireVel; } },
+			{ { "Separation" }, [](Round &round, Reader &reader) { reader >> round.m_Separation; } },
+			{ { "Shell" }, [](Round &round, Reader &reader) { round.m_Shell = dynamic_cast<const MovableObject *>(g_PresetMan.GetEntityPreset(reader)); } },
+			{ { "ShellVelocity" }, [](Round &round, Reader &reader) { reader >> round.m_ShellVel; } },
+			{ { "FireSound" }, [](Round &round, Reader &reader) { reader >> round.m_FireSound; } },
+			{ { "AILifeTime" }, [](Round &round, Reader &reader) { reader >> round.m_AILifeTime; } },
+			{ { "AIFireVel" }, [](Round &round, Reader &reader) { reader >> round.m_AIFireVel; } },
+			{ { "AIPenetration" }, [](Round &round, Reader &reader) { reader >> round.m_AIPenetration; } }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : Entity::ReadProperty(propName, reader);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
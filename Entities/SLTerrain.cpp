@@ -1411,9 +1411,9 @@ void SLTerrain::Update()
 //////////////////////////////////////////////////////////////////////////////////////////
 // Description:     Draws this SLTerrain's current scrolled position to a bitmap.
 
-void SLTerrain::DrawBackground(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride)
+void SLTerrain::DrawBackground(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride, float renderScale)
 {
-    m_pBGColor->Draw(pTargetBitmap, targetBox, scrollOverride);
+    m_pBGColor->Draw(pTargetBitmap, targetBox, scrollOverride, renderScale);
 }
 
 
@@ -1422,15 +1422,15 @@ void SLTerrain::DrawBackground(BITMAP *pTargetBitmap, Box &targetBox, const Vect
 //////////////////////////////////////////////////////////////////////////////////////////
 // Description:     Draws this SLTerrain's current scrolled position to a bitmap.
 
-void SLTerrain::Draw(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride) const
+void SLTerrain::Draw(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride, float renderScale) const
 {
     if (m_DrawMaterial)
     {
-        SceneLayer::Draw(pTargetBitmap, targetBox, scrollOverride);
+        SceneLayer::Draw(pTargetBitmap, targetBox, scrollOverride, renderScale);
     }
     else
     {
-        m_pFGColor->Draw(pTargetBitmap, targetBox, scrollOverride);
+        m_pFGColor->Draw(pTargetBitmap, targetBox, scrollOverride, renderScale);
     }
 }
 
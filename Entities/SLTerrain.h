@@ -677,9 +677,10 @@ ClassInfoGetters
 //                  box being where the scroll position lines up.
 //                  If a non-{-1,-1} vector is passed, the internal scroll offset of this
 //                  is overridder with it. It becomes the new source coordinates.
+//                  The fraction of full resolution the target bitmap is drawn at.
 // Return value:    None.
 
-	void DrawBackground(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride = Vector(-1, -1));
+	void DrawBackground(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride = Vector(-1, -1), float renderScale = 1.0F);
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -691,9 +692,10 @@ ClassInfoGetters
 //                  box being where the scroll position lines up.
 //                  If a non-{-1,-1} vector is passed, the internal scroll offset of this
 //                  is overridder with it. It becomes the new source coordinates.
+//                  The fraction of full resolution the target bitmap is drawn at.
 // Return value:    None.
 
-	void Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride = Vector(-1, -1)) const override;
+	void Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride = Vector(-1, -1), float renderScale = 1.0F) const override;
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // Protected member variable and method declarations
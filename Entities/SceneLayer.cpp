@@ -586,7 +586,7 @@ struct SLDrawBox
 //////////////////////////////////////////////////////////////////////////////////////////
 // Description:     Draws this SceneLayer's current scrolled position to a bitmap.
 
-void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride) const
+void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrollOverride, float renderScale) const
 {
     RTEAssert(m_pMainBitmap, "Data of this SceneLayer has not been loaded before trying to draw!");
 
@@ -618,22 +618,23 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
         WrapPosition(offsetX, offsetY);
     }
 
+    // Everything below is worked out for the full size view, and only scaled down onto the target bitmap as it's drawn
+    int viewWidth = GetRenderScaledViewSize(pTargetBitmap->w, renderScale);
+    int viewHeight = GetRenderScaledViewSize(pTargetBitmap->h, renderScale);
+
     // Make target box valid size if it's empty
     if (targetBox.IsEmpty())
     {
         targetBox.SetCorner(Vector(0, 0));
-        targetBox.SetWidth(pTargetBitmap->w);
-        targetBox.SetHeight(pTargetBitmap->h);
+        targetBox.SetWidth(viewWidth);
+        targetBox.SetHeight(viewHeight);
     }
 
     // Set the clipping rectangle of the target bitmap to match the specified target box
-    set_clip_rect(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth() - 1, targetBox.GetCorner().m_Y + targetBox.GetHeight() - 1);
-
-    // Choose the correct blitting function based on transparency setting
-    void (*pfBlit)(BITMAP *source, BITMAP *dest, int source_x, int source_y, int dest_x, int dest_y, int width, int height) = m_DrawTrans ? &masked_blit : &blit;
+    SetRenderScaledClipRect(pTargetBitmap, targetBox, renderScale);
 
     // See if this SceneLayer is wider AND higher than the target bitmap; then use simple wrapping logic - oterhwise need to tile
-    if (m_pMainBitmap->w >= pTargetBitmap->w && m_pMainBitmap->h >= pTargetBitmap->h)
+    if (m_pMainBitmap->w >= viewWidth && m_pMainBitmap->h >= viewHeight)
     {
         sourceX     = offsetX;
         sourceY     = offsetY;
@@ -641,7 +642,7 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
         sourceH     = m_pMainBitmap->h - offsetY;
         destX       = targetBox.GetCorner().m_X;
         destY       = targetBox.GetCorner().m_Y;
-        pfBlit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, destX, destY, sourceW, sourceH);
+        BlitRenderScaled(pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, sourceW, sourceH, renderScale);
 
         sourceX     = 0;
         sourceY     = offsetY;
@@ -649,7 +650,7 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
         sourceH     = m_pMainBitmap->h - offsetY;
         destX       = targetBox.GetCorner().m_X + m_pMainBitmap->w - offsetX;
         destY       = targetBox.GetCorner().m_Y;
-        pfBlit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, destX, destY, sourceW, sourceH);
+        BlitRenderScaled(pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, sourceW, sourceH, renderScale);
 
         sourceX     = offsetX;
         sourceY     = 0;
@@ -657,7 +658,7 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
         sourceH     = offsetY;
         destX       = targetBox.GetCorner().m_X;
         destY       = targetBox.GetCorner().m_Y + m_pMainBitmap->h - offsetY;
-        pfBlit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, destX, destY, sourceW, sourceH);
+        BlitRenderScaled(pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, sourceW, sourceH, renderScale);
 
         sourceX     = 0;
         sourceY     = 0;
@@ -665,7 +666,7 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
         sourceH     = offsetY;
         destX       = targetBox.GetCorner().m_X + m_pMainBitmap->w - offsetX;
         destY       = targetBox.GetCorner().m_Y + m_pMainBitmap->h - offsetY;
-        pfBlit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, destX, destY, sourceW, sourceH);
+        BlitRenderScaled(pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, sourceW, sourceH, renderScale);
     }
     // Target bitmap is larger in some dimension, so need to draw this tiled as many times as necessary to cover the whole target
     else
@@ -673,8 +674,8 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
         int tiledOffsetX = 0;
         int tiledOffsetY = 0;
         // Use the dimensions of the target box, if it has any area at all
-        int targetWidth = MIN(pTargetBitmap->w, targetBox.GetWidth());
-        int targetHeight = MIN(pTargetBitmap->h, targetBox.GetHeight());
+        int targetWidth = MIN(viewWidth, targetBox.GetWidth());
+        int targetHeight = MIN(viewHeight, targetBox.GetHeight());
         int toCoverX = offsetX + targetBox.GetCorner().m_X + targetWidth;
         int toCoverY = offsetY + targetBox.GetCorner().m_Y + targetHeight;
 
@@ -683,8 +684,8 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
         bool screenLargerThanSceneY = false;
         if (!scrollOverridden && g_SceneMan.GetSceneWidth() > 0)
         {
-            screenLargerThanSceneX = pTargetBitmap->w > g_SceneMan.GetSceneWidth();
-            screenLargerThanSceneY = pTargetBitmap->h > g_SceneMan.GetSceneHeight();
+            screenLargerThanSceneX = viewWidth > g_SceneMan.GetSceneWidth();
+            screenLargerThanSceneY = viewHeight > g_SceneMan.GetSceneHeight();
         }
 
         // Y tiling
@@ -698,9 +699,9 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
                 sourceW     = m_pMainBitmap->w;
                 sourceH     = m_pMainBitmap->h;
                 // If the unwrapped and untiled direction can't cover the target area, place it in the middle of the target bitmap, and leave the excess perimeter on each side untouched
-                destX       = (!m_WrapX && screenLargerThanSceneX) ? ((pTargetBitmap->w / 2) - (m_pMainBitmap->w / 2)) : (targetBox.GetCorner().m_X + tiledOffsetX - offsetX);
-                destY       = (!m_WrapY && screenLargerThanSceneY) ? ((pTargetBitmap->h / 2) - (m_pMainBitmap->h / 2)) : (targetBox.GetCorner().m_Y + tiledOffsetY - offsetY);
-                pfBlit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, destX, destY, sourceW, sourceH);
+                destX       = (!m_WrapX && screenLargerThanSceneX) ? ((viewWidth / 2) - (m_pMainBitmap->w / 2)) : (targetBox.GetCorner().m_X + tiledOffsetX - offsetX);
+                destY       = (!m_WrapY && screenLargerThanSceneY) ? ((viewHeight / 2) - (m_pMainBitmap->h / 2)) : (targetBox.GetCorner().m_Y + tiledOffsetY - offsetY);
+                BlitRenderScaled(pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, sourceW, sourceH, renderScale);
 
                 tiledOffsetX += m_pMainBitmap->w;
             }
@@ -717,17 +718,17 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
         if (!m_WrapX && !screenLargerThanSceneX && m_ScrollRatio.m_X < 0)
         {
             if (m_FillLeftColor != g_MaskColor && offsetX != 0)
-                rectfill(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X - offsetX, targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillLeftColor);
+                FillRenderScaled(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X - offsetX, targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillLeftColor, renderScale);
             if (m_FillRightColor != g_MaskColor)
-                rectfill(pTargetBitmap, (targetBox.GetCorner().m_X - offsetX) + m_pMainBitmap->w, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillRightColor);
+                FillRenderScaled(pTargetBitmap, (targetBox.GetCorner().m_X - offsetX) + m_pMainBitmap->w, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillRightColor, renderScale);
         }
 
         if (!m_WrapY && !screenLargerThanSceneY && m_ScrollRatio.m_Y < 0)
         {
             if (m_FillUpColor != g_MaskColor && offsetY != 0)
-                rectfill(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y - offsetY, m_FillUpColor);
+                FillRenderScaled(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y - offsetY, m_FillUpColor, renderScale);
             if (m_FillDownColor != g_MaskColor)
-                rectfill(pTargetBitmap, targetBox.GetCorner().m_X, (targetBox.GetCorner().m_Y - offsetY) + m_pMainBitmap->h, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillDownColor);
+                FillRenderScaled(pTargetBitmap, targetBox.GetCorner().m_X, (targetBox.GetCorner().m_Y - offsetY) + m_pMainBitmap->h, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillDownColor, renderScale);
         }
     }
 
@@ -742,11 +743,11 @@ void SceneLayer::Draw(BITMAP *pTargetBitmap, Box& targetBox, const Vector &scrol
 // Description:     Draws this SceneLayer's current scrolled position to a bitmap, but also
 //                  scaled according to what has been set with SetScaleFactor.
 
-void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride) const
+void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride, float renderScale) const
 {
     // If no scaling, use the regular scaling routine
     if (m_ScaleFactor.m_X == 1.0 && m_ScaleFactor.m_Y == 1.0)
-        return Draw(pTargetBitmap, targetBox, scrollOverride);
+        return Draw(pTargetBitmap, targetBox, scrollOverride, renderScale);
 
     RTEAssert(m_pMainBitmap, "Data of this SceneLayer has not been loaded before trying to draw!");
 
@@ -804,26 +805,26 @@ void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector
         WrapPosition(offsetX, offsetY);
     }
 
+    // Everything below is worked out for the full size view, and only scaled down onto the target bitmap as it's drawn
+    int viewWidth = GetRenderScaledViewSize(pTargetBitmap->w, renderScale);
+    int viewHeight = GetRenderScaledViewSize(pTargetBitmap->h, renderScale);
+
     // Make target box valid size if it's empty
     if (targetBox.IsEmpty())
     {
         targetBox.SetCorner(Vector(0, 0));
-        targetBox.SetWidth(pTargetBitmap->w);
-        targetBox.SetHeight(pTargetBitmap->h);
+        targetBox.SetWidth(viewWidth);
+        targetBox.SetHeight(viewHeight);
     }
 
     // Set the clipping rectangle of the target bitmap to match the specified target box
-    set_clip_rect(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth() - 1, targetBox.GetCorner().m_Y + targetBox.GetHeight() - 1);
-
-    // Choose the correct blitting function based on transparency setting
-    void (*pfBlit)(BITMAP *source, BITMAP *dest, int source_x, int source_y, int source_w, int source_h, int dest_x, int dest_y, int dest_w, int dest_h) = m_DrawTrans ? &masked_stretch_blit : &stretch_blit;
-//    void (*pfBlit)(BITMAP *source, BITMAP *dest, int source_x, int source_y, int dest_x, int dest_y, int width, int height) = m_DrawTrans ? &masked_blit : &blit;
+    SetRenderScaledClipRect(pTargetBitmap, targetBox, renderScale);
 
     // Get a scaled offset for the source layer
     Vector sourceOffset(offsetX * m_ScaleInverse.m_X, offsetY * m_ScaleInverse.m_Y);
 
     // See if this SceneLayer is wider AND higher than the target bitmap when scaled; then use simple wrapping logic - oterhwise need to tile
-    if (m_ScaledDimensions.m_X >= pTargetBitmap->w && m_ScaledDimensions.m_Y >= pTargetBitmap->h)
+    if (m_ScaledDimensions.m_X >= viewWidth && m_ScaledDimensions.m_Y >= viewHeight)
     {
         // Upper left
         sourceX     = 0;
@@ -834,7 +835,7 @@ void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector
         destY       = targetBox.GetCorner().m_Y - offsetY;
         destW       = sourceW * m_ScaleFactor.m_X + 1;
         destH       = sourceH * m_ScaleFactor.m_Y + 1;
-        pfBlit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, destW, destH);
+        BlitRenderScaled(pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, destW, destH, renderScale);
 
         // Upper right
         sourceX     = 0;
@@ -845,7 +846,7 @@ void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector
         destY       = targetBox.GetCorner().m_Y - offsetY;
         destW       = sourceW * m_ScaleFactor.m_X + 1;
         destH       = sourceH * m_ScaleFactor.m_Y + 1;
-        pfBlit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, destW, destH);
+        BlitRenderScaled(pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, destW, destH, renderScale);
 
         // Lower left
         sourceX     = 0;
@@ -856,7 +857,7 @@ void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector
         destY       = targetBox.GetCorner().m_Y + m_ScaledDimensions.m_Y - offsetY;
         destW       = sourceW * m_ScaleFactor.m_X + 1;
         destH       = sourceH * m_ScaleFactor.m_Y + 1;
-        pfBlit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, destW, destH);
+        BlitRenderScaled(pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, destW, destH, renderScale);
 
         // Lower right
         sourceX     = 0;
@@ -867,7 +868,7 @@ void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector
         destY       = targetBox.GetCorner().m_Y + m_ScaledDimensions.m_Y - offsetY;
         destW       = sourceW * m_ScaleFactor.m_X + 1;
         destH       = sourceH * m_ScaleFactor.m_Y + 1;
-        pfBlit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, destW, destH);
+        BlitRenderScaled(pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, destW, destH, renderScale);
     }
     // Target bitmap is larger in some dimension, so need to draw this tiled as many times as necessary to cover the whole target
     else
@@ -875,8 +876,8 @@ void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector
         int tiledOffsetX = 0;
         int tiledOffsetY = 0;
         // Use the dimensions of the target box, if it has any area at all
-        int targetWidth = MIN(pTargetBitmap->w, targetBox.GetWidth());
-        int targetHeight = MIN(pTargetBitmap->h, targetBox.GetHeight());
+        int targetWidth = MIN(viewWidth, targetBox.GetWidth());
+        int targetHeight = MIN(viewHeight, targetBox.GetHeight());
         int toCoverX = offsetX + targetBox.GetCorner().m_X + targetWidth;
         int toCoverY = offsetY + targetBox.GetCorner().m_Y + targetHeight;
 
@@ -885,8 +886,8 @@ void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector
         bool screenLargerThanSceneY = false;
         if (!scrollOverridden && g_SceneMan.GetSceneWidth() > 0)
         {
-            screenLargerThanSceneX = pTargetBitmap->w > g_SceneMan.GetSceneWidth();
-            screenLargerThanSceneY = pTargetBitmap->h > g_SceneMan.GetSceneHeight();
+            screenLargerThanSceneX = viewWidth > g_SceneMan.GetSceneWidth();
+            screenLargerThanSceneY = viewHeight > g_SceneMan.GetSceneHeight();
         }
 
         // Y tiling
@@ -900,11 +901,11 @@ void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector
                 sourceW     = m_pMainBitmap->w;
                 sourceH     = m_pMainBitmap->h;
                 // If the unwrapped and untiled direction can't cover the target area, place it in the middle of the target bitmap, and leave the excess perimeter on each side untouched
-                destX       = (!m_WrapX && screenLargerThanSceneX) ? ((pTargetBitmap->w / 2) - (m_ScaledDimensions.m_X / 2)) : (targetBox.GetCorner().m_X + tiledOffsetX - offsetX);
-                destY       = (!m_WrapY && screenLargerThanSceneY) ? ((pTargetBitmap->h / 2) - (m_ScaledDimensions.m_Y / 2)) : (targetBox.GetCorner().m_Y + tiledOffsetY - offsetY);
+                destX       = (!m_WrapX && screenLargerThanSceneX) ? ((viewWidth / 2) - (m_ScaledDimensions.m_X / 2)) : (targetBox.GetCorner().m_X + tiledOffsetX - offsetX);
+                destY       = (!m_WrapY && screenLargerThanSceneY) ? ((viewHeight / 2) - (m_ScaledDimensions.m_Y / 2)) : (targetBox.GetCorner().m_Y + tiledOffsetY - offsetY);
                 destW       = m_ScaledDimensions.m_X;
                 destH       = m_ScaledDimensions.m_Y;
-                pfBlit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, destW, destH);
+                BlitRenderScaled(pTargetBitmap, sourceX, sourceY, sourceW, sourceH, destX, destY, destW, destH, renderScale);
 
                 tiledOffsetX += m_ScaledDimensions.m_X;
             }
@@ -922,17 +923,17 @@ void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector
         if (!m_WrapX && !screenLargerThanSceneX && m_ScrollRatio.m_X < 0)
         {
             if (m_FillLeftColor != g_MaskColor && offsetX != 0)
-                rectfill(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X - offsetX, targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillLeftColor);
+                FillRenderScaled(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X - offsetX, targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillLeftColor, renderScale);
             if (m_FillRightColor != g_MaskColor)
-                rectfill(pTargetBitmap, (targetBox.GetCorner().m_X - offsetX) + m_pMainBitmap->w, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillRightColor);
+                FillRenderScaled(pTargetBitmap, (targetBox.GetCorner().m_X - offsetX) + m_pMainBitmap->w, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillRightColor, renderScale);
         }
 
         if (!m_WrapY && !screenLargerThanSceneY && m_ScrollRatio.m_Y < 0)
         {
             if (m_FillUpColor != g_MaskColor && offsetY != 0)
-                rectfill(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y - offsetY, m_FillUpColor);
+                FillRenderScaled(pTargetBitmap, targetBox.GetCorner().m_X, targetBox.GetCorner().m_Y, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y - offsetY, m_FillUpColor, renderScale);
             if (m_FillDownColor != g_MaskColor)
-                rectfill(pTargetBitmap, targetBox.GetCorner().m_X, (targetBox.GetCorner().m_Y - offsetY) + m_pMainBitmap->h, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillDownColor);
+                FillRenderScaled(pTargetBitmap, targetBox.GetCorner().m_X, (targetBox.GetCorner().m_Y - offsetY) + m_pMainBitmap->h, targetBox.GetCorner().m_X + targetBox.GetWidth(), targetBox.GetCorner().m_Y + targetBox.GetHeight(), m_FillDownColor, renderScale);
         }
 */
     }
@@ -941,6 +942,84 @@ void SceneLayer::DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector
     set_clip_rect(pTargetBitmap, 0, 0, pTargetBitmap->w - 1, pTargetBitmap->h - 1);
 }
 
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetRenderScaledViewSize
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the size of the full resolution view that a target bitmap
+//                  dimension covers when drawing at a render scale.
+
+int SceneLayer::GetRenderScaledViewSize(int targetSize, float renderScale) const
+{
+    return renderScale == 1.0F ? targetSize : static_cast<int>(std::ceil(static_cast<float>(targetSize) / renderScale));
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          SetRenderScaledClipRect
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Sets the clipping rectangle of a target bitmap to a box in full
+//                  resolution view coordinates, scaled by the render scale.
+
+void SceneLayer::SetRenderScaledClipRect(BITMAP *pTargetBitmap, const Box &targetBox, float renderScale) const
+{
+    int left = static_cast<int>(std::floor(targetBox.GetCorner().m_X * renderScale));
+    int top = static_cast<int>(std::floor(targetBox.GetCorner().m_Y * renderScale));
+    int right = static_cast<int>(std::floor((targetBox.GetCorner().m_X + targetBox.GetWidth()) * renderScale)) - 1;
+    int bottom = static_cast<int>(std::floor((targetBox.GetCorner().m_Y + targetBox.GetHeight()) * renderScale)) - 1;
+    set_clip_rect(pTargetBitmap, left, top, right, bottom);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          BlitRenderScaled
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Blits a part of the main bitmap to a spot given in full resolution
+//                  view coordinates, scaled by the render scale, masked if this is
+//                  drawn transparently.
+
+void SceneLayer::BlitRenderScaled(BITMAP *pTargetBitmap, int sourceX, int sourceY, int sourceW, int sourceH, int destX, int destY, int destW, int destH, float renderScale) const
+{
+    if (sourceW <= 0 || sourceH <= 0)
+        return;
+
+    // Scale the edges rather than the size, so neighbouring pieces still meet without gaps
+    int scaledX = static_cast<int>(std::floor(static_cast<float>(destX) * renderScale));
+    int scaledY = static_cast<int>(std::floor(static_cast<float>(destY) * renderScale));
+    int scaledW = static_cast<int>(std::floor(static_cast<float>(destX + destW) * renderScale)) - scaledX;
+    int scaledH = static_cast<int>(std::floor(static_cast<float>(destY + destH) * renderScale)) - scaledY;
+    if (scaledW <= 0 || scaledH <= 0)
+        return;
+
+    if (scaledW == sourceW && scaledH == sourceH)
+    {
+        if (m_DrawTrans)
+            masked_blit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, scaledX, scaledY, sourceW, sourceH);
+        else
+            blit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, scaledX, scaledY, sourceW, sourceH);
+    }
+    else
+    {
+        if (m_DrawTrans)
+            masked_stretch_blit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, sourceW, sourceH, scaledX, scaledY, scaledW, scaledH);
+        else
+            stretch_blit(m_pMainBitmap, pTargetBitmap, sourceX, sourceY, sourceW, sourceH, scaledX, scaledY, scaledW, scaledH);
+    }
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          FillRenderScaled
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Fills a rectangle given in full resolution view coordinates, scaled
+//                  by the render scale.
+
+void SceneLayer::FillRenderScaled(BITMAP *pTargetBitmap, int left, int top, int right, int bottom, int color, float renderScale) const
+{
+    rectfill(pTargetBitmap, static_cast<int>(std::floor(static_cast<float>(left) * renderScale)), static_cast<int>(std::floor(static_cast<float>(top) * renderScale)), static_cast<int>(std::floor(static_cast<float>(right) * renderScale)), static_cast<int>(std::floor(static_cast<float>(bottom) * renderScale)), color);
+}
+
+
 /* not neccessary
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          LoadContour
@@ -455,9 +455,11 @@ ClassInfoGetters
 //                  box being where the scroll position lines up.
 //                  If a non-{-1,-1} vector is passed, the internal scroll offset of this
 //                  is overridder with it. It becomes the new source coordinates.
+//                  The fraction of full resolution the target bitmap is drawn at. The box
+//                  and the scroll position are still in full resolution coordinates.
 // Return value:    None.
 
-    virtual void Draw(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride = Vector(-1, -1)) const;
+    virtual void Draw(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride = Vector(-1, -1), float renderScale = 1.0F) const;
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -470,9 +472,11 @@ ClassInfoGetters
 //                  box being where the scroll position lines up.
 //                  If a non-{-1,-1} vector is passed, the internal scroll offset of this
 //                  is overridder with it. It becomes the new source coordinates.
+//                  The fraction of full resolution the target bitmap is drawn at. The box
+//                  and the scroll position are still in full resolution coordinates.
 // Return value:    None.
 
-    virtual void DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride = Vector(-1, -1)) const;
+    virtual void DrawScaled(BITMAP *pTargetBitmap, Box &targetBox, const Vector &scrollOverride = Vector(-1, -1), float renderScale = 1.0F) const;
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -494,6 +498,60 @@ protected:
 	void UpdateScrollRatiosForNetworkPlayer(int player);
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetRenderScaledViewSize
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the size of the full resolution view that a target bitmap
+//                  dimension covers when drawing at a render scale.
+// Arguments:       The width or height of the target bitmap.
+//                  The fraction of full resolution the target bitmap is drawn at.
+// Return value:    The width or height of the full resolution view.
+
+    int GetRenderScaledViewSize(int targetSize, float renderScale) const;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          SetRenderScaledClipRect
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Sets the clipping rectangle of a target bitmap to a box in full
+//                  resolution view coordinates, scaled by the render scale.
+// Arguments:       The bitmap to set the clipping rectangle of.
+//                  The box to clip to, in full resolution view coordinates.
+//                  The fraction of full resolution the target bitmap is drawn at.
+// Return value:    None.
+
+    void SetRenderScaledClipRect(BITMAP *pTargetBitmap, const Box &targetBox, float renderScale) const;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          BlitRenderScaled
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Blits a part of the main bitmap to a spot given in full resolution
+//                  view coordinates, scaled by the render scale, masked if this is
+//                  drawn transparently.
+// Arguments:       The bitmap to draw to.
+//                  The rectangle of the main bitmap to draw.
+//                  The rectangle to draw it to, in full resolution view coordinates.
+//                  The fraction of full resolution the target bitmap is drawn at.
+// Return value:    None.
+
+    void BlitRenderScaled(BITMAP *pTargetBitmap, int sourceX, int sourceY, int sourceW, int sourceH, int destX, int destY, int destW, int destH, float renderScale) const;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          FillRenderScaled
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Fills a rectangle given in full resolution view coordinates, scaled
+//                  by the render scale.
+// Arguments:       The bitmap to draw to.
+//                  The corners of the rectangle, in full resolution view coordinates.
+//                  The color to fill with.
+//                  The fraction of full resolution the target bitmap is drawn at.
+// Return value:    None.
+
+    void FillRenderScaled(BITMAP *pTargetBitmap, int left, int top, int right, int bottom, int color, float renderScale) const;
+
+
     // Member variables
     static Entity::ClassInfo m_sClass;
 
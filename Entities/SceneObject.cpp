@@ -260,27 +260,19 @@ int SceneObject::Create(const SceneObject &reference)
 
 int SceneObject::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "Position")
-        reader >> m_Pos;
-    else if (propName == "GoldValue" || propName == "GoldCost")
-        reader >> m_OzValue;
-    else if (propName == "Buyable")
-        reader >> m_Buyable;
-    else if (propName == "Team")
-    {
-        reader >> m_Team;
-        // Necessary to properly init (flag icons) some derived classes
-        // (actually, this rarely matters since tehre won't be an activity going when this is read!)
-        SetTeam(m_Team);
-    }
-    else if (propName == "PlacedByPlayer")
-        reader >> m_PlacedByPlayer;
-    else
-    {
-        return Entity::ReadProperty(propName, reader);
-    }
-
-    return 0;
+    static const PropertyReaderMap<SceneObject> propertyReaders = {
+        { { "Position" }, [](SceneObject &sceneObject, Reader &reader) { reader >> sceneObject.m_Pos; } },
+        { { "GoldValue", "GoldCost" }, [](SceneObject &sceneObject, Reader &reader) { reader >> sceneObject.m_OzValue; } },
+        { { "Buyable" }, [](SceneObject &sceneObject, Reader &reader) { reader >> sceneObject.m_Buyable; } },
+        { { "Team" }, [](SceneObject &sceneObject, Reader &reader) {
+            reader >> sceneObject.m_Team;
+            // Necessary to properly init (flag icons) some derived classes
+            // (actually, this rarely matters since tehre won't be an activity going when this is read!)
+            sceneObject.SetTeam(sceneObject.m_Team);
+        } },
+        { { "PlacedByPlayer" }, [](SceneObject &sceneObject, Reader &reader) { reader >> sceneObject.m_PlacedByPlayer; } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Entity::ReadProperty(propName, reader);
 }
 
 
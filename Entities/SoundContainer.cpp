@@ -16,6 +16,7 @@ namespace RTE {
 		m_TopLevelSoundSet.Destroy();
 
 		m_PlayingChannels.clear();
+		m_PlayPending = false;
 		m_SoundOverlapMode = SoundOverlapMode::OVERLAP;
 
 		m_Immobile = false;
@@ -39,6 +40,7 @@ namespace RTE {
 		m_TopLevelSoundSet.Create(reference.m_TopLevelSoundSet);
 
 		m_PlayingChannels.clear();
+		m_PlayPending = false;
 		m_SoundOverlapMode = reference.m_SoundOverlapMode;
 
 		m_Immobile = reference.m_Immobile;
@@ -58,47 +60,39 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int SoundContainer::ReadProperty(std::string propName, Reader &reader) {
-		if (propName == "AddSound") {
-			m_TopLevelSoundSet.AddSoundData(SoundSet::ReadAndGetSoundData(reader));
-		} else if (propName == "AddSoundSet") {
-			SoundSet soundSetToAdd;
-			reader >> soundSetToAdd;
-			m_TopLevelSoundSet.AddSoundSet(soundSetToAdd);
-		} else if (propName == "SoundSelectionCycleMode" || propName == "CycleMode") {
-			m_TopLevelSoundSet.SetSoundSelectionCycleMode(SoundSet::ReadSoundSelectionCycleMode(reader));
-		} else if (propName == "SoundOverlapMode") {
-			std::string soundOverlapModeString = reader.ReadPropValue();
-			if (c_SoundOverlapModeMap.find(soundOverlapModeString) != c_SoundOverlapModeMap.end()) {
-				m_SoundOverlapMode = c_SoundOverlapModeMap.find(soundOverlapModeString)->second;
-			} else {
-				try {
-					m_SoundOverlapMode = static_cast<SoundOverlapMode>(std::stoi(soundOverlapModeString));
-				} catch (const std::exception &) {
-					reader.ReportError("Cycle mode " + soundOverlapModeString + " is invalid.");
+		static const PropertyReaderMap<SoundContainer> propertyReaders = {
+			{ { "AddSound" }, [](SoundContainer &soundContainer, Reader &reader) { soundContainer.m_TopLevelSoundSet.AddSoundData(SoundSet::ReadAndGetSoundData(reader)); } },
+			{ { "AddSoundSet" }, [](SoundContainer &soundContainer, Reader &reader) {
+				SoundSet soundSetToAdd;
+				reader >> soundSetToAdd;
+				soundContainer.m_TopLevelSoundSet.AddSoundSet(soundSetToAdd);
+			} },
+			{ { "SoundSelectionCycleMode", "CycleMode" }, [](SoundContainer &soundContainer, Reader &reader) { soundContainer.m_TopLevelSoundSet.SetSoundSelectionCycleMode(SoundSet::ReadSoundSelectionCycleMode(reader)); } },
+			{ { "SoundOverlapMode" }, [](SoundContainer &soundContainer, Reader &reader) {
+				std::string soundOverlapModeString = reader.ReadPropValue();
+				if (c_SoundOverlapModeMap.find(soundOverlapModeString) != c_SoundOverlapModeMap.end()) {
+					soundContainer.m_SoundOverlapMode = c_SoundOverlapModeMap.find(soundOverlapModeString)->second;
+				} else {
+					try {
+						soundContainer.m_SoundOverlapMode = static_cast<SoundOverlapMode>(std::stoi(soundOverlapModeString));
+					} catch (const std::exception &) {
+						reader.ReportError("Cycle mode " + soundOverlapModeString + " is invalid.");
+					}
 				}
-			}
-		} else if (propName == "Immobile") {
-			reader >> m_Immobile;
-		} else if (propName == "AttenuationStartDistance") {
-			reader >> m_AttenuationStartDistance;
-		} else if (propName == "LoopSetting") {
-			reader >> m_Loops;
-		} else if (propName == "Priority") {
-			reader >> m_Priority;
-			if (m_Priority < 0 || m_Priority > 256) { reader.ReportError("SoundContainer priority must be between 256 (lowest priority) and 0 (highest priority)."); }
-		} else if (propName == "AffectedByGlobalPitch") {
-			reader >> m_AffectedByGlobalPitch;
-		} else if (propName == "Position") {
-			reader >> m_Pos;
-		} else if (propName == "Volume") {
-			reader >> m_Volume;
-		} else if (propName == "Pitch") {
-			reader >> m_Pitch;
-		} else {
-			return Entity::ReadProperty(propName, reader);
-		}
-
-		return 0;
+			} },
+			{ { "Immobile" }, [](SoundContainer &soundContainer, Reader &reader) { reader >> soundContainer.m_Immobile; } },
+			{ { "AttenuationStartDistance" }, [](SoundContainer &soundContainer, Reader &reader) { reader >> soundContainer.m_AttenuationStartDistance; } },
+			{ { "LoopSetting" }, [](SoundContainer &soundContainer, Reader &reader) { reader >> soundContainer.m_Loops; } },
+			{ { "Priority" }, [](SoundContainer &soundContainer, Reader &reader) {
+				reader >> soundContainer.m_Priority;
+				if (soundContainer.m_Priority < 0 || soundContainer.m_Priority > 256) { reader.ReportError("SoundContainer priority must be between 256 (lowest priority) and 0 (highest priority)."); }
+			} },
+			{ { "AffectedByGlobalPitch" }, [](SoundContainer &soundContainer, Reader &reader) { reader >> soundContainer.m_AffectedByGlobalPitch; } },
+			{ { "Position" }, [](SoundContainer &soundContainer, Reader &reader) { reader >> soundContainer.m_Pos; } },
+			{ { "Volume" }, [](SoundContainer &soundContainer, Reader &reader) { reader >> soundContainer.m_Volume; } },
+			{ { "Pitch" }, [](SoundContainer &soundContainer, Reader &reader) { reader >> soundContainer.m_Pitch; } }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : Entity::ReadProperty(propName, reader);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,6 +185,21 @@ namespace RTE {
 		std::vector<SoundSet::SoundData *> flattenedSoundData;
 		m_TopLevelSoundSet.GetFlattenedSoundData(flattenedSoundData, false);
 		for (SoundSet::SoundData *soundData : flattenedSoundData) {
+			// Sounds loaded on demand start loading in the background the first time their SoundContainer is played
+			if (!soundData->SoundObject) {
+				soundData->SoundObject = soundData->SoundFile.GetAsSound(true, true);
+				if (!soundData->SoundObject) {
+					result = (result == FMOD_OK) ? FMOD_ERR_FILE_NOTFOUND : result;
+					continue;
+				}
+			}
+			// FMOD can't set up or play sounds that are still loading, so they're left out until they're ready instead of holding up the game
+			FMOD_OPENSTATE openState = FMOD_OPENSTATE_READY;
+			soundData->SoundObject->getOpenState(&openState, nullptr, nullptr, nullptr);
+			if (openState != FMOD_OPENSTATE_READY) {
+				result = (result == FMOD_OK) ? ((openState == FMOD_OPENSTATE_ERROR) ? FMOD_ERR_FILE_BAD : FMOD_ERR_NOTREADY) : result;
+				continue;
+			}
 			FMOD_MODE soundMode = (m_Loops == 0) ? FMOD_LOOP_OFF : FMOD_LOOP_NORMAL;
 			if (m_Immobile) {
 				soundMode |= FMOD_3D_HEADRELATIVE;
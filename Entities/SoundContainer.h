@@ -67,7 +67,7 @@ namespace RTE {
 		/// Destroys and resets (through Clear()) the SoundContainer object. It doesn't delete the Sound files, since they're owned by ContentFile static maps.
 		/// </summary>
 		/// <param name="notInherited">Whether to only destroy the members defined in this derived class, or to destroy all inherited members also.</param>
-		void Destroy(bool notInherited = false) override { if (!notInherited) { Entity::Destroy(); } Clear(); }
+		void Destroy(bool notInherited = false) override { if (m_PlayPending) { g_AudioMan.CancelPendingPlay(this); } if (!notInherited) { Entity::Destroy(); } Clear(); }
 
 		/// <summary>
 		/// Resets the entire SoundContainer, including its inherited members, to their default settings or values.
@@ -108,10 +108,10 @@ namespace RTE {
 		std::unordered_set<int> const * GetPlayingChannels() const { return &m_PlayingChannels; }
 
 		/// <summary>
-		/// Indicates whether any sound in this SoundContainer is currently being played.
+		/// Indicates whether any sound in this SoundContainer is currently being played, or will start playing once its sounds finish loading.
 		/// </summary>
 		/// <returns>Whether any sounds are playing.</returns>
-		bool IsBeingPlayed() const { return !m_PlayingChannels.empty(); }
+		bool IsBeingPlayed() const { return !m_PlayingChannels.empty() || m_PlayPending; }
 
 		/// <summary>
 		/// Adds a channel index to the SoundContainer's collection of playing channels.
@@ -125,6 +125,18 @@ namespace RTE {
 		/// <param name="channel">The channel index to remove.</param>
 		void RemovePlayingChannel(int channel) { m_PlayingChannels.erase(channel); }
 
+		/// <summary>
+		/// Gets whether this SoundContainer is waiting for its sounds to finish loading before it starts playing.
+		/// </summary>
+		/// <returns>Whether this SoundContainer has a play waiting in AudioMan.</returns>
+		bool IsPlayPending() const { return m_PlayPending; }
+
+		/// <summary>
+		/// Sets whether this SoundContainer is waiting for its sounds to finish loading before it starts playing.
+		/// </summary>
+		/// <param name="playPending">Whether this SoundContainer has a play waiting in AudioMan.</param>
+		void SetPlayPending(bool playPending) { m_PlayPending = playPending; }
+
 		/// <summary>
 		/// Gets the SoundOverlapMode of this SoundContainer, which is used to determine how it should behave when it's told to play while already playing.
 		/// </summary>
@@ -284,7 +296,7 @@ namespace RTE {
 		/// </summary>
 		/// <param name="player">Player to stop playback of this SoundContainer for.</param>
 		/// <returns>Whether this SoundContainer successfully stopped playing.</returns>
-		bool Stop(int player) { return (HasAnySounds() && IsBeingPlayed()) ? g_AudioMan.StopSound(this, player) : false; }
+		bool Stop(int player) { if (m_PlayPending) { g_AudioMan.CancelPendingPlay(this); } return (HasAnySounds() && IsBeingPlayed()) ? g_AudioMan.StopSound(this, player) : false; }
 
 		/// <summary>
 		/// Restarts playback of this SoundContainer for all players.
@@ -303,7 +315,7 @@ namespace RTE {
 		/// Fades out playback of the SoundContainer to 0 volume.
 		/// </summary>
 		/// <param name="fadeOutTime">How long the fadeout should take.</param>
-		void FadeOut(int fadeOutTime = 1000) { if (IsBeingPlayed()) { return g_AudioMan.FadeOutSound(this, fadeOutTime); } }
+		void FadeOut(int fadeOutTime = 1000) { if (m_PlayPending) { g_AudioMan.CancelPendingPlay(this); } if (IsBeingPlayed()) { return g_AudioMan.FadeOutSound(this, fadeOutTime); } }
 #pragma endregion
 
 #pragma region Miscellaneous
@@ -323,6 +335,7 @@ namespace RTE {
 		SoundSet m_TopLevelSoundSet; //The top level SoundSet that handles all SoundData and sub SoundSets in this SoundContainer.
 
 		std::unordered_set<int> m_PlayingChannels; //!< The channels this SoundContainer is currently using.
+		bool m_PlayPending; //!< Whether this SoundContainer was played while its sounds were still loading, and waits in AudioMan to start once they're ready.
 		SoundOverlapMode m_SoundOverlapMode; //!< The SoundOverlapMode for this SoundContainer, used to determine how it should handle overlapping play calls.
 
 		bool m_Immobile; //!< Whether this SoundContainer's sounds should be treated as immobile, i.e. not affected by 3D sound effects. Mostly used for GUI sounds and the like.
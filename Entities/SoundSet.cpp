@@ -1,5 +1,6 @@
 #include "SoundSet.h"
 #include "AudioMan.h"
+#include "SettingsMan.h"
 #include "RTETools.h"
 #include "RTEError.h"
 
@@ -64,13 +65,19 @@ namespace RTE {
 
 		/// <summary>
 		/// Internal lambda function to load an audio file by path in as a ContentFile, which in turn loads it into FMOD, then returns SoundData for it in the outParam outSoundData.
+		/// If sounds are loaded on demand, the file is only checked and loading it into FMOD is left to the first time it's played.
 		/// </summary>
 		/// <param name="soundPath">The path to the sound file.</param>
 		auto readSoundFromPath = [&soundData, &reader](const std::string &soundPath) {
 			ContentFile soundFile(soundPath.c_str());
 			soundFile.SetFormattedReaderPosition("in file " + reader.GetCurrentFilePath() + " on line " + std::to_string(reader.GetCurrentFileLine()));
-			FMOD::Sound *soundObject = soundFile.GetAsSound();
-			if (g_AudioMan.IsAudioEnabled() && !soundObject) { reader.ReportError(std::string("Failed to load the sound from the file")); }
+			FMOD::Sound *soundObject = nullptr;
+			if (g_SettingsMan.LoadSoundsOnDemand()) {
+				if (g_AudioMan.IsAudioEnabled() && !soundFile.CheckSoundFile()) { reader.ReportError(std::string("Failed to load the sound from the file")); }
+			} else {
+				soundObject = soundFile.GetAsSound();
+				if (g_AudioMan.IsAudioEnabled() && !soundObject) { reader.ReportError(std::string("Failed to load the sound from the file")); }
+			}
 
 			soundData.SoundFile = soundFile;
 			soundData.SoundObject = soundObject;
@@ -31,7 +31,7 @@ namespace RTE {
 		/// </summary>
 		struct SoundData {
 			ContentFile SoundFile;
-			FMOD::Sound *SoundObject;
+			FMOD::Sound *SoundObject; //!< The FMOD::Sound of this SoundData. Null until the sound is first played if sounds are loaded on demand, and may still be loading for a while after.
 			Vector Offset = Vector();
 			float MinimumAudibleDistance = 0.0F;
 			float AttenuationStartDistance = -1.0F;
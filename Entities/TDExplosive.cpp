@@ -28,15 +28,11 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int TDExplosive::ReadProperty(std::string propName, Reader &reader) {
-		// TODO: Consider removing DetonationSound as GibSound already exists and could be used in its place
-		if (propName == "DetonationSound") {
-			reader >> m_GibSound;
-		} else if (propName == "IsAnimatedManually") {
-			reader >> m_IsAnimatedManually;
-		} else {
-			return ThrownDevice::ReadProperty(propName, reader);
-		}
-		return 0;
+		static const PropertyReaderMap<TDExplosive> propertyReaders = {
+			{ { "DetonationSound" }, [](TDExplosive &explosive, Reader &reader) { reader >> explosive.m_GibSound; } },
+			{ { "IsAnimatedManually" }, [](TDExplosive &explosive, Reader &reader) { reader >> explosive.m_IsAnimatedManually; } }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : ThrownDevice::ReadProperty(propName, reader);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,24 +49,16 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int ThrownDevice::ReadProperty(std::string propName, Reader &reader) {
-		if (propName == "ActivationSound") {
-			reader >> m_ActivationSound;
-		} else if (propName == "StartThrowOffset") {
-			reader >> m_StartThrowOffset;
-		} else if (propName == "EndThrowOffset") {
-			reader >> m_EndThrowOffset;
-		} else if (propName == "MinThrowVel") {
-			reader >> m_MinThrowVel;
-		} else if (propName == "MaxThrowVel") {
-			reader >> m_MaxThrowVel;
-		} else if (propName == "TriggerDelay") {
-			reader >> m_TriggerDelay;
-		} else if (propName == "ActivatesWhenReleased") {
-			reader >> m_ActivatesWhenReleased;
-		} else {
-			return HeldDevice::ReadProperty(propName, reader);
-		}
-		return 0;
+		static const PropertyReaderMap<ThrownDevice> propertyReaders = {
+			{ { "ActivationSound" }, [](ThrownDevice &thrownDevice, Reader &reader) { reader >> thrownDevice.m_ActivationSound; } },
+			{ { "StartThrowOffset" }, [](ThrownDevice &thrownDevice, Reader &reader) { reader >> thrownDevice.m_StartThrowOffset; } },
+			{ { "EndThrowOffset" }, [](ThrownDevice &thrownDevice, Reader &reader) { reader >> thrownDevice.m_EndThrowOffset; } },
+			{ { "MinThrowVel" }, [](ThrownDevice &thrownDevice, Reader &reader) { reader >> thrownDevice.m_MinThrowVel; } },
+			{ { "MaxThrowVel" }, [](ThrownDevice &thrownDevice, Reader &reader) { reader >> thrownDevice.m_MaxThrowVel; } },
+			{ { "TriggerDelay" }, [](ThrownDevice &thrownDevice, Reader &reader) { reader >> thrownDevice.m_TriggerDelay; } },
+			{ { "ActivatesWhenReleased" }, [](ThrownDevice &thrownDevice, Reader &reader) { reader >> thrownDevice.m_ActivatesWhenReleased; } }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : HeldDevice::ReadProperty(propName, reader);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
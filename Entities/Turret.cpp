@@ -79,21 +79,19 @@ int Turret::Create(const Turret &reference)
 
 int Turret::ReadProperty(std::string propName, Reader &reader)
 {
-    if (propName == "MountedMO")
-    {
-        const Entity *pEntity = g_PresetMan.GetEntityPreset(reader);
-        if (pEntity)
-        {
-            m_pMountedMO = dynamic_cast<MovableObject *>(pEntity->Clone());
-            if (m_pMountedMO->IsDevice())
-                dynamic_cast<HeldDevice *>(m_pMountedMO)->Attach(this, dynamic_cast<HeldDevice *>(m_pMountedMO)->GetParentOffset());
-        }
-        pEntity = 0;
-    }
-    else
-        return Attachable::ReadProperty(propName, reader);
-
-    return 0;
+    static const PropertyReaderMap<Turret> propertyReaders = {
+        { { "MountedMO" }, [](Turret &turret, Reader &reader) {
+            const Entity *pEntity = g_PresetMan.GetEntityPreset(reader);
+            if (pEntity)
+            {
+                turret.m_pMountedMO = dynamic_cast<MovableObject *>(pEntity->Clone());
+                if (turret.m_pMountedMO->IsDevice())
+                    dynamic_cast<HeldDevice *>(turret.m_pMountedMO)->Attach(&turret, dynamic_cast<HeldDevice *>(turret.m_pMountedMO)->GetParentOffset());
+            }
+            pEntity = 0;
+        } }
+    };
+    return propertyReaders.Read(*this, propName, reader) ? 0 : Attachable::ReadProperty(propName, reader);
 }
 
 
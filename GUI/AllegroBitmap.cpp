@@ -291,6 +291,19 @@ int AllegroBitmap::GetColorDepth()
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual Method:  GetMaskColor
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the color that is skipped when this bitmap is drawn transparently.
+
+unsigned long AllegroBitmap::GetMaskColor()
+{
+    if (m_pBitmap)
+        return bitmap_mask_color(m_pBitmap);
+    return 0;
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual Method:  GetClipRect
 //////////////////////////////////////////////////////////////////////////////////////////
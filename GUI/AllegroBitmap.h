@@ -203,6 +203,15 @@ public:
 	int GetColorDepth() override;
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual Method:  GetMaskColor
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the color that is skipped when this bitmap is drawn transparently.
+// Returns:         The mask color, in the color depth of this bitmap.
+
+	unsigned long GetMaskColor() override;
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual Method:  GetClipRect
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -85,6 +85,20 @@ GUIBitmap * AllegroScreen::CreateBitmap(int Width, int Height)
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          CreateScreen
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Creates a screen that draws onto an existing bitmap
+
+GUIScreen * AllegroScreen::CreateScreen(GUIBitmap *pBitmap)
+{
+    if (!pBitmap || !((AllegroBitmap *)pBitmap)->GetBitmap())
+        return 0;
+
+    return new AllegroScreen(((AllegroBitmap *)pBitmap)->GetBitmap());
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          DrawBitmap
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -83,6 +83,15 @@ public:
     GUIBitmap * CreateBitmap(int Width, int Height) override;
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          CreateScreen
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Creates a screen that draws onto an existing bitmap
+// Arguments:       Bitmap created by this screen. Ownership IS NOT transferred!
+
+    GUIScreen * CreateScreen(GUIBitmap *pBitmap) override;
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          DrawBitmap
 //////////////////////////////////////////////////////////////////////////////////////////
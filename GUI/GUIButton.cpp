@@ -135,6 +135,7 @@ void GUIButton::ChangeSkin(GUISkin *Skin)
 
 void GUIButton::BuildBitmap(void)
 {
+    Invalidate();
     // Free any old bitmap
     if (m_DrawBitmap) {
         m_DrawBitmap->Destroy();
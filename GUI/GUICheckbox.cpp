@@ -136,6 +136,7 @@ void GUICheckbox::ChangeSkin(GUISkin *Skin)
 
 void GUICheckbox::BuildBitmap(void)
 {
+    Invalidate();
     string Filename;
     unsigned long ColorIndex = 0;
     int Values[4];
@@ -191,7 +192,9 @@ void GUICheckbox::Draw(GUIScreen *Screen)
         return;
 
     // Setup the clipping
-    Screen->GetBitmap()->SetClipRect(GetRect());
+    GUIRect OuterClip;
+    Screen->GetBitmap()->GetClipRect(&OuterClip);
+    Screen->GetBitmap()->AddClipRect(GetRect());
 
     // Calculate the y position of the base
     // Make it centred vertically
@@ -234,7 +237,7 @@ void GUICheckbox::Draw(GUIScreen *Screen)
     
 
 
-    Screen->GetBitmap()->SetClipRect(0);
+    Screen->GetBitmap()->SetClipRect(&OuterClip);
 
     GUIPanel::Draw(Screen);
 }
@@ -399,6 +402,7 @@ string GUICheckbox::GetText(void)
 
 void GUICheckbox::SetCheck(int Check)
 {
+    Invalidate();
     m_Check = Check;
 }
 
@@ -144,6 +144,7 @@ void GUICollectionBox::ChangeSkin(GUISkin *Skin)
 
 void GUICollectionBox::BuildBitmap(void)
 {
+    Invalidate();
     // Free any old bitmap
     delete m_DrawBitmap;
 
@@ -170,13 +171,15 @@ void GUICollectionBox::Draw(GUIScreen *Screen)
         else if (m_DrawType == Image) {
             if (m_DrawBitmap && m_DrawBackground) {
                 // Setup the clipping
-                Screen->GetBitmap()->SetClipRect(GetRect());
+                GUIRect OuterClip;
+                Screen->GetBitmap()->GetClipRect(&OuterClip);
+                Screen->GetBitmap()->AddClipRect(GetRect());
 
                 // Draw the image
                 m_DrawBitmap->DrawTrans(Screen->GetBitmap(), m_X, m_Y, 0);
 
-                // Get rid of clipping
-                Screen->GetBitmap()->SetClipRect(0);
+                // Restore the clipping
+                Screen->GetBitmap()->SetClipRect(&OuterClip);
             }
         }
         // Panel
@@ -557,7 +557,7 @@ bool GUIControlManager::Load(Reader *R, bool keepOld)
 
     GUIProperties *CurProp = 0;
 
-    while(!R->GetStream()->eof()) {
+    while(!R->IsEndOfFile()) {
         char line[2048];
         R->ReadLine(line, 2048);
 
@@ -158,6 +158,17 @@ public:
     void EnableMouse(bool enable = true) { m_GUIManager->EnableMouse(enable); }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          EnableCompositing
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Enables and disables dirty-region compositing. When enabled, only the
+//                  parts of the GUI that were invalidated since the last draw are redrawn
+//                  to a cached surface, which is then blitted to the screen.
+// Arguments:       Enable?
+
+    void EnableCompositing(bool enable = true) { m_GUIManager->EnableCompositing(enable); }
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          SetPosOnScreen
 //////////////////////////////////////////////////////////////////////////////////////////
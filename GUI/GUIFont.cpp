@@ -58,6 +58,7 @@ bool GUIFont::Load(GUIScreen *Screen, const std::string Filename)
 
     // Clear the cache
     m_ColorCache.clear();
+    ClearTextCaches();
 
     // Convert the MainColor
     m_MainColor = Screen->ConvertColor(m_MainColor, m_CurrentBitmap->GetColorDepth());
@@ -143,6 +144,26 @@ bool GUIFont::Load(GUIScreen *Screen, const std::string Filename)
 // Description:     Draws text to a bitmap.
 
 void GUIFont::Draw(GUIBitmap *Bitmap, int X, int Y, const std::string Text, unsigned long Shadow)
+{
+    // Blit the whole pre-rendered run in one go if possible
+    GUIBitmap *pRun = GetTextRun(Text, Shadow);
+    if (pRun) {
+        GUIRect RunRect;
+        SetRect(&RunRect, 0, 0, pRun->GetWidth(), pRun->GetHeight());
+        pRun->DrawTrans(Bitmap, X, Y, &RunRect);
+        return;
+    }
+
+    DrawUncached(Bitmap, X, Y, Text, Shadow);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DrawUncached
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Draws text to a bitmap character by character.
+
+void GUIFont::DrawUncached(GUIBitmap *Bitmap, int X, int Y, const std::string &Text, unsigned long Shadow)
 {
     unsigned char c;
     int i;
@@ -314,6 +335,10 @@ void GUIFont::SetColor(unsigned long Color)
 
 int GUIFont::CalculateWidth(const std::string Text)
 {
+    std::unordered_map<std::string, int>::const_iterator widthItr = m_WidthCache.find(Text);
+    if (widthItr != m_WidthCache.end())
+        return widthItr->second;
+
     unsigned char c;
     int i;
     int Width = 0;
@@ -347,6 +372,11 @@ int GUIFont::CalculateWidth(const std::string Text)
 
     if (Width > WidestLine)
         WidestLine = Width;
+
+    if (m_WidthCache.size() >= c_MaxCachedMeasurements)
+        m_WidthCache.clear();
+    m_WidthCache.insert({ Text, WidestLine });
+
     return WidestLine;
 }
 
@@ -378,6 +408,11 @@ int GUIFont::CalculateHeight(const std::string Text, int MaxWidth)
     if (Text.empty())
         return 0;
 
+    TextHeightKey HeightKey = { Text, MaxWidth };
+    std::unordered_map<TextHeightKey, int, TextHeightKeyHash>::const_iterator heightItr = m_HeightCache.find(HeightKey);
+    if (heightItr != m_HeightCache.end())
+        return heightItr->second;
+
     unsigned char c;
     int i;
     int Width = 0;
@@ -418,6 +453,10 @@ int GUIFont::CalculateHeight(const std::string Text, int MaxWidth)
         }
     }
 
+    if (m_HeightCache.size() >= c_MaxCachedMeasurements)
+        m_HeightCache.clear();
+    m_HeightCache.insert({ HeightKey, Height });
+
     return Height;
 }
 
@@ -462,6 +501,80 @@ void GUIFont::CacheColor(unsigned long Color)
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetTextRun
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Finds or renders the pre-rendered bitmap of a piece of text in the
+//                  current color.
+
+GUIBitmap * GUIFont::GetTextRun(const std::string &Text, unsigned long Shadow)
+{
+    // Tabs advance the pen in a way CalculateWidth doesn't account for, so those can't be sized up front
+    if (!m_Screen || !m_Font || Text.empty() || Text.find('\t') != string::npos)
+        return 0;
+
+    TextRunKey Key = { Text, m_CurrentColor, Shadow };
+    std::unordered_map<TextRunKey, TextRun, TextRunKeyHash>::iterator runItr = m_TextRuns.find(Key);
+    if (runItr != m_TextRuns.end()) {
+        m_TextRunLRU.splice(m_TextRunLRU.begin(), m_TextRunLRU, runItr->second.m_LRUPosition);
+        return runItr->second.m_Bitmap;
+    }
+
+    // One extra pixel each way to fit the drop-shadow
+    int Width = CalculateWidth(Text) + 1;
+    int Height = (std::count(Text.begin(), Text.end(), '\n') + 1) * m_FontHeight + 1;
+    GUIBitmap *pRunBitmap = m_Screen->CreateBitmap(Width, Height);
+    if (!pRunBitmap)
+        return 0;
+
+    // Clear to the font's background color, converted to the run's color depth by copying the Top-Right hand corner pixel over
+    GUIRect BackGRect;
+    SetRect(&BackGRect, m_Font->GetWidth() - 1, 0, m_Font->GetWidth(), 1);
+    m_Font->Draw(pRunBitmap, 0, 0, &BackGRect);
+    pRunBitmap->DrawRectangle(0, 0, Width, Height, pRunBitmap->GetPixel(0, 0), true);
+
+    DrawUncached(pRunBitmap, 0, 0, Text, Shadow);
+
+    // Make room by throwing out the least recently used run
+    if (m_TextRuns.size() >= c_MaxCachedTextRuns) {
+        std::unordered_map<TextRunKey, TextRun, TextRunKeyHash>::iterator lruItr = m_TextRuns.find(m_TextRunLRU.back());
+        if (lruItr != m_TextRuns.end()) {
+            lruItr->second.m_Bitmap->Destroy();
+            delete lruItr->second.m_Bitmap;
+            m_TextRuns.erase(lruItr);
+        }
+        m_TextRunLRU.pop_back();
+    }
+
+    m_TextRunLRU.push_front(Key);
+    TextRun Run = { pRunBitmap, m_TextRunLRU.begin() };
+    m_TextRuns.insert({ Key, Run });
+
+    return pRunBitmap;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          ClearTextCaches
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Destroys all pre-rendered text runs and forgets all memoised text
+//                  measurements.
+
+void GUIFont::ClearTextCaches(void)
+{
+    for (std::pair<const TextRunKey, TextRun> &run : m_TextRuns) {
+        if (run.second.m_Bitmap) {
+            run.second.m_Bitmap->Destroy();
+            delete run.second.m_Bitmap;
+        }
+    }
+    m_TextRuns.clear();
+    m_TextRunLRU.clear();
+    m_WidthCache.clear();
+    m_HeightCache.clear();
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          GetFontColor
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -524,6 +637,8 @@ int GUIFont::GetKerning(void)
 
 void GUIFont::Destroy(void)
 {
+    ClearTextCaches();
+
     if (m_Font) {
         m_Font->Destroy();
         delete m_Font;
@@ -56,6 +56,11 @@ public:
         GUIBitmap    *m_Bitmap;
     } FontColor;
 
+    // Maximum number of pre-rendered text runs kept around per font before the least recently used ones get evicted
+    static constexpr int c_MaxCachedTextRuns = 256;
+    // Maximum number of memoised text measurements kept per font before they're all thrown out
+    static constexpr int c_MaxCachedMeasurements = 1024;
+
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // Constructor:     GUIFont
@@ -192,7 +197,17 @@ public:
 //                  between chars, 0 = chars are touching.
 // Arguments:       None.
 
-    void SetKerning(int newKerning = 1) { m_Kerning = newKerning; }
+    void SetKerning(int newKerning = 1) { if (newKerning != m_Kerning) { ClearTextCaches(); } m_Kerning = newKerning; }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          ClearTextCaches
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Destroys all pre-rendered text runs and forgets all memoised text
+//                  measurements.
+// Arguments:       None.
+
+    void ClearTextCaches();
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -200,6 +215,58 @@ public:
 
 private:
 
+    // Key of a pre-rendered text run
+    struct TextRunKey {
+        std::string     m_Text;
+        unsigned long   m_Color;
+        unsigned long   m_Shadow;
+
+        bool operator==(const TextRunKey &rhs) const { return m_Color == rhs.m_Color && m_Shadow == rhs.m_Shadow && m_Text == rhs.m_Text; }
+    };
+
+    struct TextRunKeyHash {
+        size_t operator()(const TextRunKey &key) const { return std::hash<std::string>()(key.m_Text) ^ (std::hash<unsigned long>()(key.m_Color) << 1) ^ (std::hash<unsigned long>()(key.m_Shadow) << 2); }
+    };
+
+    // Pre-rendered text run, with its position in the LRU list so lookups can move it to the front
+    struct TextRun {
+        GUIBitmap                           *m_Bitmap;
+        std::list<TextRunKey>::iterator     m_LRUPosition;
+    };
+
+    // Key of a memoised height measurement
+    struct TextHeightKey {
+        std::string     m_Text;
+        int             m_MaxWidth;
+
+        bool operator==(const TextHeightKey &rhs) const { return m_MaxWidth == rhs.m_MaxWidth && m_Text == rhs.m_Text; }
+    };
+
+    struct TextHeightKeyHash {
+        size_t operator()(const TextHeightKey &key) const { return std::hash<std::string>()(key.m_Text) ^ (std::hash<int>()(key.m_MaxWidth) << 1); }
+    };
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DrawUncached
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Draws text to a bitmap character by character.
+// Arguments:       Bitmap, Position, Text, Color, Drop-shadow, 0 = none.
+
+    void DrawUncached(GUIBitmap *Bitmap, int X, int Y, const std::string &Text, unsigned long Shadow);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetTextRun
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Finds or renders the pre-rendered bitmap of a piece of text in the
+//                  current color, evicting the least recently used run if the cache is
+//                  full.
+// Arguments:       Text, Drop-shadow, 0 = none.
+// Return value:    The pre-rendered bitmap, or 0 if the text can't be cached.
+
+    GUIBitmap * GetTextRun(const std::string &Text, unsigned long Shadow);
+
     GUIBitmap        *m_Font;
     GUIScreen        *m_Screen;
     std::vector<FontColor >    m_ColorCache;
@@ -215,6 +282,11 @@ private:
 
     int                m_Kerning;            // Spacing between characters
     int                m_Leading;            // Spacing between lines
+
+    std::unordered_map<TextRunKey, TextRun, TextRunKeyHash> m_TextRuns; // Pre-rendered text runs
+    std::list<TextRunKey>   m_TextRunLRU;       // Keys of the pre-rendered text runs, most recently used first
+    std::unordered_map<std::string, int> m_WidthCache; // Memoised CalculateWidth results
+    std::unordered_map<TextHeightKey, int, TextHeightKeyHash> m_HeightCache; // Memoised CalculateHeight results
 };
 
 
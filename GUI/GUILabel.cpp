@@ -282,6 +282,7 @@ void GUILabel::GetControlRect(int *X, int *Y, int *Width, int *Height)
 
 void GUILabel::SetText(const string Text)
 {
+    Invalidate();
     m_Text = Text;
 }
 
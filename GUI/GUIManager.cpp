@@ -29,6 +29,9 @@ GUIManager::GUIManager(GUIInput *input)
     m_Input = input;
     m_MouseEnabled = true;
     m_UseValidation = false;
+    m_UseCompositing = false;
+    m_CompositeBitmap = 0;
+    m_CompositeScreen = 0;
 
     Clear();
 
@@ -54,6 +57,8 @@ GUIManager::~GUIManager()
 {
     delete m_pTimer;
     m_pTimer = 0;
+
+    DestroyCompositeSurface();
 }
 
 
@@ -65,6 +70,10 @@ GUIManager::~GUIManager()
 void GUIManager::Clear(void)
 {
     m_PanelList.clear();
+    m_DirtyRects.clear();
+    m_OpaqueRects.clear();
+    m_CompositedPanelRects.clear();
+    m_CompositedPanelVisibility.clear();
     m_CapturedPanel = 0;
     m_MouseOverPanel = 0;
     m_FocusPanel = 0;
@@ -177,6 +186,13 @@ void GUIManager::Update(void)
                 Buttons |= 1<<i;
         }
 
+        // Any mouse activity may change how the panel under the mouse (and whoever it signals) looks
+        if (m_UseCompositing && CurPanel && (DeltaX != 0 || DeltaY != 0 || Released != GUIPanel::MOUSE_NONE || Pushed != GUIPanel::MOUSE_NONE || Buttons != GUIPanel::MOUSE_NONE || MouseWheelChange != 0)) {
+            CurPanel->Invalidate();
+            if (CurPanel->GetParentPanel())
+                CurPanel->GetParentPanel()->Invalidate();
+        }
+
         // Mouse Up
         if (Released != GUIPanel::MOUSE_NONE) {
             if (CurPanel)
@@ -267,8 +283,11 @@ void GUIManager::Update(void)
 
         // OnMouseLeave
         if (Leave) {
-            if (m_MouseOverPanel)
+            if (m_MouseOverPanel) {
                 m_MouseOverPanel->OnMouseLeave(MouseX, MouseY, Buttons, Mod);
+                if (m_UseCompositing)
+                    m_MouseOverPanel->Invalidate();
+            }
         }
 
 		if (MouseWheelChange) {
@@ -293,8 +312,12 @@ void GUIManager::Update(void)
     if (!m_FocusPanel->IsEnabled())
         return;
 
+    bool KeyActivity = false;
 
     for(i=1; i<256; i++) {
+        if (KeyboardBuffer[i] == GUIInput::Pushed || KeyboardBuffer[i] == GUIInput::Released || KeyboardBuffer[i] == GUIInput::Repeat)
+            KeyActivity = true;
+
         switch(KeyboardBuffer[i]) {
             // KeyDown & KeyPress
             case GUIInput::Pushed:
@@ -313,6 +336,13 @@ void GUIManager::Update(void)
                 break;
         }
     }
+
+    // Key presses may change how the focused panel (and whoever it signals) looks
+    if (m_UseCompositing && KeyActivity && m_FocusPanel) {
+        m_FocusPanel->Invalidate();
+        if (m_FocusPanel->GetParentPanel())
+            m_FocusPanel->GetParentPanel()->Invalidate();
+    }
 }
 
 
@@ -323,6 +353,13 @@ void GUIManager::Update(void)
 
 void GUIManager::Draw(GUIScreen *Screen)
 {
+    // Let the focused panel animate, e.g. blink its text cursor
+    if (m_FocusPanel && m_FocusPanel->_GetVisible())
+        m_FocusPanel->UpdateWhileFocused();
+
+    if (m_UseCompositing && DrawComposited(Screen))
+        return;
+
     // Go through drawing panels that are invalid
     std::vector<GUIPanel *>::iterator it;
 
@@ -336,6 +373,162 @@ void GUIManager::Draw(GUIScreen *Screen)
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          EnableCompositing
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Enables and disables dirty-region compositing.
+
+void GUIManager::EnableCompositing(bool enable)
+{
+    m_UseCompositing = enable;
+
+    // The surface is recreated with everything dirty once compositing is used again
+    if (!m_UseCompositing)
+        DestroyCompositeSurface();
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          AddDirtyRect
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Marks a region of the screen as needing to be redrawn.
+
+void GUIManager::AddDirtyRect(const GUIRect *pRect)
+{
+    if (!m_UseCompositing || !pRect || pRect->right < pRect->left || pRect->bottom < pRect->top)
+        return;
+
+    // Merge into an existing rect if it's already covered, or if it covers an existing one
+    for (GUIRect &dirtyRect : m_DirtyRects) {
+        if (pRect->left >= dirtyRect.left && pRect->top >= dirtyRect.top && pRect->right <= dirtyRect.right && pRect->bottom <= dirtyRect.bottom)
+            return;
+        if (dirtyRect.left >= pRect->left && dirtyRect.top >= pRect->top && dirtyRect.right <= pRect->right && dirtyRect.bottom <= pRect->bottom) {
+            dirtyRect = *pRect;
+            return;
+        }
+    }
+    m_DirtyRects.push_back(*pRect);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DrawComposited
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Redraws the dirty regions of the cached surface and blits it to the
+//                  screen.
+
+bool GUIManager::DrawComposited(GUIScreen *Screen)
+{
+    GUIBitmap *pTarget = Screen->GetBitmap();
+    if (!pTarget)
+        return false;
+
+    GUIRect wholeRect;
+    SetRect(&wholeRect, 0, 0, pTarget->GetWidth() - 1, pTarget->GetHeight() - 1);
+
+    if (!m_CompositeBitmap || m_CompositeBitmap->GetWidth() != pTarget->GetWidth() || m_CompositeBitmap->GetHeight() != pTarget->GetHeight()) {
+        DestroyCompositeSurface();
+        m_CompositeBitmap = Screen->CreateBitmap(pTarget->GetWidth(), pTarget->GetHeight());
+        m_CompositeScreen = m_CompositeBitmap ? Screen->CreateScreen(m_CompositeBitmap) : 0;
+        if (!m_CompositeScreen) {
+            DestroyCompositeSurface();
+            return false;
+        }
+        m_DirtyRects.clear();
+        m_DirtyRects.push_back(wholeRect);
+    }
+
+    // Catch top level panels that were moved, resized or hidden without going through the invalidating setters
+    m_CompositedPanelRects.resize(m_PanelList.size());
+    m_CompositedPanelVisibility.resize(m_PanelList.size(), false);
+    for (int i = 0; i < m_PanelList.size(); ++i) {
+        GUIPanel *p = m_PanelList.at(i);
+        GUIRect panelRect = *p->GetRect();
+        if ((p->_GetVisible() && !p->IsValid()) || p->_GetVisible() != m_CompositedPanelVisibility.at(i) || memcmp(&panelRect, &m_CompositedPanelRects.at(i), sizeof(GUIRect)) != 0) {
+            if (m_CompositedPanelVisibility.at(i))
+                AddDirtyRect(&m_CompositedPanelRects.at(i));
+            AddDirtyRect(&panelRect);
+        }
+        m_CompositedPanelRects.at(i) = panelRect;
+        m_CompositedPanelVisibility.at(i) = p->_GetVisible();
+    }
+
+    GUIBitmap *pComposite = m_CompositeScreen->GetBitmap();
+    unsigned long maskColor = pComposite->GetMaskColor();
+
+    if (!m_DirtyRects.empty()) {
+        for (GUIRect dirtyRect : m_DirtyRects) {
+            dirtyRect.left = std::max(dirtyRect.left, wholeRect.left);
+            dirtyRect.top = std::max(dirtyRect.top, wholeRect.top);
+            dirtyRect.right = std::min(dirtyRect.right, wholeRect.right);
+            dirtyRect.bottom = std::min(dirtyRect.bottom, wholeRect.bottom);
+            if (dirtyRect.right < dirtyRect.left || dirtyRect.bottom < dirtyRect.top)
+                continue;
+
+            pComposite->SetClipRect(&dirtyRect);
+            pComposite->DrawRectangle(dirtyRect.left, dirtyRect.top, dirtyRect.right - dirtyRect.left + 1, dirtyRect.bottom - dirtyRect.top + 1, maskColor, true);
+
+            for (GUIPanel *p : m_PanelList) {
+                if (!p->_GetVisible())
+                    continue;
+                const GUIRect *pPanelRect = p->GetRect();
+                if (pPanelRect->right < dirtyRect.left || pPanelRect->left > dirtyRect.right || pPanelRect->bottom < dirtyRect.top || pPanelRect->top > dirtyRect.bottom)
+                    continue;
+                // Panels reset the clipping when they're done, so it has to be re-set for each
+                pComposite->SetClipRect(&dirtyRect);
+                p->Draw(m_CompositeScreen);
+            }
+        }
+        m_DirtyRects.clear();
+        pComposite->SetClipRect(0);
+
+        // Anything that changes which areas the opaque panels cover also dirties them, so they only have to be found again after a redraw
+        m_OpaqueRects.clear();
+        for (GUIPanel *p : m_PanelList) {
+            if (p->_GetVisible())
+                p->AddOpaqueRects(m_OpaqueRects, 0);
+        }
+    }
+
+    // Only the areas of the top level panels can hold anything, and the transparent blit skips whatever they didn't draw
+    for (int i = 0; i < m_PanelList.size(); ++i) {
+        if (!m_CompositedPanelVisibility.at(i))
+            continue;
+        // Panels are clipped to their rects including the right and bottom edges
+        GUIRect panelRect = m_CompositedPanelRects.at(i);
+        panelRect.right++;
+        panelRect.bottom++;
+        pComposite->DrawTrans(pTarget, panelRect.left, panelRect.top, &panelRect);
+    }
+    // Opaque panels cover their whole area, so any mask colored pixels in it were drawn on purpose and have to be copied too
+    for (GUIRect &opaqueRect : m_OpaqueRects)
+        pComposite->Draw(pTarget, opaqueRect.left, opaqueRect.top, &opaqueRect);
+    return true;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DestroyCompositeSurface
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Frees the cached surface used for compositing.
+
+void GUIManager::DestroyCompositeSurface()
+{
+    delete m_CompositeScreen;
+    m_CompositeScreen = 0;
+
+    if (m_CompositeBitmap) {
+        m_CompositeBitmap->Destroy();
+        delete m_CompositeBitmap;
+        m_CompositeBitmap = 0;
+    }
+    m_OpaqueRects.clear();
+
+    m_CompositedPanelRects.clear();
+    m_CompositedPanelVisibility.clear();
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          CaptureMouse
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -509,12 +702,17 @@ void GUIManager::TrackMouseHover(GUIPanel *Pan, bool Enabled, int Delay)
 void GUIManager::SetFocus(GUIPanel *Pan)
 {
     // Send the LoseFocus event to the old panel (if there is one)
-    if (m_FocusPanel)
+    // Panels draw themselves differently with and without focus, so both the old and the new one need redrawing
+    if (m_FocusPanel) {
         m_FocusPanel->OnLoseFocus();
+        m_FocusPanel->Invalidate();
+    }
 
     m_FocusPanel = Pan;
 
     // Send the GainFocus event to the new panel
-    if (m_FocusPanel)
+    if (m_FocusPanel) {
         m_FocusPanel->OnGainFocus();
+        m_FocusPanel->Invalidate();
+    }
 }
\ No newline at end of file
@@ -87,6 +87,28 @@ public:
     void Draw(GUIScreen *Screen);
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          EnableCompositing
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Enables and disables dirty-region compositing. When enabled, panels are
+//                  drawn into a cached surface and only the regions that have been
+//                  invalidated since the last draw are redrawn, after which the cached
+//                  surface is blitted to the screen.
+// Arguments:       Enable?
+
+    void EnableCompositing(bool enable = true);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          AddDirtyRect
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Marks a region of the screen as needing to be redrawn the next time
+//                  the panels are composited.
+// Arguments:       The rectangle to mark, in absolute screen coordinates.
+
+    void AddDirtyRect(const GUIRect *pRect);
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          EnableMouse
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -175,6 +197,27 @@ private:
 
     GUIPanel *FindTopPanel(int X, int Y);
 
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DrawComposited
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Redraws the dirty regions of the cached surface and blits it to the
+//                  screen.
+// Arguments:       Screen.
+// Return value:    Whether compositing could be done. If not, the caller should draw
+//                  the panels directly.
+
+    bool DrawComposited(GUIScreen *Screen);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DestroyCompositeSurface
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Frees the cached surface used for compositing.
+// Arguments:       None.
+
+    void DestroyCompositeSurface();
+
 /*
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          CreateTimer
@@ -228,6 +271,17 @@ private:
     float                   m_HoverTime;
 
     bool                    m_UseValidation;
+
+    // Dirty-region compositing
+    bool                    m_UseCompositing;
+    GUIBitmap               *m_CompositeBitmap;
+    GUIScreen               *m_CompositeScreen;
+    // The areas of the panels that cover them completely, which are copied from the composite including any mask colored pixels
+    std::vector<GUIRect>    m_OpaqueRects;
+    std::vector<GUIRect>    m_DirtyRects;
+    // The rectangles and visibility of the top level panels when they were last composited
+    std::vector<GUIRect>    m_CompositedPanelRects;
+    std::vector<bool>       m_CompositedPanelVisibility;
     int                     m_UniqueIDCount;
 
     // Timer
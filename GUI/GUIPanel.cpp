@@ -144,6 +144,7 @@ void GUIPanel::AddChild(GUIPanel *child, bool convertToAbsolutePos)
 
         // Add the child to the list
         m_Children.push_back(child);
+        child->Invalidate();
     }
 }
 
@@ -165,6 +166,7 @@ void GUIPanel::RemoveChild(const GUIPanel *pChild)
         GUIPanel *pPanel = *itr;
         if (pPanel && pPanel == pChild)
         {
+            pPanel->Invalidate();
             m_Children.erase(itr);
             break;
         }
@@ -199,6 +201,10 @@ void GUIPanel::LoadProperties(GUIProperties *Props)
 void GUIPanel::Invalidate(void)
 {
     m_ValidRegion = false;
+
+    // Let the manager know which area of the screen needs to be recomposited
+    if (m_Manager)
+        m_Manager->AddDirtyRect(GetRect());
 }
 
 
@@ -248,6 +254,36 @@ void GUIPanel::Draw(GUIScreen *Screen)
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          AddOpaqueRects
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Adds the visible areas of this panel and its children that are covered
+//                  completely when drawn.
+
+void GUIPanel::AddOpaqueRects(std::vector<GUIRect> &OpaqueRects, const GUIRect *pClip)
+{
+    // Same clipping as Draw, children only show within their parents
+    GUIRect thisClip = *GetRect();
+    if (pClip) {
+        thisClip.left = std::max(thisClip.left, pClip->left);
+        thisClip.top = std::max(thisClip.top, pClip->top);
+        thisClip.right = std::min(thisClip.right, pClip->right);
+        thisClip.bottom = std::min(thisClip.bottom, pClip->bottom);
+    }
+    if (thisClip.right <= thisClip.left || thisClip.bottom <= thisClip.top)
+        return;
+
+    if (IsOpaque())
+        OpaqueRects.push_back(thisClip);
+
+    std::vector<GUIPanel *>::iterator it;
+    for(it = m_Children.begin(); it != m_Children.end(); it++) {
+        if ((*it)->_GetVisible())
+            (*it)->AddOpaqueRects(OpaqueRects, &thisClip);
+    }
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          OnMouseDown
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -486,8 +522,10 @@ bool GUIPanel::PointInside(int X, int Y)
 
 void GUIPanel::SetSize(int Width, int Height)
 {
+    Invalidate();
     m_Width = Width;
     m_Height = Height;
+    Invalidate();
 }
 
 
@@ -501,9 +539,15 @@ void GUIPanel::SetPositionAbs(int X, int Y, bool moveChildren)
     int DX = X-m_X;
     int DY = Y-m_Y;
 
+    if (DX != 0 || DY != 0)
+        Invalidate();
+
     m_X = X;
     m_Y = Y;
 
+    if (DX != 0 || DY != 0)
+        Invalidate();
+
     // Move children
     if (moveChildren)
     {
@@ -591,6 +635,8 @@ void GUIPanel::CenterInParent(bool centerX, bool centerY)
 
 void GUIPanel::_SetVisible(bool Visible)
 {
+    if (m_Visible != Visible)
+        Invalidate();
     m_Visible = Visible;
 }
 
@@ -613,6 +659,8 @@ bool GUIPanel::_GetVisible(void)
 
 void GUIPanel::_SetEnabled(bool Enabled)
 {
+    if (m_Enabled != Enabled)
+        Invalidate();
     m_Enabled = Enabled;
 }
 
@@ -888,6 +936,7 @@ void GUIPanel::_ChangeZ(GUIPanel *Child, int Type)
         if (P)
             P->SetZPos(Count);
     }
+    Child->Invalidate();
 }
 
 
@@ -172,6 +172,36 @@ public:
     virtual void Draw(GUIScreen *Screen);
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual Method:  IsOpaque
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Checks if drawing the panel covers its whole rect, including any pixels
+//                  it draws in the mask color.
+// Arguments:       None.
+
+    virtual bool IsOpaque() { return false; }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Virtual Method:  UpdateWhileFocused
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Called once per frame while the panel has focus, for animations that
+//                  need it to be redrawn. The panel invalidates itself when they change.
+// Arguments:       None.
+
+    virtual void UpdateWhileFocused() {}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          AddOpaqueRects
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Adds the visible areas of this panel and its children that are covered
+//                  completely when drawn.
+// Arguments:       The list to add the areas to, the clipping rect of the parent or 0.
+
+    void AddOpaqueRects(std::vector<GUIRect> &OpaqueRects, const GUIRect *pClip);
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Virtual Method:  OnMouseDown
 //////////////////////////////////////////////////////////////////////////////////////////
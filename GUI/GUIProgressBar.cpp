@@ -149,6 +149,7 @@ void GUIProgressBar::ChangeSkin(GUISkin *Skin)
 
 void GUIProgressBar::BuildBitmap(void)
 {
+    Invalidate();
     // Free any old bitmaps
     if (m_DrawBitmap) {
         m_DrawBitmap->Destroy();
@@ -229,10 +230,12 @@ void GUIProgressBar::Draw(GUIScreen *Screen)
         Count = Count / (float)(m_IndicatorImage->GetWidth()+m_Spacing);
 
     // Setup the clipping
+    GUIRect OuterClip;
+    Screen->GetBitmap()->GetClipRect(&OuterClip);
     GUIRect Rect = *GetRect();
     Rect.left++;
     Rect.right-=2;
-    Screen->GetBitmap()->SetClipRect(&Rect);
+    Screen->GetBitmap()->AddClipRect(&Rect);
 
     int x = m_X+2;
     int Limit = (int)ceil(Count);
@@ -241,7 +244,7 @@ void GUIProgressBar::Draw(GUIScreen *Screen)
         x += m_IndicatorImage->GetWidth() + m_Spacing;
     }
 
-    Screen->GetBitmap()->SetClipRect(0);
+    Screen->GetBitmap()->SetClipRect(&OuterClip);
 
     GUIPanel::Draw(Screen);
 }
@@ -354,6 +357,7 @@ void GUIProgressBar::StoreProperties(void)
 
 void GUIProgressBar::SetValue(int Value)
 {
+    Invalidate();
     int OldValue = m_Value;
     m_Value = Value;
 
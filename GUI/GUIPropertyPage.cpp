@@ -198,6 +198,7 @@ void GUIPropertyPage::ChangeSkin(GUISkin *Skin)
 
 void GUIPropertyPage::BuildBitmap(void)
 {
+    Invalidate();
     // Free any old bitmap
     if (m_DrawBitmap) {
         m_DrawBitmap->Destroy();
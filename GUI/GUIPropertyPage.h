@@ -98,6 +98,16 @@ public:
     void Draw(GUIScreen *Screen) override;
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          IsOpaque
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Checks if drawing the panel covers its whole rect, including any pixels
+//                  it draws in the mask color.
+// Arguments:       None.
+
+    bool IsOpaque() override { return m_DrawBitmap != 0; }
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:  OnMouseDown
 //////////////////////////////////////////////////////////////////////////////////////////
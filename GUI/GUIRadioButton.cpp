@@ -121,6 +121,7 @@ void GUIRadioButton::ChangeSkin(GUISkin *Skin)
 
 void GUIRadioButton::BuildBitmap(void)
 {
+    Invalidate();
     string Filename;
     unsigned long ColorIndex = 0;
     int Values[4];
@@ -177,7 +178,9 @@ void GUIRadioButton::Draw(GUIScreen *Screen)
         return;
 
     // Setup the clipping
-    Screen->GetBitmap()->SetClipRect(GetRect());
+    GUIRect OuterClip;
+    Screen->GetBitmap()->GetClipRect(&OuterClip);
+    Screen->GetBitmap()->AddClipRect(GetRect());
 
     // Calculate the y position of the base
     // Make it centred vertically
@@ -222,7 +225,7 @@ void GUIRadioButton::Draw(GUIScreen *Screen)
     
 
 
-    Screen->GetBitmap()->SetClipRect(0);
+    Screen->GetBitmap()->SetClipRect(&OuterClip);
 
     GUIPanel::Draw(Screen);
 }
@@ -355,6 +358,7 @@ void GUIRadioButton::StoreProperties(void)
 
 void GUIRadioButton::SetCheck(bool Check)
 {
+    Invalidate();
     // Nothing to do if already in the same state
     if (m_Checked == Check)
         return;
@@ -148,6 +148,7 @@ void GUIScrollPanel::ChangeSkin(GUISkin *Skin)
 
 void GUIScrollPanel::BuildBitmap(bool UpdateSize, bool UpdateKnob)
 {
+    Invalidate();
     // It is normal if this function is called but the skin has not been set
     // So we just ignore the call if the skin has not been set
     if (!m_Skin)
@@ -364,6 +365,7 @@ void GUIScrollPanel::SetMaximum(int Max)
 
 void GUIScrollPanel::SetValue(int Value)
 {
+    Invalidate();
     m_Value = Value;
     m_Value = MAX(Value, m_Minimum);
     m_Value = MIN(Value, m_Maximum);
@@ -83,7 +83,7 @@ bool GUISkin::Load(const std::string Directory, const std::string Filename)
     // Go through the skin file adding the sections and properties
     GUIProperties *CurProp = 0;
     
-    while(!SkinFile.GetStream()->eof()) {
+    while(!SkinFile.IsEndOfFile()) {
         char line[512];
         SkinFile.ReadLine(line, 512);
 
@@ -173,6 +173,7 @@ void GUISlider::ChangeSkin(GUISkin *Skin)
 
 void GUISlider::BuildBitmap(void)
 {
+    Invalidate();
     // Free any old bitmaps
     if (m_DrawBitmap) {
         m_DrawBitmap->Destroy();
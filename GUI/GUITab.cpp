@@ -121,6 +121,7 @@ void GUITab::ChangeSkin(GUISkin *Skin)
 
 void GUITab::BuildBitmap(void)
 {
+    Invalidate();
     string Filename;
     unsigned long ColorIndex = 0;
     int Values[4];
@@ -177,7 +178,9 @@ void GUITab::Draw(GUIScreen *Screen)
         return;
 
     // Setup the clipping
-    Screen->GetBitmap()->SetClipRect(GetRect());
+    GUIRect OuterClip;
+    Screen->GetBitmap()->GetClipRect(&OuterClip);
+    Screen->GetBitmap()->AddClipRect(GetRect());
 
     // Calculate the y position of the base
     // Make it centred vertically
@@ -222,7 +225,7 @@ void GUITab::Draw(GUIScreen *Screen)
     
 
 
-    Screen->GetBitmap()->SetClipRect(0);
+    Screen->GetBitmap()->SetClipRect(&OuterClip);
 
     GUIPanel::Draw(Screen);
 }
@@ -369,6 +372,7 @@ void GUITab::StoreProperties(void)
 
 void GUITab::SetCheck(bool Check)
 {
+    Invalidate();
     // Nothing to do if already in the same state
     if (m_Selected == Check)
         return;
@@ -130,6 +130,20 @@ void GUITextPanel::ChangeSkin(GUISkin *Skin)
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          UpdateWhileFocused
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Advances the cursor blink and invalidates the panel when it toggles.
+
+void GUITextPanel::UpdateWhileFocused()
+{
+    bool wasShown = m_CursorBlinkCount % 30 > 15;
+    m_CursorBlinkCount++;
+    if ((m_CursorBlinkCount % 30 > 15) != wasShown)
+        Invalidate();
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          Draw
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -148,7 +162,9 @@ void GUITextPanel::Draw(GUIScreen *Screen)
     m_CursorX = MAX(m_CursorX, 0);
     
     // Setup the clipping
-    Screen->GetBitmap()->SetClipRect(GetRect());
+    GUIRect OuterClip;
+    Screen->GetBitmap()->GetClipRect(&OuterClip);
+    Screen->GetBitmap()->AddClipRect(GetRect());
     
     string Text = m_Text.substr(m_StartIndex);
 
@@ -177,13 +193,13 @@ void GUITextPanel::Draw(GUIScreen *Screen)
 
 
     // If we have focus, draw the cursor with hacky blink
-    if (m_GotFocus && (m_CursorBlinkCount++ % 30 > 15))
+    if (m_GotFocus && (m_CursorBlinkCount % 30 > 15))
     {
         Screen->GetBitmap()->DrawRectangle(m_X + m_CursorX + 2, m_Y + hSpacer + m_CursorY + 2, 1, FontHeight - 3, m_CursorColor, true);
     }
 
     // Restore normal clipping
-    Screen->GetBitmap()->SetClipRect(0);
+    Screen->GetBitmap()->SetClipRect(&OuterClip);
 }
 
 
@@ -571,6 +587,7 @@ void GUITextPanel::RemoveSelectionText(void)
 
 void GUITextPanel::SetCursorPos(int cursorPos)
 {
+    Invalidate();
     m_GotSelection = false;
 
     if (cursorPos <= 0)
@@ -611,6 +628,7 @@ string GUITextPanel::GetSelectionText(void)
 
 void GUITextPanel::SetText(const std::string Text)
 {
+    Invalidate();
     m_Text = Text;
 
     // Clear the selection
@@ -634,6 +652,7 @@ void GUITextPanel::SetText(const std::string Text)
 
 void GUITextPanel::SetRightText(const std::string rightText)
 {
+    Invalidate();
     m_RightText = rightText;
 
 //    UpdateText(false, false);
@@ -649,6 +668,7 @@ void GUITextPanel::SetRightText(const std::string rightText)
 
 void GUITextPanel::SetSelection(int Start, int End)
 {
+    Invalidate();
     if (m_Locked)
         return;
 
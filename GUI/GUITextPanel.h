@@ -87,6 +87,15 @@ public:
     void Draw(GUIScreen *Screen) override;
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          UpdateWhileFocused
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Advances the cursor blink and invalidates the panel when it toggles.
+// Arguments:       None.
+
+    void UpdateWhileFocused() override;
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          OnMouseDown
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +63,12 @@ namespace RTE {
 		/// <returns>Color depth. 8, 16, 32.</returns>
 		virtual int GetColorDepth() { return 0; }
 
+		/// <summary>
+		/// Gets the color that is skipped when this bitmap is drawn transparently.
+		/// </summary>
+		/// <returns>The mask color, in the color depth of this bitmap.</returns>
+		virtual unsigned long GetMaskColor() { return 0; }
+
 		/// <summary>
 		/// Sets the color key of the bitmap.
 		/// </summary>
@@ -188,6 +194,13 @@ namespace RTE {
 		/// <param name="Height">Height of bitmap.</param>
 		/// <returns>Created bitmap.</returns>
 		virtual GUIBitmap * CreateBitmap(int Width, int Height) = 0;
+
+		/// <summary>
+		/// Creates a screen that draws onto an existing bitmap, so panels can be rendered off-screen.
+		/// </summary>
+		/// <param name="pBitmap">The bitmap the new screen will draw onto. Must have been created by this screen. Ownership is NOT transferred!</param>
+		/// <returns>Created screen, or nullptr if this screen type doesn't support off-screen drawing.</returns>
+		virtual GUIScreen * CreateScreen(GUIBitmap *pBitmap) { return nullptr; }
 #pragma endregion
 
 #pragma region Destruction
@@ -36,6 +36,7 @@
 #include "MetagameGUI.h"
 
 #include "DataModule.h"
+#include "LoadProfiler.h"
 #include "SceneLayer.h"
 #include "MOSParticle.h"
 #include "MOSRotating.h"
@@ -358,6 +359,18 @@ bool PlayIntroTitle() {
     ContentFile alphaFile;
     BITMAP *pAlpha = 0;
 
+    // Loaded bitmaps can be shared with identical ones loaded from other files, so the alpha is added to copies of the sprites instead of the loaded ones
+    auto addAlphaToSpriteCopy = [&alphaFile](MOSprite *sprite, const std::string &alphaFilePath) {
+        BITMAP *spriteFrame = sprite->GetSpriteFrame(0);
+        BITMAP *spriteCopy = create_bitmap_ex(bitmap_color_depth(spriteFrame), spriteFrame->w, spriteFrame->h);
+        blit(spriteFrame, spriteCopy, 0, 0, 0, 0, spriteFrame->w, spriteFrame->h);
+        alphaFile.SetDataPath(alphaFilePath);
+        set_write_alpha_blender();
+        draw_trans_sprite(spriteCopy, alphaFile.GetAsBitmap(), 0, 0);
+        sprite->SetSpriteFrame(0, spriteCopy);
+        return spriteCopy;
+    };
+
     MOSParticle *pDRLogo = new MOSParticle();
     pDRLogo->Create(ContentFile("Base.rte/GUIs/Title/Intro/DRLogo5x.png"));
     pDRLogo->SetWrapDoubleDrawing(false);
@@ -378,25 +391,19 @@ bool PlayIntroTitle() {
     pTitleGlow->Create(ContentFile("Base.rte/GUIs/Title/TitleGlow.png"));
     pTitleGlow->SetWrapDoubleDrawing(false);
     // Add alpha
-    alphaFile.SetDataPath("Base.rte/GUIs/Title/TitleAlpha.png");
-    set_write_alpha_blender();
-    draw_trans_sprite(pTitle->GetSpriteFrame(0), alphaFile.GetAsBitmap(), 0, 0);
+    BITMAP *pTitleBitmap = addAlphaToSpriteCopy(pTitle, "Base.rte/GUIs/Title/TitleAlpha.png");
 
     MOSParticle *pPlanet = new MOSParticle();
     pPlanet->Create(ContentFile("Base.rte/GUIs/Title/Planet.png"));
     pPlanet->SetWrapDoubleDrawing(false);
     // Add alpha
-    alphaFile.SetDataPath("Base.rte/GUIs/Title/PlanetAlpha.png");
-    set_write_alpha_blender();
-    draw_trans_sprite(pPlanet->GetSpriteFrame(0), alphaFile.GetAsBitmap(), 0, 0);
+    BITMAP *pPlanetBitmap = addAlphaToSpriteCopy(pPlanet, "Base.rte/GUIs/Title/PlanetAlpha.png");
 
     MOSParticle *pMoon = new MOSParticle();
     pMoon->Create(ContentFile("Base.rte/GUIs/Title/Moon.png"));
     pMoon->SetWrapDoubleDrawing(false);
     // Add alpha
-    alphaFile.SetDataPath("Base.rte/GUIs/Title/MoonAlpha.png");
-    set_write_alpha_blender();
-    draw_trans_sprite(pMoon->GetSpriteFrame(0), alphaFile.GetAsBitmap(), 0, 0);
+    BITMAP *pMoonBitmap = addAlphaToSpriteCopy(pMoon, "Base.rte/GUIs/Title/MoonAlpha.png");
 
     MOSRotating *pStation = new MOSRotating();
     pStation->Create(ContentFile("Base.rte/GUIs/Title/Station.png"));
@@ -1526,6 +1533,12 @@ bool PlayIntroTitle() {
 	pPlanet = nullptr;
     delete pMoon;
 	pMoon = nullptr;
+	destroy_bitmap(pTitleBitmap);
+	pTitleBitmap = nullptr;
+	destroy_bitmap(pPlanetBitmap);
+	pPlanetBitmap = nullptr;
+	destroy_bitmap(pMoonBitmap);
+	pMoonBitmap = nullptr;
     delete pStation;
 	pStation = nullptr;
     delete[] stars;
@@ -1568,7 +1581,7 @@ bool RunGameLoop() {
 
 	while (!g_Quit) {
 		// Need to clear this out; sometimes background layers don't cover the whole back
-		g_FrameMan.ClearBackBuffer8();
+		if (!g_FrameMan.IsHeadless()) { g_FrameMan.ClearBackBuffer8(); }
 
 		// Update the real time measurement and increment
 		g_TimerMan.Update();
@@ -1641,11 +1654,12 @@ bool RunGameLoop() {
 				g_NetworkServer.Update();
 				serverUpdated = true;
 			}
-			if (g_SettingsMan.GetServerSimSleepWhenIdle()) {
+			// A dedicated server has no local frames to draw in the meantime, so always give the spare time back to the system
+			if (g_SettingsMan.GetServerSimSleepWhenIdle() || g_FrameMan.IsHeadless()) {
 				long long ticksToSleep = g_TimerMan.GetTimeToSleep();
 				if (ticksToSleep > 0) {
 					double secsToSleep = static_cast<double>(ticksToSleep) / static_cast<double>(g_TimerMan.GetTicksPerSecond());
-					long long milisToSleep = static_cast<long long>(secsToSleep) * 1000;
+					long long milisToSleep = static_cast<long long>(secsToSleep * 1000.0);
 					std::this_thread::sleep_for(std::chrono::milliseconds(milisToSleep));
 				}
 			}
@@ -1679,12 +1693,22 @@ bool HandleMainArgs(int argc, char *argv[], int &appExitVar) {
             // Print loading screen console to cout
 			if (std::strcmp(argv[i], "-cout") == 0) {
 				g_System.SetLogToCLI(true);
+			// Profile loading the modules regardless of the ProfileLoading setting, without saving it
+			} else if (std::strcmp(argv[i], "-profileloading") == 0) {
+				LoadProfiler::Start();
 			} else if (i + 1 < argc) {
 				// Launch game in server mode
                 if (std::strcmp(argv[i], "-server") == 0 && i + 1 < argc) {
                     std::string port = argv[++i];
                     g_NetworkServer.EnableServerMode();
                     g_NetworkServer.SetServerPort(port);
+				// Launch game as a dedicated server, without a local window
+				} else if (std::strcmp(argv[i], "-dedicated") == 0 && i + 1 < argc) {
+					std::string port = argv[++i];
+					g_NetworkServer.EnableServerMode();
+					g_NetworkServer.SetServerPort(port);
+					g_FrameMan.SetHeadless(true);
+					g_System.SetLogToCLI(true);
 				// Load a single module right after the official modules
                 } else if (std::strcmp(argv[i], "-module") == 0 && i + 1 < argc) {
 					g_PresetMan.SetSingleModuleToLoad(argv[++i]);
@@ -1708,6 +1732,7 @@ bool HandleMainArgs(int argc, char *argv[], int &appExitVar) {
 /// Implementation of the main function.
 /// </summary>
 int main(int argc, char *argv[]) {
+	g_System.SetExecutablePath(argv[0]);
 
 	///////////////////////////////////////////////////////////////////
     // Initialize Allegro
@@ -31,6 +31,10 @@ namespace RTE {
 			m_SoundEvents[i].clear();
 			m_MusicEvents[i].clear();
 		}
+		for (const std::pair<SoundContainer *, int> &pendingPlay : m_PendingSoundContainerPlays) {
+			pendingPlay.first->SetPlayPending(false);
+		}
+		m_PendingSoundContainerPlays.clear();
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,6 +129,8 @@ namespace RTE {
 
 			status = status == FMOD_OK ? m_AudioSystem->update() : status;
 
+			if (!m_PendingSoundContainerPlays.empty()) { UpdatePendingSoundContainerPlays(); }
+
 			if (!IsMusicPlaying() && m_SilenceTimer.IsPastRealTimeLimit()) { PlayNextStream(); }
 			if (status != FMOD_OK) { g_ConsoleMan.PrintString("ERROR: Could not update AudioMan due to FMOD error: " + std::string(FMOD_ErrorString(status))); }
 		}
@@ -514,7 +520,14 @@ namespace RTE {
 
 		if (!soundContainer->SoundPropertiesUpToDate()) {
 			result = soundContainer->UpdateSoundProperties();
-			if (result != FMOD_OK) {
+			// Sounds that are still loading in the background are played once they're ready
+			if (result == FMOD_ERR_NOTREADY) {
+				if (!soundContainer->IsPlayPending()) {
+					soundContainer->SetPlayPending(true);
+					m_PendingSoundContainerPlays.push_back({soundContainer, player});
+				}
+				return false;
+			} else if (result != FMOD_OK) {
 				g_ConsoleMan.PrintString("ERROR: Could not update sound properties for SoundContainer " + soundContainer->GetPresetName() + ": " + std::string(FMOD_ErrorString(result)));
 				return false;
 			}
@@ -564,6 +577,25 @@ namespace RTE {
 		return true;
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void AudioMan::UpdatePendingSoundContainerPlays() {
+		std::vector<std::pair<SoundContainer *, int>> pendingPlays;
+		pendingPlays.swap(m_PendingSoundContainerPlays);
+		for (const std::pair<SoundContainer *, int> &pendingPlay : pendingPlays) {
+			// Trying to play again either starts the sounds, puts the SoundContainer back in the list if they're still loading, or reports why they failed to load
+			pendingPlay.first->SetPlayPending(false);
+			PlaySoundContainer(pendingPlay.first, pendingPlay.second);
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void AudioMan::CancelPendingPlay(SoundContainer *soundContainer) {
+		m_PendingSoundContainerPlays.erase(std::remove_if(m_PendingSoundContainerPlays.begin(), m_PendingSoundContainerPlays.end(), [&soundContainer](const std::pair<SoundContainer *, int> &pendingPlay) { return pendingPlay.first == soundContainer; }), m_PendingSoundContainerPlays.end());
+		soundContainer->SetPlayPending(false);
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	bool AudioMan::ChangeSoundContainerPlayingChannelsPosition(const SoundContainer *soundContainer) {
@@ -407,6 +407,8 @@ namespace RTE {
 		std::list<NetworkSoundData> m_SoundEvents[c_MaxClients]; //!< Lists of per player sound events.
 		std::list<NetworkMusicData> m_MusicEvents[c_MaxClients]; //!< Lists of per player music events.
 
+		std::vector<std::pair<SoundContainer *, int>> m_PendingSoundContainerPlays; //!< SoundContainers that were played while their sounds were still loading, and the players they were played for. They start playing once their sounds are ready.
+
 		std::mutex g_SoundEventsListMutex[c_MaxClients]; //!< A list for locking sound events for multiplayer to avoid race conditions and other such problems.
 
 	private:
@@ -420,6 +422,17 @@ namespace RTE {
 		/// <returns>Whether or not playback of the Sound was successful.</returns>
 		bool PlaySoundContainer(SoundContainer *soundContainer, int player = -1);
 
+		/// <summary>
+		/// Starts playing the SoundContainers whose sounds were still loading when they were played, once their sounds are ready.
+		/// </summary>
+		void UpdatePendingSoundContainerPlays();
+
+		/// <summary>
+		/// Removes a SoundContainer from the ones waiting for their sounds to finish loading, so it won't start playing when they're ready.
+		/// </summary>
+		/// <param name="soundContainer">A pointer to a SoundContainer object. Ownership IS NOT transferred!</param>
+		void CancelPendingPlay(SoundContainer *soundContainer);
+
 		/// <summary>
 		/// Sets/updates the position of a SoundContainer's playing sounds.
 		/// </summary>
@@ -6,6 +6,7 @@
 #include "ConsoleMan.h"
 #include "SettingsMan.h"
 #include "UInputMan.h"
+#include "NetworkServer.h"
 
 #include "SLTerrain.h"
 #include "Scene.h"
@@ -46,11 +47,17 @@ namespace RTE {
 #elif __unix__
 		m_NumScreens = 1;
 		Display *dpy = XOpenDisplay(NULL);
-		XWindowAttributes ra;
-		XGetWindowAttributes(dpy, DefaultRootWindow(dpy), &ra);
-		m_ScreenResX = m_PrimaryScreenResX = ra.width;
-		m_ScreenResY = m_PrimaryScreenResY = ra.height;
-		XCloseDisplay(dpy);
+		if (dpy) {
+			XWindowAttributes ra;
+			XGetWindowAttributes(dpy, DefaultRootWindow(dpy), &ra);
+			m_ScreenResX = m_PrimaryScreenResX = ra.width;
+			m_ScreenResY = m_PrimaryScreenResY = ra.height;
+			XCloseDisplay(dpy);
+		} else {
+			// No display to query, which is expected when running as a dedicated server
+			m_ScreenResX = m_PrimaryScreenResX = 960;
+			m_ScreenResY = m_PrimaryScreenResY = 540;
+		}
 #endif
 		m_ResX = 960;
 		m_ResY = 540;
@@ -59,6 +66,12 @@ namespace RTE {
 		m_ResChanged = false;
 		m_Fullscreen = false;
 		m_ResMultiplier = 1;
+		m_DynamicResolution = false;
+		m_DynamicResolutionTargetFPS = 60;
+		m_DynamicResolutionMinScale = 0.5F;
+		m_RenderScale = 1.0F;
+		m_RenderScaleTimer.Reset();
+		m_ScaledPlayerScreen = nullptr;
 		m_HSplit = false;
 		m_VSplit = false;
 		m_HSplitOverride = false;
@@ -73,6 +86,7 @@ namespace RTE {
 		m_BackBuffer32 = nullptr;
 		m_DrawNetworkBackBuffer = false;
 		m_StoreNetworkBackBuffer = false;
+		m_Headless = false;
 		m_NetworkFrameCurrent = 0;
 		m_NetworkFrameReady = 1;
 		m_PaletteFile.Reset();
@@ -223,11 +237,16 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int FrameMan::Create() {
-		SetGraphicsDriver();
-		ValidateResolution(m_ResX, m_ResY, m_ResMultiplier);
+		if (m_Headless) {
+			// Nothing is ever presented locally, so don't set a graphics mode at all. This way no window or display (virtual or otherwise) is needed.
+			m_ResMultiplier = m_NewResMultiplier = 1;
+		} else {
+			SetGraphicsDriver();
+			ValidateResolution(m_ResX, m_ResY, m_ResMultiplier);
+		}
 		set_color_depth(m_BPP);
 
-		if (set_gfx_mode(m_GfxDriver, m_ResX * m_ResMultiplier, m_ResY * m_ResMultiplier, 0, 0) != 0) {
+		if (!m_Headless && set_gfx_mode(m_GfxDriver, m_ResX * m_ResMultiplier, m_ResY * m_ResMultiplier, 0, 0) != 0) {
 			// If a bad resolution somehow slipped past the validation, revert to defaults.
 			allegro_message("Unable to set specified graphics mode because: %s!\n\nNow trying to default back to VGA...", allegro_error);
 			if (set_gfx_mode(GFX_AUTODETECT_WINDOWED, 960, 540, 0, 0) != 0) {
@@ -241,13 +260,15 @@ namespace RTE {
 			m_ResMultiplier = m_NewResMultiplier = 1;
 		}
 			
-		// Clear the screen buffer so it doesn't flash pink
-		clear_to_color(screen, 0);
-
-		// Set the switching mode; what happens when the app window is switched to and from
-		set_display_switch_mode(SWITCH_BACKGROUND);
-		set_display_switch_callback(SWITCH_OUT, DisplaySwitchOut);
-		set_display_switch_callback(SWITCH_IN, DisplaySwitchIn);
+		if (!m_Headless) {
+			// Clear the screen buffer so it doesn't flash pink
+			clear_to_color(screen, 0);
+
+			// Set the switching mode; what happens when the app window is switched to and from
+			set_display_switch_mode(SWITCH_BACKGROUND);
+			set_display_switch_callback(SWITCH_OUT, DisplaySwitchOut);
+			set_display_switch_callback(SWITCH_IN, DisplaySwitchIn);
+		}
 
 		// Sets the allowed color conversions when loading bitmaps from files
 		set_color_conversion(COLORCONV_MOST);
@@ -313,7 +334,7 @@ namespace RTE {
 			m_PlayerScreenHeight = m_PlayerScreen->h;
 		}
 
-		m_ScreenDumpBuffer = create_bitmap_ex(24, screen->w, screen->h);
+		m_ScreenDumpBuffer = m_Headless ? create_bitmap_ex(24, m_ResX, m_ResY) : create_bitmap_ex(24, screen->w, screen->h);
 
 		return 0;
 	}
@@ -354,6 +375,14 @@ namespace RTE {
 			reader >> m_HSplitOverride;
 		} else if (propName == "VSplitScreen") {
 			reader >> m_VSplitOverride;
+		} else if (propName == "DynamicResolution") {
+			reader >> m_DynamicResolution;
+		} else if (propName == "DynamicResolutionTargetFPS") {
+			reader >> m_DynamicResolutionTargetFPS;
+			m_DynamicResolutionTargetFPS = std::max(m_DynamicResolutionTargetFPS, static_cast<unsigned short>(1));
+		} else if (propName == "DynamicResolutionMinScale") {
+			reader >> m_DynamicResolutionMinScale;
+			m_DynamicResolutionMinScale = Limit(m_DynamicResolutionMinScale, 1.0F, 0.25F);
 		} else if (propName == "PaletteFile") {
 			reader >> m_PaletteFile;
 		} else {
@@ -379,6 +408,12 @@ namespace RTE {
 		writer << m_HSplitOverride;
 		writer.NewProperty("VSplitScreen");
 		writer << m_VSplitOverride;
+		writer.NewProperty("DynamicResolution");
+		writer << m_DynamicResolution;
+		writer.NewProperty("DynamicResolutionTargetFPS");
+		writer << m_DynamicResolutionTargetFPS;
+		writer.NewProperty("DynamicResolutionMinScale");
+		writer << m_DynamicResolutionMinScale;
 		writer.NewProperty("PaletteFile");
 		writer << m_PaletteFile;
 
@@ -391,6 +426,7 @@ namespace RTE {
 		destroy_bitmap(m_BackBuffer8);
 		destroy_bitmap(m_BackBuffer32);
 		destroy_bitmap(m_PlayerScreen);
+		destroy_bitmap(m_ScaledPlayerScreen);
 		destroy_bitmap(m_ScreenDumpBuffer);
 		destroy_bitmap(m_WorldDumpBuffer);
 		destroy_bitmap(m_ScenePreviewDumpGradient);
@@ -681,6 +717,9 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void FrameMan::FlipFrameBuffers() const {
+		if (m_Headless) {
+			return;
+		}
 		if (m_ResMultiplier > 1) {
 			stretch_blit(m_BackBuffer32, screen, 0, 0, m_BackBuffer32->w, m_BackBuffer32->h, 0, 0, SCREEN_W, SCREEN_H);
 		} else {
@@ -993,9 +1032,48 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void FrameMan::UpdateRenderScale() {
+		if (!m_DynamicResolution || IsInMultiplayerMode() || !g_InActivity) {
+			m_RenderScale = 1.0F;
+			return;
+		}
+		if (!m_RenderScaleTimer.IsPastRealMS(c_RenderScaleAdjustInterval)) {
+			return;
+		}
+		m_RenderScaleTimer.Reset();
+
+		float targetMSPF = 1000.0F / static_cast<float>(m_DynamicResolutionTargetFPS);
+		float averageMSPF = static_cast<float>(g_PerformanceMan.GetMSPFAverage());
+
+		// Back off quickly when falling behind, but only creep back up when there's clear headroom so the scale doesn't keep bouncing around the target
+		if (averageMSPF > targetMSPF * 1.05F) {
+			m_RenderScale -= c_RenderScaleStep * 2.0F;
+		} else if (averageMSPF < targetMSPF * 0.85F) {
+			m_RenderScale += c_RenderScaleStep;
+		}
+		// Snap to whole steps so the scaled player screen only gets recreated when the scale actually changes
+		m_RenderScale = Limit(std::round(m_RenderScale / c_RenderScaleStep) * c_RenderScaleStep, 1.0F, m_DynamicResolutionMinScale);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	BITMAP * FrameMan::GetScaledPlayerScreen(int width, int height) {
+		if (!m_ScaledPlayerScreen || m_ScaledPlayerScreen->w != width || m_ScaledPlayerScreen->h != height) {
+			destroy_bitmap(m_ScaledPlayerScreen);
+			m_ScaledPlayerScreen = create_bitmap_ex(8, width, height);
+			clear_to_color(m_ScaledPlayerScreen, m_BlackColor);
+			set_clip_state(m_ScaledPlayerScreen, 1);
+		}
+		return m_ScaledPlayerScreen;
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void FrameMan::Draw() {
+		UpdateRenderScale();
+
 		// Count how many split screens we'll need
 		int screenCount = (m_HSplit ? 2 : 1) * (m_VSplit ? 2 : 1);
 		RTEAssert(screenCount <= 1 || m_PlayerScreen, "Splitscreen surface not ready when needed!");
@@ -1009,6 +1087,10 @@ namespace RTE {
 		const Activity *pActivity = g_ActivityMan.GetActivity();
 
 		for (int playerScreen = 0; playerScreen < screenCount; ++playerScreen) {
+			// Without a local window the only views worth drawing are the ones that get sent to a client
+			if (m_Headless && IsInMultiplayerMode() && !g_NetworkServer.IsPlayerConnected(playerScreen)) {
+				continue;
+			}
 			screenRelativeEffects.clear();
 			screenRelativeGlowBoxes.clear();
 
@@ -1020,6 +1102,13 @@ namespace RTE {
 			}
 			AllegroBitmap playerGUIBitmap(drawScreenGUI);
 
+			// When dynamic resolution has scaled down, the scene layers covering the same view are drawn to a smaller bitmap and stretched over the player screen afterwards.
+			// Everything drawn over the layers is still drawn at full resolution, so the view and anything that maps the screen to the scene stay the same.
+			BITMAP *sceneScreen = drawScreen;
+			if (m_RenderScale < 1.0F && !IsInMultiplayerMode()) {
+				sceneScreen = GetScaledPlayerScreen(static_cast<int>(static_cast<float>(drawScreen->w) * m_RenderScale), static_cast<int>(static_cast<float>(drawScreen->h) * m_RenderScale));
+			}
+
 			// Update the scene view to line up with a specific screen and then draw it onto the intermediate screen
 			g_SceneMan.Update(playerScreen);
 
@@ -1047,8 +1136,17 @@ namespace RTE {
 			m_TargetPos[m_NetworkFrameCurrent][playerScreen] = targetPos;
 
 			// Draw the scene
-			if (!IsInMultiplayerMode()) {
+			if (sceneScreen != drawScreen) {
+				g_SceneMan.DrawLayers(sceneScreen, false, false, m_RenderScale);
+				stretch_blit(sceneScreen, drawScreen, 0, 0, sceneScreen->w, sceneScreen->h, 0, 0, drawScreen->w, drawScreen->h);
+				g_SceneMan.DrawHUD(drawScreenGUI, targetPos);
+			} else if (!IsInMultiplayerMode()) {
 				g_SceneMan.Draw(drawScreen, drawScreenGUI, targetPos);
+			} else if (g_NetworkServer.IsReplicatingEntities()) {
+				// Clients draw the movables themselves from the entity states and aren't sent the scene layer, so only the HUDs need drawing
+				clear_to_color(drawScreen, g_MaskColor);
+				clear_to_color(drawScreenGUI, g_MaskColor);
+				g_SceneMan.DrawHUD(drawScreenGUI, targetPos);
 			} else {
 				clear_to_color(drawScreen, g_MaskColor);
 				clear_to_color(drawScreenGUI, g_MaskColor);
@@ -1114,10 +1212,13 @@ namespace RTE {
 
 		if (IsInMultiplayerMode()) { PrepareFrameForNetwork(); }
 
-		if (g_InActivity) { g_PostProcessMan.PostProcess(); }
+		// Post-processing and the console only end up in the 32bpp buffer that gets presented locally, so there's no point doing either without a window
+		if (!m_Headless) {
+			if (g_InActivity) { g_PostProcessMan.PostProcess(); }
 
-		// Draw the console on top of everything
-		g_ConsoleMan.Draw(m_BackBuffer32);
+			// Draw the console on top of everything
+			g_ConsoleMan.Draw(m_BackBuffer32);
+		}
 
 #ifdef DEBUG_BUILD
 		// Draw scene seam
@@ -196,6 +196,36 @@ namespace RTE {
 		/// <param name="endActivity">Whether the current Activity should be ended before performing the switch.</param>
 		/// <returns>Error code, anything other than 0 is an error.</returns>
 		int SwitchResolution(unsigned short newResX, unsigned short newResY, unsigned short newMultiplier = 1, bool endActivity = false);
+
+		/// <summary>
+		/// Gets whether dynamic resolution is enabled. When enabled, player screens are rendered at a reduced internal resolution and stretched to fit whenever the frame rate drops below the target.
+		/// </summary>
+		/// <returns>Whether dynamic resolution is enabled or not.</returns>
+		bool IsDynamicResolutionEnabled() const { return m_DynamicResolution; }
+
+		/// <summary>
+		/// Sets whether dynamic resolution is enabled. Disabling it immediately returns to rendering at full resolution.
+		/// </summary>
+		/// <param name="enable">Whether to enable dynamic resolution or not.</param>
+		void SetDynamicResolutionEnabled(bool enable) { m_DynamicResolution = enable; if (!enable) { m_RenderScale = 1.0F; } }
+
+		/// <summary>
+		/// Gets the frame rate dynamic resolution tries to hold.
+		/// </summary>
+		/// <returns>The target frame rate.</returns>
+		unsigned short GetDynamicResolutionTargetFPS() const { return m_DynamicResolutionTargetFPS; }
+
+		/// <summary>
+		/// Gets the lowest fraction of the player screen size dynamic resolution is allowed to render at.
+		/// </summary>
+		/// <returns>The minimum render scale, between 0.25 and 1.</returns>
+		float GetDynamicResolutionMinScale() const { return m_DynamicResolutionMinScale; }
+
+		/// <summary>
+		/// Gets the fraction of the player screen size the scene is currently rendered at.
+		/// </summary>
+		/// <returns>The current render scale. 1 when rendering at full resolution.</returns>
+		float GetRenderScale() const { return m_RenderScale; }
 #pragma endregion
 
 #pragma region Split-Screen Handling
@@ -392,6 +422,18 @@ namespace RTE {
 		/// <param name="value">Whether this manager should operate in multiplayer mode.</param>
 		void SetMultiplayerMode(bool value) { m_StoreNetworkBackBuffer = value; }
 
+		/// <summary>
+		/// Gets whether this manager is running without a local window, drawing only the views that are sent to network clients.
+		/// </summary>
+		/// <returns>Whether this manager is headless.</returns>
+		bool IsHeadless() const { return m_Headless; }
+
+		/// <summary>
+		/// Sets whether this manager should run without a local window. Has to be set before Create() to take effect.
+		/// </summary>
+		/// <param name="headless">Whether this manager should be headless.</param>
+		void SetHeadless(bool headless) { m_Headless = headless; }
+
 		/// <summary>
 		/// Gets the ready 8bpp backbuffer bitmap used to draw network transmitted image on top of everything.
 		/// </summary>
@@ -554,6 +596,8 @@ namespace RTE {
 		static const std::string c_ClassName; //!< The friendly-formatted type name of this object.
 
 		static constexpr unsigned short m_BPP = 32; //!< Color depth (bits per pixel).
+		static constexpr float c_RenderScaleStep = 0.05F; //!< How much the dynamic resolution render scale changes by in each adjustment.
+		static constexpr long c_RenderScaleAdjustInterval = 250; //!< Minimum time in real milliseconds between dynamic resolution render scale adjustments.
 
 		int m_GfxDriver; //!< The graphics driver that will be used for rendering.
 
@@ -578,6 +622,13 @@ namespace RTE {
 		bool m_Fullscreen; //!< Whether in fullscreen (borderless window) mode or not. True when resolution matches desktop.
 		bool m_UpscaledFullscreen; //!< Whether in upscaled fullscreen (borderless window) mode or not. True when multiplier equals 2 and resolution matches half of desktop. 
 
+		bool m_DynamicResolution; //!< Whether player screens are rendered at a reduced internal resolution when the frame rate drops below the target.
+		unsigned short m_DynamicResolutionTargetFPS; //!< The frame rate dynamic resolution tries to hold.
+		float m_DynamicResolutionMinScale; //!< The lowest fraction of the player screen size dynamic resolution is allowed to render at.
+		float m_RenderScale; //!< The fraction of the player screen size the scene is currently rendered at. 1 when rendering at full resolution.
+		Timer m_RenderScaleTimer; //!< Timer for limiting how often the render scale is adjusted, so the frame time average has time to react to each change.
+		BITMAP *m_ScaledPlayerScreen; //!< Intermediary bitmap the scene layers are drawn to when rendering at reduced resolution, stretched onto the player screen before the HUDs are drawn over them.
+
 		bool m_HSplit; //!< Whether the screen is split horizontally across the screen, ie as two splitscreens one above the other.
 		bool m_VSplit; //!< Whether the screen is split vertically across the screen, ie as two splitscreens side by side.
 		bool m_HSplitOverride; //!< Whether the screen is set to split horizontally in settings.
@@ -626,6 +677,7 @@ namespace RTE {
 		Vector m_TargetPos[2][c_MaxScreenCount]; //!< Frame target position for network players.
 
 		bool m_StoreNetworkBackBuffer; //!< If true, dumps the contents of the m_BackBuffer8 to the network backbuffers every frame.
+		bool m_Headless; //!< Whether there's no local window, so nothing is post-processed or presented locally. Used by dedicated servers.
 		bool m_DrawNetworkBackBuffer; //!< If true, draws the contents of the network backbuffers on top of m_BackBuffer8 every frame in FrameMan.Draw.
 
 		unsigned short m_NetworkFrameCurrent; //!< Which frame index is being rendered, 0 or 1.
@@ -701,6 +753,19 @@ namespace RTE {
 #pragma endregion
 
 #pragma region Draw Breakdown
+		/// <summary>
+		/// Raises or lowers the dynamic resolution render scale according to how the average frame time compares to the target. This is called during Draw().
+		/// </summary>
+		void UpdateRenderScale();
+
+		/// <summary>
+		/// Gets the intermediary bitmap to draw the scene to when rendering at reduced resolution, recreating it if the requested size changed.
+		/// </summary>
+		/// <param name="width">Width of the scaled player screen.</param>
+		/// <param name="height">Height of the scaled player screen.</param>
+		/// <returns>The scaled player screen bitmap.</returns>
+		BITMAP * GetScaledPlayerScreen(int width, int height);
+
 		/// <summary>
 		/// Updates the drawing position of each player screen on the backbuffer when split screen is active. This is called during Draw().
 		/// </summary>
@@ -1,5 +1,6 @@
 #include "LuaMan.h"
 #include "System.h"
+#include "LoadProfiler.h"
 
 #include "ACDropShip.h"
 #include "ACrab.h"
@@ -2460,6 +2461,7 @@ int LuaMan::RunScriptFile(const std::string &filePath, bool consoleErrors) {
         return -1;
     }
     int error = 0;
+    int profilerSection = LoadProfiler::BeginSection(LoadProfiler::LuaScriptSection, filePath);
 
     lua_pushcfunction(m_pMasterState, &AddFileAndLineToError);
     try {
@@ -2485,6 +2487,7 @@ int LuaMan::RunScriptFile(const std::string &filePath, bool consoleErrors) {
 
     // Pop the file and line error handler off the stack to clean it up
     lua_pop(m_pMasterState, 1);
+    LoadProfiler::EndSection(profilerSection);
 
     return error;
 }
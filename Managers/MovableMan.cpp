@@ -2163,6 +2163,27 @@ void MovableMan::Draw(BITMAP *pTargetBitmap, const Vector &targetPos)
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetObjectsInDrawOrder
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gathers all root MovableObject:s of this MovableMan in the same order
+//                  Draw draws them in. Attachables are not included.
+
+void MovableMan::GetObjectsInDrawOrder(std::vector<const MovableObject *> &objectList) const
+{
+    objectList.reserve(objectList.size() + m_Particles.size() + m_Items.size() + m_Actors.size());
+
+    for (deque<MovableObject *>::const_iterator parIt = m_Particles.begin(); parIt != m_Particles.end(); ++parIt)
+        objectList.push_back(*parIt);
+
+    for (deque<MovableObject *>::const_reverse_iterator itmIt = m_Items.rbegin(); itmIt != m_Items.rend(); ++itmIt)
+        objectList.push_back(*itmIt);
+
+    for (deque<Actor *>::const_reverse_iterator aIt = m_Actors.rbegin(); aIt != m_Actors.rend(); ++aIt)
+        objectList.push_back(*aIt);
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          DrawHUD
 //////////////////////////////////////////////////////////////////////////////////////////
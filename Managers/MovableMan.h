@@ -838,6 +838,18 @@ public:
     void Draw(BITMAP *pTargetBitmap, const Vector &targetPos = Vector());
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetObjectsInDrawOrder
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gathers all root MovableObject:s of this MovableMan in the same order
+//                  Draw draws them in. Attachables are not included.
+// Arguments:       The list to add the MovableObject:s to. It is not cleared first.
+//                  Ownership of the MovableObject:s is NOT transferred!
+// Return value:    None.
+
+    void GetObjectsInDrawOrder(std::vector<const MovableObject *> &objectList) const;
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          DrawHUD
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -5,10 +5,14 @@
 #include "SettingsMan.h"
 #include "PerformanceMan.h"
 #include "UInputMan.h"
+#include "PresetMan.h"
+#include "MOSprite.h"
+#include "ContentFile.h"
 
 #include "RakSleep.h"
 
 #include "NetworkClient.h"
+
 #include <lz4.h>
 
 namespace RTE {
@@ -62,6 +66,40 @@ namespace RTE {
 			delete soundEntry.second;
 		}
 		m_ServerSounds.clear();
+
+		for (int layer = 0; layer < 2; layer++) {
+			m_ReceivedBoxFrameNumbers[layer].clear();
+		}
+
+		m_ReplicateEntities = false;
+		m_EntityPresets.clear();
+		m_EntityStates.clear();
+		m_ReceivedEntityStates.clear();
+		m_ReceivedEntityStateFrameNumber = 0;
+		m_ReceivedEntityStateCount = 0;
+
+		m_ReceiveThreadRunning = false;
+		m_FrameDecodeJobs.clear();
+		m_FrameDecodeJobAreas.clear();
+		m_ReceivedPackets.clear();
+		m_DecodingFrameSetupReceived = false;
+		m_CompleteFrameNumber = 0;
+		m_NewFrameComplete = false;
+		m_PresentedFrameBitmap = 0;
+		m_PresentedGUIFrameBitmap = 0;
+		m_PresentedTargetPos.Reset();
+		for (int i = 0; i < c_MaxLayersStoredForNetwork; i++) {
+			m_PresentedLayerOffsets[i].Reset();
+		}
+		m_DrawFrameBoxOutlines = false;
+
+		m_InputSequence = 0;
+		m_UnacknowledgedMouseMovement.clear();
+		m_InputOverlay = MsgInputOverlay();
+		m_InputOverlayReceived = false;
+		m_ViewShift.Reset();
+		m_LastViewShiftUpdateTime = 0;
+		m_PieCursorBitmap = 0;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,6 +113,15 @@ namespace RTE {
 		return 0;
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::Destroy() {
+		StopReceiveThread();
+		if (m_PresentedFrameBitmap) { destroy_bitmap(m_PresentedFrameBitmap); }
+		if (m_PresentedGUIFrameBitmap) { destroy_bitmap(m_PresentedGUIFrameBitmap); }
+		Clear();
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void NetworkClient::Connect(std::string serverName, unsigned short serverPort, std::string playerName) {
@@ -86,6 +133,7 @@ namespace RTE {
 		m_Client->SetOccasionalPing(true);
 		m_PlayerName = playerName;
 		RakNet::ConnectionAttemptResult connectionAttempt = m_Client->Connect(serverName.c_str(), serverPort, NULL, 0);
+		StartReceiveThread();
 
 		g_ConsoleMan.PrintString((connectionAttempt == RakNet::CONNECTION_ATTEMPT_STARTED) ? "CLIENT: Connect request sent" : "CLIENT: Unable to connect");
 	}
@@ -112,6 +160,7 @@ namespace RTE {
 		RakSleep(250);
 		RakNet::AddressOrGUID addr = m_Client->GetSystemAddressFromIndex(0);
 		m_Client->CloseConnection(addr, true);
+		StopReceiveThread();
 		g_ConsoleMan.PrintString("CLIENT: Disconnect");
 	}
 
@@ -128,7 +177,10 @@ namespace RTE {
 		m_Client->SetOccasionalPing(true);
 		m_PlayerName = playerName;
 		g_ConsoleMan.PrintString("CLIENT: Connect request sent");
+		// ConnectBlocking receives packets itself, so it can't run alongside the receive thread
+		StopReceiveThread();
 		m_NATServiceServerID = ConnectBlocking(m_Client, serviceServerName.c_str(), serviceServerPort);
+		StartReceiveThread();
 
 		if (m_NATServiceServerID == RakNet::UNASSIGNED_SYSTEM_ADDRESS) {
 			g_ConsoleMan.PrintString("CLIENT: Unable to connect");
@@ -160,6 +212,104 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::StartReceiveThread() {
+		if (m_ReceiveThreadRunning) {
+			return;
+		}
+		// Leave a core each for the main and receive threads
+		m_FrameDecoderPool.Create(std::max(std::thread::hardware_concurrency(), 3U) - 2);
+		m_ReceiveThreadRunning = true;
+		m_ReceiveThread = std::thread(ReceiveThreadFunction, this);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::StopReceiveThread() {
+		m_ReceiveThreadRunning = false;
+		if (m_ReceiveThread.joinable()) { m_ReceiveThread.join(); }
+		m_FrameDecoderPool.Destroy();
+
+		m_ReceivedPacketMutex.lock();
+		for (RakNet::Packet *packet : m_ReceivedPackets) {
+			m_Client->DeallocatePacket(packet);
+		}
+		m_ReceivedPackets.clear();
+		m_ReceivedPacketMutex.unlock();
+
+		m_DecodingFrameSetupReceived = false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::ReceiveThreadFunction(NetworkClient *client) {
+		while (client->m_ReceiveThreadRunning) {
+			RakNet::Packet *packet = client->m_Client->Receive();
+			if (!packet) {
+				RakSleep(1);
+				continue;
+			}
+
+			switch (client->GetPacketIdentifier(packet)) {
+				case ID_SRV_FRAME_SETUP:
+					client->ReceiveFrameSetupMsg(packet);
+					client->m_Client->DeallocatePacket(packet);
+					break;
+				case ID_SRV_FRAME_LINE:
+					client->ReceiveFrameLineMsg(packet);
+					break;
+				case ID_SRV_FRAME_BOX:
+					client->ReceiveFrameBoxMsg(packet);
+					break;
+				case ID_SRV_SCENE_SETUP:
+					// The server starts sending every box in full after a scene setup, so previously received boxes can't be used as delta references anymore
+					client->WaitForFrameDecodeJobs();
+					for (int layer = 0; layer < 2; layer++) {
+						client->m_ReceivedBoxFrameNumbers[layer].clear();
+					}
+					clear_to_color(g_FrameMan.GetNetworkBackBufferIntermediateGUI8Current(0), g_MaskColor);
+					client->QueueReceivedPacket(packet);
+					break;
+				default:
+					client->QueueReceivedPacket(packet);
+					break;
+			}
+		}
+		client->WaitForFrameDecodeJobs();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::DispatchFrameDecodeJob(RakNet::Packet *packet, unsigned int area, void (NetworkClient::*decodeFunction)(const RakNet::Packet *packet)) {
+		if (!m_FrameDecodeJobAreas.insert(area).second) {
+			WaitForFrameDecodeJobs();
+			m_FrameDecodeJobAreas.insert(area);
+		}
+		m_FrameDecodeJobs.push_back(m_FrameDecoderPool.AddJob([this, packet, decodeFunction]() {
+			(this->*decodeFunction)(packet);
+			m_Client->DeallocatePacket(packet);
+		}));
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::WaitForFrameDecodeJobs() {
+		for (std::future<void> &decodeJob : m_FrameDecodeJobs) {
+			decodeJob.wait();
+		}
+		m_FrameDecodeJobs.clear();
+		m_FrameDecodeJobAreas.clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::QueueReceivedPacket(RakNet::Packet *packet) {
+		m_ReceivedPacketMutex.lock();
+		m_ReceivedPackets.push_back(packet);
+		m_ReceivedPacketMutex.unlock();
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	unsigned char NetworkClient::GetPacketIdentifier(RakNet::Packet *packet) const {
@@ -227,11 +377,16 @@ namespace RTE {
 	void NetworkClient::SendInputMsg() {
 		MsgInput msg;
 		msg.Id = ID_CLT_INPUT;
+		msg.InputSequence = ++m_InputSequence;
 
 		Vector mouse = g_UInputMan.GetNetworkAccumulatedRawMouseMovement(0);
 		msg.MouseX = static_cast<int>(mouse.GetX());
 		msg.MouseY = static_cast<int>(mouse.GetY());
 
+		// Keep the movement around until the server acknowledges it, so the locally drawn overlays can be predicted from it in the meantime
+		m_UnacknowledgedMouseMovement.emplace_back(msg.InputSequence, Vector(static_cast<float>(msg.MouseX), static_cast<float>(msg.MouseY)));
+		if (m_UnacknowledgedMouseMovement.size() > c_MaxUnacknowledgedInputs) { m_UnacknowledgedMouseMovement.pop_front(); }
+
 		// Those are update in Update every frame to catch short events like clicks and releases
 		msg.MouseButtonPressed[MOUSE_LEFT] = m_MouseButtonPressedState[MOUSE_LEFT] == 1 ? true : false;
 		msg.MouseButtonPressed[MOUSE_MIDDLE] = m_MouseButtonPressedState[MOUSE_MIDDLE] == 1 ? true : false;
@@ -281,121 +436,104 @@ namespace RTE {
 			return;
 		}
 
-		DrawFrame();
+		// A new frame starting means everything of the previous one arrived, so once it's decoded hand it over for presenting
+		if (m_DecodingFrameSetupReceived) {
+			WaitForFrameDecodeJobs();
 
-		m_PostEffects[m_CurrentFrame].clear();
-		m_CurrentFrame = frameData->FrameNumber;
+			BITMAP *decodeBuffer = g_FrameMan.GetNetworkBackBufferIntermediate8Current(0);
+			BITMAP *decodeGUIBuffer = g_FrameMan.GetNetworkBackBufferIntermediateGUI8Current(0);
+			int frame = m_DecodingFrameSetup.FrameNumber;
 
-		m_TargetPos[m_CurrentFrame].m_X = frameData->TargetPosX;
-		m_TargetPos[m_CurrentFrame].m_Y = frameData->TargetPosY;
+			m_FrameMutex.lock();
+			blit(decodeBuffer, g_FrameMan.GetNetworkBackBufferIntermediate8Ready(0), 0, 0, 0, 0, decodeBuffer->w, decodeBuffer->h);
+			blit(decodeGUIBuffer, g_FrameMan.GetNetworkBackBufferIntermediateGUI8Ready(0), 0, 0, 0, 0, decodeGUIBuffer->w, decodeGUIBuffer->h);
 
-		for (int i = 0; i < c_MaxLayersStoredForNetwork; i++) {
-			m_BackgroundLayers[m_CurrentFrame][i].OffsetX = frameData->OffsetX[i];
-			m_BackgroundLayers[m_CurrentFrame][i].OffsetY = frameData->OffsetY[i];
+			m_TargetPos[frame].m_X = m_DecodingFrameSetup.TargetPosX;
+			m_TargetPos[frame].m_Y = m_DecodingFrameSetup.TargetPosY;
+
+			for (int i = 0; i < c_MaxLayersStoredForNetwork; i++) {
+				m_BackgroundLayers[frame][i].OffsetX = m_DecodingFrameSetup.OffsetX[i];
+				m_BackgroundLayers[frame][i].OffsetY = m_DecodingFrameSetup.OffsetY[i];
+			}
+			m_CompleteFrameNumber = frame;
+			m_NewFrameComplete = true;
+			m_FrameMutex.unlock();
 		}
+		m_DecodingFrameSetup = *frameData;
+		m_DecodingFrameSetupReceived = true;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void NetworkClient::ReceiveFrameLineMsg(RakNet::Packet *packet) {
 		const MsgFrameLine *frameData = (MsgFrameLine *)packet->data;
-		int lineNumber = frameData->LineNumber;
-		m_CurrentSceneLayerReceived = -1;
+
+		if (!IsFrameLineValid(frameData, packet->length, g_FrameMan.GetNetworkBackBufferIntermediate8Current(0)->h)) {
+			m_Client->DeallocatePacket(packet);
+			return;
+		}
+		m_ReceivedData += frameData->DataSize;
+		m_CompressedData += frameData->UncompressedSize;
+
+		DispatchFrameDecodeJob(packet, (static_cast<unsigned int>(frameData->Layer) << 30) | frameData->LineNumber, &NetworkClient::DecodeFrameLineMsg);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::DecodeFrameLineMsg(const RakNet::Packet *packet) {
+		const MsgFrameLine *frameData = (MsgFrameLine *)packet->data;
 
 		BITMAP *bmp = 0;
 
 		if (frameData->Layer == 0) {
-			bmp = g_FrameMan.GetNetworkBackBufferIntermediate8Ready(0);
+			bmp = g_FrameMan.GetNetworkBackBufferIntermediate8Current(0);
 		} else if (frameData->Layer == 1) {
-			bmp = g_FrameMan.GetNetworkBackBufferIntermediateGUI8Ready(0);
+			bmp = g_FrameMan.GetNetworkBackBufferIntermediateGUI8Current(0);
 		}
 
 		acquire_bitmap(bmp);
+		DecodeFrameLine(frameData, bmp->line, bmp->w, bmp->h);
+		release_bitmap(bmp);
+	}
 
-		int width = frameData->DataSize;
-		int pixels = std::min(bmp->w, width);
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::ReceiveFrameBoxMsg(RakNet::Packet *packet) {
+		const MsgFrameBox *frameData = (MsgFrameBox *)packet->data;
+		const BITMAP *bmp = g_FrameMan.GetNetworkBackBufferIntermediate8Current(0);
 
+		// Validated here rather than by the decoders, since this has to happen in the order the boxes were received
+		if (ValidateFrameBox(frameData, packet->length, bmp->w, bmp->h, m_ReceivedBoxFrameNumbers) != FrameBoxValidation::Accepted) {
+			m_Client->DeallocatePacket(packet);
+			return;
+		}
 		m_ReceivedData += frameData->DataSize;
 		m_CompressedData += frameData->UncompressedSize;
 
-		if (lineNumber < bmp->h) {
-			if (frameData->DataSize == 0) {
-				memset(bmp->line[lineNumber], g_MaskColor, bmp->w);
-			} else {
-				if (frameData->DataSize == frameData->UncompressedSize) {
-#ifdef _WIN32
-					memcpy_s(bmp->line[lineNumber], bmp->w, packet->data + sizeof(MsgFrameLine), pixels);
-#else
-					//Fallback to non safe memcpy
-					memcpy(bmp->line[lineNumber], packet->data + sizeof(MsgFrameLine), pixels);
-#endif
-				} else {
-					LZ4_decompress_safe((char *)(packet->data + sizeof(MsgFrameLine)), (char *)(bmp->line[lineNumber]), frameData->DataSize, bmp->w);
-				}
-			}
-		}
-		release_bitmap(bmp);
+		int bpx = frameData->BoxX;
+		int bpy = frameData->BoxY;
+		DispatchFrameDecodeJob(packet, (static_cast<unsigned int>(frameData->Layer) << 30) | (static_cast<unsigned int>(bpy) << 15) | static_cast<unsigned int>(bpx), &NetworkClient::DecodeFrameBoxMsg);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void NetworkClient::ReceiveFrameBoxMsg(RakNet::Packet *packet) {
+	void NetworkClient::DecodeFrameBoxMsg(const RakNet::Packet *packet) {
 		const MsgFrameBox *frameData = (MsgFrameBox *)packet->data;
-		int bpx = frameData->BoxX;
-		int bpy = frameData->BoxY;
-		m_CurrentSceneLayerReceived = -1;
 
 		BITMAP *bmp = 0;
 
 		if (frameData->Layer == 0) {
-			bmp = g_FrameMan.GetNetworkBackBufferIntermediate8Ready(0);
+			bmp = g_FrameMan.GetNetworkBackBufferIntermediate8Current(0);
 		} else if (frameData->Layer == 1) {
-			bmp = g_FrameMan.GetNetworkBackBufferIntermediateGUI8Ready(0);
+			bmp = g_FrameMan.GetNetworkBackBufferIntermediateGUI8Current(0);
 		}
 
 		acquire_bitmap(bmp);
-
-		int maxWidth = frameData->BoxWidth;
-		int maxHeight = frameData->BoxHeight;
-		int size = frameData->DataSize;
-
-		m_ReceivedData += frameData->DataSize;
-		m_CompressedData += frameData->UncompressedSize;
-
-		if (bpx + maxWidth - 1 < bmp->w && bpy + maxHeight - 1 < bmp->h && bpx >= 0 && bpy >= 0) {
-			// Unpack box
-			if (frameData->DataSize == 0) {
-				//memset(bmp->line[lineNumber], g_MaskColor, bmp->w);
-				rectfill(bmp, bpx, bpy, bpx + maxWidth - 1, bpy + maxHeight - 1, g_MaskColor);
-			} else {
-				if (frameData->DataSize == frameData->UncompressedSize) {
-#ifdef _WIN32
-					memcpy_s(m_PixelLineBuffer, size, packet->data + sizeof(MsgFrameBox), size);
-#else
-					// Fallback to unsafe memcpy
-					memcpy(m_PixelLineBuffer, packet->data + sizeof(MsgFrameBox), size);
-#endif
-
-				} else {
-					LZ4_decompress_safe((char *)(packet->data + sizeof(MsgFrameBox)), (char *)(m_PixelLineBuffer), size, frameData->UncompressedSize);
-				}
-				// Copy box to bitmap line by line
-				const unsigned char *lineAddr = m_PixelLineBuffer;
-				for (int y = 0; y < maxHeight; y++) {
-#ifdef _WIN32
-					memcpy_s(bmp->line[bpy + y] + bpx, maxWidth, lineAddr, maxWidth);
-#else
-					memcpy(bmp->line[bpy + y] + bpx, lineAddr, maxWidth);
-#endif
-
-					lineAddr += maxWidth;
-				}
+		DecodeFrameBox(frameData, bmp->line);
 
 #ifndef RELEASE_BUILD
-				if (g_UInputMan.KeyHeld(KEY_0)) { rect(bmp, bpx, bpy, bpx + maxWidth - 1, bpy + maxHeight - 1, g_BlackColor); }
+		if (frameData->DataSize > 0 && m_DrawFrameBoxOutlines) { rect(bmp, frameData->BoxX, frameData->BoxY, frameData->BoxX + frameData->BoxWidth - 1, frameData->BoxY + frameData->BoxHeight - 1, g_BlackColor); }
 #endif
-			}
-		}
 		release_bitmap(bmp);
 	}
 
@@ -459,13 +597,23 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void NetworkClient::ReceiveSceneSetupMsg(RakNet::Packet *packet) {
+		// The receive thread already reset the frame being received, only the completed one is left
+		m_FrameMutex.lock();
 		clear_to_color(g_FrameMan.GetNetworkBackBufferIntermediateGUI8Ready(0), g_MaskColor);
+		m_FrameMutex.unlock();
+		if (m_PresentedGUIFrameBitmap) { clear_to_color(m_PresentedGUIFrameBitmap, g_MaskColor); }
 		clear_to_color(g_FrameMan.GetNetworkBackBufferGUI8Ready(0), g_MaskColor);
 
 		const MsgSceneSetup *frameData = (MsgSceneSetup *)packet->data;
 
 		m_SceneID = frameData->SceneId;
 
+		// The server resends all entity presets after a scene setup
+		m_ReplicateEntities = frameData->ReplicateEntities;
+		m_EntityPresets.clear();
+		m_EntityStates.clear();
+		m_ReceivedEntityStates.clear();
+
 		if (m_SceneBackgroundBitmap) { destroy_bitmap(m_SceneBackgroundBitmap); }
 		if (m_SceneForegroundBitmap) { destroy_bitmap(m_SceneForegroundBitmap); }
 
@@ -481,6 +629,9 @@ namespace RTE {
 
 		m_ActiveBackgroundLayers = frameData->BackgroundLayerCount;
 
+		// The receive thread writes the layer offsets of each completed frame
+		std::lock_guard<std::mutex> frameLock(m_FrameMutex);
+
 		for (int i = 0; i < m_ActiveBackgroundLayers; i++) {
 			size_t hash = frameData->BackgroundLayers[i].BitmapHash;
 			std::string bitmapPath = ContentFile::GetPathFromHash(hash);
@@ -495,6 +646,7 @@ namespace RTE {
 				m_BackgroundLayers[f][i].DrawTrans = frameData->BackgroundLayers[i].DrawTrans;
 				m_BackgroundLayers[f][i].OffsetX = frameData->BackgroundLayers[i].OffsetX;
 				m_BackgroundLayers[f][i].OffsetY = frameData->BackgroundLayers[i].OffsetY;
+				m_PresentedLayerOffsets[i].SetXY(frameData->BackgroundLayers[i].OffsetX, frameData->BackgroundLayers[i].OffsetY);
 
 				m_BackgroundLayers[f][i].ScrollInfoX = frameData->BackgroundLayers[i].ScrollInfoX;
 				m_BackgroundLayers[f][i].ScrollInfoY = frameData->BackgroundLayers[i].ScrollInfoY;
@@ -532,36 +684,57 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void NetworkClient::ReceiveTerrainChangeMsg(RakNet::Packet *packet) {
-		const MsgTerrainChange *frameData = (MsgTerrainChange *)packet->data;
-		if (frameData->SceneId != m_SceneID) {
+		if (packet->length < sizeof(MsgTerrainChange)) {
+			return;
+		}
+		const MsgTerrainChange *msg = (MsgTerrainChange *)packet->data;
+		if (msg->SceneId != m_SceneID || !m_SceneBackgroundBitmap || !m_SceneForegroundBitmap) {
 			return;
 		}
 
-		if (frameData->W == 1 && frameData->H == 1) {
-			BITMAP *bmp = 0;
-			bmp = frameData->Back ? m_SceneBackgroundBitmap : m_SceneForegroundBitmap;
-			putpixel(bmp, frameData->X, frameData->Y, frameData->Color);
-		} else {
-			int size = frameData->UncompressedSize;
+		// The data has to be in the packet, and it can't unpack to more than every tile changing pixel by pixel, which the server never goes over anyway
+		size_t maxUncompressedSize = std::min(static_cast<size_t>(msg->TileCount) * (sizeof(TerrainTileNetworkData) + c_TerrainTileSize * c_TerrainTileSize * 2), static_cast<size_t>(c_MaxTerrainChangePayloadSize));
+		if (msg->DataSize > packet->length - sizeof(MsgTerrainChange) || msg->UncompressedSize > maxUncompressedSize) {
+			return;
+		}
 
-			if (frameData->DataSize == frameData->UncompressedSize) {
-#ifdef _WIN32
-				memcpy_s(m_PixelLineBuffer, size, packet->data + sizeof(MsgTerrainChange), size);
-#else
-				memcpy(m_PixelLineBuffer, packet->data + sizeof(MsgTerrainChange), size);
-#endif
-			} else {
-				LZ4_decompress_safe((char *)(packet->data + sizeof(MsgTerrainChange)), (char *)m_PixelLineBuffer, frameData->DataSize, size);
+		const unsigned char *payload = packet->data + sizeof(MsgTerrainChange);
+
+		if (msg->DataSize != msg->UncompressedSize) {
+			m_TerrainChangeBuffer.resize(msg->UncompressedSize);
+			if (LZ4_decompress_safe((const char *)payload, (char *)m_TerrainChangeBuffer.data(), msg->DataSize, msg->UncompressedSize) != static_cast<int>(msg->UncompressedSize)) {
+				return;
 			}
+			payload = m_TerrainChangeBuffer.data();
+		}
+		const unsigned char *payloadEnd = payload + msg->UncompressedSize;
+
+		for (int tile = 0; tile < msg->TileCount && payload + sizeof(TerrainTileNetworkData) <= payloadEnd; tile++) {
+			const TerrainTileNetworkData *tileData = (TerrainTileNetworkData *)payload;
+			const unsigned char *runs = payload + sizeof(TerrainTileNetworkData);
+			payload = runs + tileData->RunCount * 2;
+			if (payload > payloadEnd || tileData->Width == 0 || tileData->Width > c_TerrainTileSize || tileData->Height > c_TerrainTileSize) {
+				break;
+			}
+
+			BITMAP *bmp = tileData->Back ? m_SceneBackgroundBitmap : m_SceneForegroundBitmap;
+			int line = 0;
+			int px = 0;
 
-			// Copy bitmap data to scene bitmap
-			const BITMAP *bmp = 0;
-			bmp = (frameData->Back) ? m_SceneBackgroundBitmap : m_SceneForegroundBitmap;
+			for (int run = 0; run < tileData->RunCount && line < tileData->Height; run++) {
+				int length = runs[run * 2];
+				int x = tileData->X + px;
+				int y = tileData->Y + line;
+				// Runs never cross rows, so one running past the tile is malformed and gets cut off there
+				int count = std::min({ length, tileData->Width - px, bmp->w - x });
 
-			const unsigned char *src = m_PixelLineBuffer;
-			for (int y = 0; y < frameData->H && frameData->Y + y < bmp->h; y++) {
-				memcpy(bmp->line[frameData->Y + y] + frameData->X, src, frameData->W);
-				src += frameData->W;
+				if (y < bmp->h && count > 0) { memset(bmp->line[y] + x, runs[run * 2 + 1], count); }
+
+				px += length;
+				if (px >= tileData->Width) {
+					px = 0;
+					line++;
+				}
 			}
 		}
 	}
@@ -688,7 +861,145 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void NetworkClient::DrawBackgrounds(BITMAP *targetBitmap) {
+	void NetworkClient::ReceiveEntityPresetMsg(RakNet::Packet *packet) {
+		if (packet->length < sizeof(MsgEntityPreset)) {
+			return;
+		}
+		const MsgEntityPreset *msg = (MsgEntityPreset *)packet->data;
+
+		if (msg->PresetID >= m_EntityPresets.size()) { m_EntityPresets.resize(msg->PresetID + 1, nullptr); }
+
+		std::string className(msg->ClassName, strnlen(msg->ClassName, sizeof(msg->ClassName)));
+		std::string presetName(msg->PresetName, strnlen(msg->PresetName, sizeof(msg->PresetName)));
+
+		// The preset can only be drawn if the same data is loaded on this end
+		m_EntityPresets[msg->PresetID] = dynamic_cast<const MOSprite *>(g_PresetMan.GetEntityPreset(className, presetName, msg->ModuleID));
+		if (!m_EntityPresets[msg->PresetID]) { g_ConsoleMan.PrintString("CLIENT: Can't find preset " + className + " " + presetName + " to draw replicated entities with!"); }
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::ReceiveEntityStatesMsg(RakNet::Packet *packet) {
+		if (packet->length < sizeof(MsgEntityStates)) {
+			return;
+		}
+		const MsgEntityStates *msg = (MsgEntityStates *)packet->data;
+
+		// Every record the header claims has to be in the packet
+		if (sizeof(MsgEntityStates) + static_cast<size_t>(msg->EntityCount) * sizeof(EntityStateNetworkData) > packet->length) {
+			return;
+		}
+
+		if (msg->StateFrameNumber != m_ReceivedEntityStateFrameNumber) {
+			m_ReceivedEntityStateFrameNumber = msg->StateFrameNumber;
+			m_ReceivedEntityStateCount = msg->TotalEntityCount;
+			m_ReceivedEntityStates.clear();
+		}
+		// A chunk that doesn't fit in the frame it claims to be part of (e.g. a duplicate) would keep the frame from ever completing
+		if (m_ReceivedEntityStates.size() + msg->EntityCount > m_ReceivedEntityStateCount) {
+			return;
+		}
+
+		const EntityStateNetworkData *stateData = (EntityStateNetworkData *)(packet->data + sizeof(MsgEntityStates));
+		m_ReceivedEntityStates.insert(m_ReceivedEntityStates.end(), stateData, stateData + msg->EntityCount);
+
+		m_ReceivedData += packet->length;
+		m_CompressedData += packet->length;
+
+		// Only show complete frames, a frame with lost chunks is skipped and the previous one stays on screen
+		if (m_ReceivedEntityStates.size() == m_ReceivedEntityStateCount) { m_EntityStates.swap(m_ReceivedEntityStates); }
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::ReceiveInputOverlayMsg(RakNet::Packet *packet) {
+		if (packet->length < sizeof(MsgInputOverlay)) {
+			return;
+		}
+		const MsgInputOverlay *overlayData = reinterpret_cast<const MsgInputOverlay *>(packet->data);
+
+		// Overlay states are sequenced, but input sequence numbers only ever grow within a connection, so an older one would only make the prediction jump back
+		if (m_InputOverlayReceived && overlayData->InputSequence < m_InputOverlay.InputSequence) {
+			return;
+		}
+		m_InputOverlay = *overlayData;
+		m_InputOverlay.PieSliceCount = std::min(m_InputOverlay.PieSliceCount, static_cast<unsigned char>(c_MaxPieSlicesForNetwork));
+		m_InputOverlayReceived = true;
+
+		while (!m_UnacknowledgedMouseMovement.empty() && m_UnacknowledgedMouseMovement.front().first <= m_InputOverlay.InputSequence) {
+			m_UnacknowledgedMouseMovement.pop_front();
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Vector NetworkClient::GetPredictedAnalogAim() const {
+		float trapRadius = m_InputOverlay.MouseTrapRadius;
+		if (trapRadius <= 0) {
+			return Vector();
+		}
+		// Accumulate the same way UInputMan does on the server for every input message it processes
+		Vector analogAim(m_InputOverlay.AnalogAimX, m_InputOverlay.AnalogAimY);
+		for (const std::pair<unsigned int, Vector> &movement : m_UnacknowledgedMouseMovement) {
+			analogAim += movement.second * 3;
+			analogAim.CapMagnitude(trapRadius);
+		}
+		const Vector &unsentMovement = g_UInputMan.PeekNetworkAccumulatedRawMouseMovement(0);
+		if (!unsentMovement.IsZero()) {
+			analogAim += unsentMovement * 3;
+			analogAim.CapMagnitude(trapRadius);
+		}
+		return analogAim / trapRadius;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::PredictAim(const Vector &analogAim, float &aimAngle, bool &aimFlipped) const {
+		aimAngle = m_InputOverlay.AimAngle;
+		aimFlipped = m_InputOverlay.AimFlipped;
+
+		if (analogAim.GetMagnitude() > 0.1F) {
+			Vector aim = analogAim;
+			if (aim.m_X == 0) { aim.m_X += aimFlipped ? -0.01F : 0.01F; }
+			if ((aim.m_X > 0 && aimFlipped) || (aim.m_X < 0 && !aimFlipped)) { aimFlipped = !aimFlipped; }
+
+			aimAngle = (aimFlipped ? c_PI : 0) + (aim.GetAbsRadAngle() * (aimFlipped ? -1 : 1));
+			aimAngle = std::clamp(aimAngle, -m_InputOverlay.AimRange, m_InputOverlay.AimRange);
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::UpdateViewShift() {
+		long long currentTicks = g_TimerMan.GetRealTickCount();
+		double elapsedMS = m_LastViewShiftUpdateTime > 0 ? static_cast<double>(currentTicks - m_LastViewShiftUpdateTime) * 1000.0 / static_cast<double>(g_TimerMan.GetTicksPerSecond()) : 0;
+		m_LastViewShiftUpdateTime = currentTicks;
+
+		// The shift is the difference between where the view will lead with the predicted aim and where it leads with the aim the received frame was drawn with
+		Vector targetShift;
+		Vector analogAim = GetPredictedAnalogAim();
+		if (m_InputOverlay.ScrollLeadVisible && !m_InputOverlay.PieMenuVisible && analogAim.GetMagnitude() > 0.1F) {
+			float aimAngle;
+			bool aimFlipped;
+			PredictAim(analogAim, aimAngle, aimFlipped);
+
+			Matrix predictedAim(aimAngle);
+			predictedAim.SetXFlipped(aimFlipped);
+			Matrix receivedAim(m_InputOverlay.AimAngle);
+			receivedAim.SetXFlipped(m_InputOverlay.AimFlipped);
+			targetShift = (Vector(m_InputOverlay.ScrollLeadLength, 0) * predictedAim) - (Vector(m_InputOverlay.ScrollLeadLength, 0) * receivedAim);
+		}
+		// Same easing as SceneMan applies to the scroll offset, so the shifted view lands where the server's view will be once it catches up
+		float easing = std::min(1.0F, static_cast<float>(m_InputOverlay.ScrollSpeed * elapsedMS * 0.05));
+		m_ViewShift += (targetShift - m_ViewShift) * easing;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::DrawBackgrounds(BITMAP *targetBitmap, const Vector &viewPos) {
+		// The layers scroll with the same predicted shift as the rest of the view
+		Vector viewShift = viewPos - m_PresentedTargetPos;
+
 		for (int i = m_ActiveBackgroundLayers - 1; i >= 0; i--) {
 			if (m_BackgroundBitmaps[i] != 0) {
 				//masked_blit(m_BackgroundBitmaps[i], targetBitmap, 0, 0, 0, 0, m_BackgroundBitmaps[i]->w, m_BackgroundBitmaps[i]->h);
@@ -726,8 +1037,8 @@ namespace RTE {
 					offsetY = scrollOverride.GetFloorIntY();
 				} else {
 					// Regular scroll
-					offsetX = std::floor(m_BackgroundLayers[frame][i].OffsetX * m_BackgroundLayers[frame][i].ScrollRatioX);
-					offsetY = std::floor(m_BackgroundLayers[frame][i].OffsetY * m_BackgroundLayers[frame][i].ScrollRatioY);
+					offsetX = std::floor((m_PresentedLayerOffsets[i].m_X + viewShift.m_X) * m_BackgroundLayers[frame][i].ScrollRatioX);
+					offsetY = std::floor((m_PresentedLayerOffsets[i].m_Y + viewShift.m_Y) * m_BackgroundLayers[frame][i].ScrollRatioY);
 			
 					// Only force bounds when doing regular scroll offset because the override is used to do terrain object application tricks and sometimes needs the offsets to be < 0
 					// ForceBounds(offsetX, offsetY);
@@ -875,24 +1186,155 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void NetworkClient::DrawFrame() {
-		BITMAP *src_bmp = g_FrameMan.GetNetworkBackBufferIntermediate8Ready(0);
+	void NetworkClient::DrawEntities(BITMAP *targetBitmap, const Vector &targetPos) {
+		for (const EntityStateNetworkData &state : m_EntityStates) {
+			int drawX = state.PosX - targetPos.GetFloorIntX();
+			int drawY = state.PosY - targetPos.GetFloorIntY();
+
+			if (state.PresetID == c_PixelEntityPresetID) {
+				if (m_SceneWrapsX && drawX < 0) {
+					drawX += m_SceneWidth;
+				} else if (m_SceneWrapsX && drawX >= targetBitmap->w) {
+					drawX -= m_SceneWidth;
+				}
+				putpixel(targetBitmap, drawX, drawY, state.Frame);
+				continue;
+			}
+			if (state.PresetID >= m_EntityPresets.size() || !m_EntityPresets[state.PresetID]) {
+				continue;
+			}
+			const MOSprite *preset = m_EntityPresets[state.PresetID];
+			BITMAP *sprite = preset->GetSpriteFrame(state.Frame);
+			if (!sprite) {
+				continue;
+			}
+
+			if (m_SceneWrapsX) {
+				int margin = std::max(sprite->w, sprite->h) * std::max(static_cast<int>(state.Scale), 64) / 64;
+				if (drawX < -margin) {
+					drawX += m_SceneWidth;
+				} else if (drawX > targetBitmap->w + margin) {
+					drawX -= m_SceneWidth;
+				}
+			}
+
+			Vector spriteOffset = preset->GetSpriteOffset();
+			if (state.RotAngle == 0 && state.Scale == 64) {
+				if (state.HFlipped) {
+					draw_sprite_h_flip(targetBitmap, sprite, drawX - sprite->w - spriteOffset.GetFloorIntX(), drawY + spriteOffset.GetFloorIntY());
+				} else {
+					draw_sprite(targetBitmap, sprite, drawX + spriteOffset.GetFloorIntX(), drawY + spriteOffset.GetFloorIntY());
+				}
+			} else if (state.HFlipped) {
+				// Flipping vertically and turning by half a circle is the same as flipping horizontally
+				pivot_scaled_sprite_v_flip(targetBitmap, sprite, drawX, drawY, -spriteOffset.GetFloorIntX(), -spriteOffset.GetFloorIntY(), itofix(state.RotAngle + 128), ftofix(static_cast<float>(state.Scale) / 64.0F));
+			} else {
+				pivot_scaled_sprite(targetBitmap, sprite, drawX, drawY, -spriteOffset.GetFloorIntX(), -spriteOffset.GetFloorIntY(), itofix(state.RotAngle), ftofix(static_cast<float>(state.Scale) / 64.0F));
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::DrawInputOverlays(BITMAP *targetBitmap, const Vector &targetPos) {
+		if (!m_InputOverlayReceived) {
+			return;
+		}
+		Vector analogAim = GetPredictedAnalogAim();
+
+		if (m_InputOverlay.PieMenuVisible) {
+			float cursorAngle = m_InputOverlay.PieCursorAngle;
+			bool cursorPointing = m_InputOverlay.PieCursorPointing;
+			// Same threshold PieMenuGUI uses to register input as a direction on the pie
+			if (analogAim.GetLargest() > 0.45F) {
+				cursorAngle = analogAim.GetAbsRadAngle();
+				if (cursorAngle < 0) { cursorAngle += c_TwoPI; }
+				cursorPointing = true;
+			}
+			if (!cursorPointing) {
+				return;
+			}
+			int centerX = m_InputOverlay.PieCenterX - targetPos.GetFloorIntX();
+			int centerY = m_InputOverlay.PieCenterY - targetPos.GetFloorIntY();
+			if (m_SceneWrapsX && centerX < 0) {
+				centerX += m_SceneWidth;
+			} else if (m_SceneWrapsX && centerX >= targetBitmap->w) {
+				centerX -= m_SceneWidth;
+			}
+
+			// Outline the slice the cursor is over, since the server only highlights it once it receives the input
+			for (int i = 0; i < m_InputOverlay.PieSliceCount; i++) {
+				const PieSliceNetworkData &slice = m_InputOverlay.PieSlices[i];
+				float areaEnd = slice.AreaStart + slice.AreaArc;
+				if ((slice.AreaStart <= cursorAngle && areaEnd > cursorAngle) || (areaEnd > c_TwoPI && cursorAngle < areaEnd - c_TwoPI)) {
+					fixed arcStart = ftofix((slice.AreaStart / c_PI) * 128);
+					fixed arcEnd = ftofix((areaEnd / c_PI) * 128);
+					int color = slice.Enabled ? g_YellowGlowColor : g_RedColor;
+					arc(targetBitmap, centerX, centerY, arcStart, arcEnd, m_InputOverlay.PieInnerRadius, color);
+					arc(targetBitmap, centerX, centerY, arcStart, arcEnd, m_InputOverlay.PieInnerRadius + m_InputOverlay.PieThickness, color);
+					break;
+				}
+			}
+
+			if (!m_PieCursorBitmap) { m_PieCursorBitmap = ContentFile("Base.rte/GUIs/Skins/PieCursor.png").GetAsBitmap(); }
+			if (m_PieCursorBitmap) {
+				Vector cursorPos(m_InputOverlay.PieInnerRadius, 0);
+				cursorPos.RadRotate(cursorAngle);
+				pivot_sprite(targetBitmap, m_PieCursorBitmap, centerX + cursorPos.GetFloorIntX(), centerY + cursorPos.GetFloorIntY(), m_PieCursorBitmap->w / 2, m_PieCursorBitmap->h / 2, ftofix((cursorAngle / c_PI) * -128));
+			}
+		} else if (m_InputOverlay.AimReticleVisible) {
+			float aimAngle;
+			bool aimFlipped;
+			PredictAim(analogAim, aimAngle, aimFlipped);
+
+			// The device turns along with the aim, so rotate it by however much the predicted aim differs from the received one
+			float rotation = m_InputOverlay.AimDeviceRotation + (aimAngle - m_InputOverlay.AimAngle);
+			Matrix aimMatrix(rotation);
+			aimMatrix.SetXFlipped(aimFlipped);
+
+			Vector devicePos(m_InputOverlay.AimDevicePosX, m_InputOverlay.AimDevicePosY);
+			Vector muzzleOffset(m_InputOverlay.MuzzleOffsetX, m_InputOverlay.MuzzleOffsetY);
+
+			// Same dots HDFirearm::DrawHUD draws, minus their glow
+			for (float dotOffset : { -9.0F, -3.0F, 3.0F, 9.0F }) {
+				Vector dotPos = devicePos + ((Vector(m_InputOverlay.SharpLength + dotOffset, 0) + muzzleOffset) * aimMatrix) - targetPos;
+				int dotX = dotPos.GetFloorIntX();
+				if (m_SceneWrapsX && dotX < 0) {
+					dotX += m_SceneWidth;
+				} else if (m_SceneWrapsX && dotX >= targetBitmap->w) {
+					dotX -= m_SceneWidth;
+				}
+				putpixel(targetBitmap, dotX, dotPos.GetFloorIntY(), g_YellowGlowColor);
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::DrawFrame(bool newFrame) {
+		BITMAP *src_bmp = m_PresentedFrameBitmap;
 		BITMAP *dst_bmp = g_FrameMan.GetNetworkBackBuffer8Ready(0);
 
-		BITMAP *src_gui_bmp = g_FrameMan.GetNetworkBackBufferIntermediateGUI8Ready(0);
+		BITMAP *src_gui_bmp = m_PresentedGUIFrameBitmap;
 		BITMAP *dst_gui_bmp = g_FrameMan.GetNetworkBackBufferGUI8Ready(0);
 
 		// Have to clear to color to fallback if there's no skybox on client
 		clear_to_color(dst_bmp, g_BlackColor);
 		clear_to_color(dst_gui_bmp, g_MaskColor);
 
+		// Shift the view by the predicted lead, as far as the Scene's edges allow, so it follows local aim without waiting for the server
+		Vector viewPos = m_PresentedTargetPos + m_ViewShift.GetRounded();
+		if (!m_SceneWrapsX && m_SceneWidth > src_bmp->w) { viewPos.m_X = std::clamp(viewPos.m_X, 0.0F, static_cast<float>(m_SceneWidth - src_bmp->w)); }
+		if (m_SceneHeight > src_bmp->h) { viewPos.m_Y = std::clamp(viewPos.m_Y, 0.0F, static_cast<float>(m_SceneHeight - src_bmp->h)); }
+		Vector frameOffset = m_PresentedTargetPos - viewPos;
+
 		// Draw Scene background
-		int sourceX = m_TargetPos[m_CurrentFrame].m_X;
-		int sourceY = m_TargetPos[m_CurrentFrame].m_Y;
+		int sourceX = viewPos.m_X;
+		int sourceY = viewPos.m_Y;
 		int destX = 0;
 		int destY = 0;
 
-		DrawBackgrounds(dst_bmp);
+		DrawBackgrounds(dst_bmp, viewPos);
 		masked_blit(m_SceneBackgroundBitmap, dst_bmp, sourceX, sourceY, destX, destY, src_bmp->w, src_bmp->h);
 		
 		if (sourceX < 0) {
@@ -908,9 +1350,16 @@ namespace RTE {
 			masked_blit(m_SceneBackgroundBitmap, dst_bmp, 0, sourceY, newDestX, destY, width, src_bmp->h);
 		}
 
-		//draw_sprite(src_bmp, dst_bmp, 0, 0);
-		masked_blit(src_bmp, dst_bmp, 0, 0, 0, 0, src_bmp->w, src_bmp->h);
-		masked_blit(src_gui_bmp, dst_gui_bmp, 0, 0, 0, 0, src_bmp->w, src_bmp->h);
+		// When the server replicates entities instead of streaming the scene layer, draw them locally in its place
+		if (m_ReplicateEntities) {
+			clear_to_color(src_bmp, g_MaskColor);
+			DrawEntities(src_bmp, m_PresentedTargetPos);
+		}
+
+		// Both layers follow the predicted view. The GUI layer holds the HUD drawn over actors (health, gold, names, markers), which has to stay on them
+		// Screen anchored menus shift along by the small predicted offset, only the input overlays drawn below are placed for the predicted view directly
+		masked_blit(src_bmp, dst_bmp, 0, 0, frameOffset.GetFloorIntX(), frameOffset.GetFloorIntY(), src_bmp->w, src_bmp->h);
+		masked_blit(src_gui_bmp, dst_gui_bmp, 0, 0, frameOffset.GetFloorIntX(), frameOffset.GetFloorIntY(), src_gui_bmp->w, src_gui_bmp->h);
 		masked_blit(m_SceneForegroundBitmap, dst_bmp, sourceX, sourceY, destX, destY, src_bmp->w, src_bmp->h);
 
 		if (sourceX < 0) {
@@ -926,7 +1375,10 @@ namespace RTE {
 			masked_blit(m_SceneForegroundBitmap, dst_bmp, 0, sourceY, newDestX, destY, width, src_bmp->h);
 		}
 
-		DrawPostEffects(m_CurrentFrame);
+		// Post-effects are positioned by the server and only need handing on once per frame
+		if (newFrame) { DrawPostEffects(m_CurrentFrame); }
+
+		DrawInputOverlays(dst_gui_bmp, viewPos);
 
 		g_PerformanceMan.SetCurrentPing(GetPing());
 	}
@@ -935,6 +1387,10 @@ namespace RTE {
 
 	void NetworkClient::Update() {
 		HandleNetworkPackets();
+#ifndef RELEASE_BUILD
+		m_DrawFrameBoxOutlines = g_UInputMan.KeyHeld(KEY_0);
+#endif
+		PresentFrame();
 
 		// Draw level loading animation
 		if (m_CurrentSceneLayerReceived != -1) {
@@ -1003,13 +1459,56 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkClient::PresentFrame() {
+		if (m_InputOverlayReceived) { UpdateViewShift(); }
+
+		m_FrameMutex.lock();
+		if (!m_NewFrameComplete) {
+			m_FrameMutex.unlock();
+			// Redraw the current frame so the predicted overlays follow local input every update instead of only when a frame arrives
+			if (m_InputOverlayReceived && m_CurrentSceneLayerReceived == -1 && m_PresentedFrameBitmap && m_SceneBackgroundBitmap && m_SceneForegroundBitmap) { DrawFrame(false); }
+			return;
+		}
+		m_NewFrameComplete = false;
+		m_CurrentFrame = m_CompleteFrameNumber;
+
+		BITMAP *readyBuffer = g_FrameMan.GetNetworkBackBufferIntermediate8Ready(0);
+		BITMAP *readyGUIBuffer = g_FrameMan.GetNetworkBackBufferIntermediateGUI8Ready(0);
+		if (!m_PresentedFrameBitmap || m_PresentedFrameBitmap->w != readyBuffer->w || m_PresentedFrameBitmap->h != readyBuffer->h) {
+			if (m_PresentedFrameBitmap) { destroy_bitmap(m_PresentedFrameBitmap); }
+			if (m_PresentedGUIFrameBitmap) { destroy_bitmap(m_PresentedGUIFrameBitmap); }
+			m_PresentedFrameBitmap = create_bitmap_ex(8, readyBuffer->w, readyBuffer->h);
+			m_PresentedGUIFrameBitmap = create_bitmap_ex(8, readyGUIBuffer->w, readyGUIBuffer->h);
+		}
+		blit(readyBuffer, m_PresentedFrameBitmap, 0, 0, 0, 0, readyBuffer->w, readyBuffer->h);
+		blit(readyGUIBuffer, m_PresentedGUIFrameBitmap, 0, 0, 0, 0, readyGUIBuffer->w, readyGUIBuffer->h);
+		m_PresentedTargetPos = m_TargetPos[m_CurrentFrame];
+		for (int i = 0; i < c_MaxLayersStoredForNetwork; i++) {
+			m_PresentedLayerOffsets[i].SetXY(m_BackgroundLayers[m_CurrentFrame][i].OffsetX, m_BackgroundLayers[m_CurrentFrame][i].OffsetY);
+		}
+		m_FrameMutex.unlock();
+
+		m_CurrentSceneLayerReceived = -1;
+		DrawFrame(true);
+
+		// Post-effects of frames that were skipped because a newer one completed in the meantime won't be drawn either
+		m_PostEffects[m_CurrentFrame].clear();
+		m_PostEffects[(m_CurrentFrame + c_FramesToRemember - 1) % c_FramesToRemember].clear();
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void NetworkClient::HandleNetworkPackets() {
-		RakNet::Packet *packet;
+		std::deque<RakNet::Packet *> receivedPackets;
+		m_ReceivedPacketMutex.lock();
+		receivedPackets.swap(m_ReceivedPackets);
+		m_ReceivedPacketMutex.unlock();
+
 		std::string msg;
 
-		for (packet = m_Client->Receive(); packet; m_Client->DeallocatePacket(packet), packet = m_Client->Receive()) {
+		for (RakNet::Packet *packet : receivedPackets) {
 			// We got a packet, get the identifier with our handy function
 			unsigned char packetIdentifier = GetPacketIdentifier(packet);
 
@@ -1090,15 +1589,6 @@ namespace RTE {
 					msg += packet->systemAddress.ToString(true);
 					g_ConsoleMan.PrintString(msg);
 					break;
-				case ID_SRV_FRAME_SETUP:
-					ReceiveFrameSetupMsg(packet);
-					break;
-				case ID_SRV_FRAME_LINE:
-					ReceiveFrameLineMsg(packet);
-					break;
-				case ID_SRV_FRAME_BOX:
-					ReceiveFrameBoxMsg(packet);
-					break;
 				case ID_SRV_SCENE_SETUP:
 					ReceiveSceneSetupMsg(packet);
 					break;
@@ -1130,6 +1620,15 @@ namespace RTE {
 				case ID_SRV_MUSIC_EVENTS:
 					ReceiveMusicEventsMsg(packet);
 					break;
+				case ID_SRV_ENTITY_PRESET:
+					ReceiveEntityPresetMsg(packet);
+					break;
+				case ID_SRV_ENTITY_STATES:
+					ReceiveEntityStatesMsg(packet);
+					break;
+				case ID_SRV_INPUT_OVERLAY:
+					ReceiveInputOverlayMsg(packet);
+					break;
 				case ID_NAT_TARGET_NOT_CONNECTED:
 					g_ConsoleMan.PrintString("Failed: ID_NAT_TARGET_NOT_CONNECTED");
 					m_IsConnected = false;
@@ -1158,6 +1657,7 @@ namespace RTE {
 				default:
 					break;
 			}
+			m_Client->DeallocatePacket(packet);
 		}
 	}
 }
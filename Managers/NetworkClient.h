@@ -6,9 +6,14 @@
 
 #include "RakPeerInterface.h"
 #include "NetworkMessages.h"
+#include "NetworkFrameDecoding.h"
 
 #include "NatPunchthroughClient.h"
 
+#include "ThreadPool.h"
+
+#include <atomic>
+
 #define g_NetworkClient NetworkClient::Instance()
 
 /////////////////////////////////////////////////////////////////////////
@@ -18,6 +23,7 @@
 namespace RTE {
 
 	struct PostEffect;
+	class MOSprite;
 
 	/// <summary>
 	/// The centralized singleton manager of the network multiplayer client.
@@ -48,7 +54,7 @@ namespace RTE {
 		/// <summary>
 		/// Destroys and resets (through Clear()) the NetworkClient object.
 		/// </summary>
-		void Destroy() { Clear(); }
+		void Destroy();
 #pragma endregion
 
 #pragma region Getters
@@ -137,16 +143,51 @@ namespace RTE {
 		bool m_IsRegistered; //!< Is client registered at server.
 		bool m_IsNATPunched; //!< Is client connected through NAT service.
 
-		unsigned char m_PixelLineBuffer[c_MaxPixelLineBufferSize]; //!<
+		std::vector<unsigned char> m_TerrainChangeBuffer; //!< Buffer compressed terrain change messages are decompressed into.
 
-		long int m_ReceivedData; //!<
-		long int m_CompressedData; //!<
+		std::atomic<long int> m_ReceivedData; //!<
+		std::atomic<long int> m_CompressedData; //!<
 
 		int m_ClientInputFps; //!< The rate (in FPS) the client input is sent to the server.
 		long long m_LastInputSentTime; //!< The last time input was sent in real time ticks.
 
 		int m_CurrentFrame; //!<
 
+		std::thread m_ReceiveThread; //!< Thread that receives all packets, hands frame data to the decoder workers and queues everything else for the main thread.
+		std::atomic<bool> m_ReceiveThreadRunning; //!< Whether the receive thread should keep running.
+		ThreadPool m_FrameDecoderPool; //!< Worker threads that decompress frame boxes and lines into the frame being received.
+		std::vector<std::future<void>> m_FrameDecodeJobs; //!< The decode jobs dispatched since the receive thread last waited for all of them. Only touched by the receive thread.
+		std::unordered_set<unsigned int> m_FrameDecodeJobAreas; //!< The layer and position of every box or line the pending decode jobs write to, so two jobs never write to the same area at once. Only touched by the receive thread.
+		std::mutex m_ReceivedPacketMutex; //!< Mutex guarding the queue of packets for the main thread.
+		std::deque<RakNet::Packet *> m_ReceivedPackets; //!< Packets waiting for the main thread to handle them, in the order they were received.
+		MsgFrameSetup m_DecodingFrameSetup; //!< The setup of the frame currently being received. Only touched by the receive thread.
+		bool m_DecodingFrameSetupReceived; //!< Whether any frame setup was received yet, i.e. whether m_DecodingFrameSetup is valid.
+		std::mutex m_FrameMutex; //!< Mutex guarding the completed frame buffers and the per-frame target positions and layer offsets that go with them.
+		int m_CompleteFrameNumber; //!< The number of the last completely received frame.
+		bool m_NewFrameComplete; //!< Whether a frame was completed since the main thread last presented one.
+		BITMAP *m_PresentedFrameBitmap; //!< Copy of the scene layer of the frame being presented, so it can be drawn without holding m_FrameMutex. Owned.
+		BITMAP *m_PresentedGUIFrameBitmap; //!< Copy of the GUI layer of the frame being presented. Owned.
+		Vector m_PresentedTargetPos; //!< The target position of the frame being presented.
+		Vector m_PresentedLayerOffsets[c_MaxLayersStoredForNetwork]; //!< The background layer offsets of the frame being presented.
+		std::atomic<bool> m_DrawFrameBoxOutlines; //!< Whether the decoder workers outline each received box, for debugging. Sampled from input by the main thread.
+
+		bool m_ReplicateEntities; //!< Whether the server sends entity states to draw locally instead of streaming the rendered scene layer.
+		std::vector<const MOSprite *> m_EntityPresets; //!< The presets replicated entities are drawn with, indexed by network preset ID. Not owned.
+		std::vector<EntityStateNetworkData> m_EntityStates; //!< The last completely received frame of replicated entity states, in draw order.
+		std::vector<EntityStateNetworkData> m_ReceivedEntityStates; //!< The frame of replicated entity states currently being received.
+		unsigned short m_ReceivedEntityStateFrameNumber; //!< The frame number of the entity states currently being received.
+		unsigned short m_ReceivedEntityStateCount; //!< The number of entity states the frame currently being received consists of.
+
+		unsigned int m_InputSequence; //!< The sequence number of the last input message sent, so the server can tell which input its overlay state already includes.
+		std::deque<std::pair<unsigned int, Vector>> m_UnacknowledgedMouseMovement; //!< The mouse movement of each sent input message the server hasn't acknowledged through an overlay state yet, paired with its sequence number.
+		MsgInputOverlay m_InputOverlay; //!< The latest overlay state received from the server, which the locally drawn overlays are predicted from.
+		bool m_InputOverlayReceived; //!< Whether any overlay state was received yet, i.e. whether m_InputOverlay is valid.
+		Vector m_ViewShift; //!< How far the locally predicted view is currently shifted from the view of the last received frame.
+		long long m_LastViewShiftUpdateTime; //!< The last time the view shift was updated in real time ticks.
+		BITMAP *m_PieCursorBitmap; //!< The pie menu cursor arrow. Not owned.
+
+		ReceivedBoxFrameNumbers m_ReceivedBoxFrameNumbers[2]; //!< The frame number of the content each received box of each layer currently holds, keyed by box position. Used to validate deltas against.
+
 		Vector m_TargetPos[c_FramesToRemember]; //!<
 		std::list<PostEffect> m_PostEffects[c_FramesToRemember]; //!< List of post-effects received from server.
 
@@ -175,6 +216,49 @@ namespace RTE {
 		/// 
 		/// </summary>
 		void HandleNetworkPackets();
+
+		/// <summary>
+		/// Draws the last completely received frame, if a new one was completed since this was last called. Otherwise redraws the current one if there are predicted overlays to keep up to date.
+		/// Only copying the completed frame is done while holding m_FrameMutex, so the receive thread isn't held up by the drawing.
+		/// </summary>
+		void PresentFrame();
+#pragma endregion
+
+#pragma region Receive Pipeline
+		/// <summary>
+		/// Starts the receive thread and the frame decoder workers, unless they're already running.
+		/// </summary>
+		void StartReceiveThread();
+
+		/// <summary>
+		/// Stops the receive thread and the frame decoder workers and drops any packets still waiting for the main thread.
+		/// </summary>
+		void StopReceiveThread();
+
+		/// <summary>
+		/// Receives packets until the receive thread is stopped. Frame data is decoded by the decoder workers, everything else is queued for the main thread.
+		/// </summary>
+		/// <param name="client">The NetworkClient to receive packets for.</param>
+		static void ReceiveThreadFunction(NetworkClient *client);
+
+		/// <summary>
+		/// Hands a frame packet to the decoder workers. The packet is deallocated once decoded.
+		/// </summary>
+		/// <param name="packet">The packet to decode.</param>
+		/// <param name="area">The layer and position of the box or line the packet writes to. If a pending job writes to the same area, all pending jobs are waited for first so the packets are applied in order.</param>
+		/// <param name="decodeFunction">The function that decodes the packet.</param>
+		void DispatchFrameDecodeJob(RakNet::Packet *packet, unsigned int area, void (NetworkClient::*decodeFunction)(const RakNet::Packet *packet));
+
+		/// <summary>
+		/// Waits for all dispatched frame decode jobs to finish.
+		/// </summary>
+		void WaitForFrameDecodeJobs();
+
+		/// <summary>
+		/// Queues a packet for the main thread to handle.
+		/// </summary>
+		/// <param name="packet">The packet to queue.</param>
+		void QueueReceivedPacket(RakNet::Packet *packet);
 #pragma endregion
 
 #pragma region Network Event Handling
@@ -220,23 +304,35 @@ namespace RTE {
 		void SendInputMsg();
 
 		/// <summary>
-		/// 
+		/// Completes the frame currently being received, since a new frame starting means all of its data arrived, and starts the new one. Runs on the receive thread.
 		/// </summary>
 		/// <param name="packet"></param>
 		void ReceiveFrameSetupMsg(RakNet::Packet *packet);
 
 		/// <summary>
-		/// 
+		/// Dispatches a frame line packet to the decoder workers. Runs on the receive thread.
 		/// </summary>
-		/// <param name="packet"></param>
+		/// <param name="packet">The packet to handle.</param>
 		void ReceiveFrameLineMsg(RakNet::Packet *packet);
 
 		/// <summary>
-		/// 
+		/// Decompresses a frame line packet into the frame being received. Runs on a decoder worker.
 		/// </summary>
-		/// <param name="packet"></param>
+		/// <param name="packet">The packet to decode.</param>
+		void DecodeFrameLineMsg(const RakNet::Packet *packet);
+
+		/// <summary>
+		/// Validates a frame box packet against the boxes received so far and dispatches it to the decoder workers. Runs on the receive thread.
+		/// </summary>
+		/// <param name="packet">The packet to handle.</param>
 		void ReceiveFrameBoxMsg(RakNet::Packet *packet);
 
+		/// <summary>
+		/// Decompresses a frame box packet into the frame being received. Runs on a decoder worker.
+		/// </summary>
+		/// <param name="packet">The packet to decode.</param>
+		void DecodeFrameBoxMsg(const RakNet::Packet *packet);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -287,6 +383,45 @@ namespace RTE {
 		/// </summary>
 		/// <param name="packet">The packet to handle.</param>
 		void ReceiveMusicEventsMsg(RakNet::Packet *packet);
+
+		/// <summary>
+		/// Receive and handle a packet mapping a network preset ID to a preset replicated entities are drawn with.
+		/// </summary>
+		/// <param name="packet">The packet to handle.</param>
+		void ReceiveEntityPresetMsg(RakNet::Packet *packet);
+
+		/// <summary>
+		/// Receive and handle a packet of replicated entity states.
+		/// </summary>
+		/// <param name="packet">The packet to handle.</param>
+		void ReceiveEntityStatesMsg(RakNet::Packet *packet);
+
+		/// <summary>
+		/// Receives the server's overlay state and drops the mouse movement it already includes from the unacknowledged movement.
+		/// </summary>
+		/// <param name="packet">The packet to handle.</param>
+		void ReceiveInputOverlayMsg(RakNet::Packet *packet);
+#pragma endregion
+
+#pragma region Input Prediction
+		/// <summary>
+		/// Predicts the analog aim the server will end up with, by applying all mouse movement it hasn't acknowledged yet on top of the last received overlay state.
+		/// </summary>
+		/// <returns>The predicted analog aim, normalized to the mouse trap radius.</returns>
+		Vector GetPredictedAnalogAim() const;
+
+		/// <summary>
+		/// Predicts the aim angle and flip the controlled actor will end up with for an analog aim, the same way AHuman maps analog aim to its aim angle.
+		/// </summary>
+		/// <param name="analogAim">The analog aim to map.</param>
+		/// <param name="aimAngle">Returns the predicted aim angle, relative to the facing direction.</param>
+		/// <param name="aimFlipped">Returns whether the actor is predicted to face left.</param>
+		void PredictAim(const Vector &analogAim, float &aimAngle, bool &aimFlipped) const;
+
+		/// <summary>
+		/// Eases the view shift towards the predicted view lead, the same way SceneMan eases the scroll offset towards its target.
+		/// </summary>
+		void UpdateViewShift();
 #pragma endregion
 
 #pragma region Drawing
@@ -294,7 +429,8 @@ namespace RTE {
 		/// 
 		/// </summary>
 		/// <param name="targetBitmap"></param>
-		void DrawBackgrounds(BITMAP *targetBitmap);
+		/// <param name="viewPos">The position of the view the frame is drawn for, including the predicted shift.</param>
+		void DrawBackgrounds(BITMAP *targetBitmap, const Vector &viewPos);
 
 		/// <summary>
 		/// 
@@ -303,9 +439,24 @@ namespace RTE {
 		void DrawPostEffects(int frame);
 
 		/// <summary>
-		/// 
+		/// Draws the last completely received frame of replicated entities.
+		/// </summary>
+		/// <param name="targetBitmap">The bitmap to draw to.</param>
+		/// <param name="targetPos">The absolute position of the target bitmap's upper left corner in the scene.</param>
+		void DrawEntities(BITMAP *targetBitmap, const Vector &targetPos);
+
+		/// <summary>
+		/// Draws the aim reticle and pie menu cursor predicted from local input, which the server leaves out of the frames it sends to this client.
+		/// </summary>
+		/// <param name="targetBitmap">The bitmap to draw to.</param>
+		/// <param name="targetPos">The absolute position of the target bitmap's upper left corner in the scene.</param>
+		void DrawInputOverlays(BITMAP *targetBitmap, const Vector &targetPos);
+
+		/// <summary>
+		/// Draws the last completely received frame, shifted by the predicted view lead, with the predicted overlays on top.
 		/// </summary>
-		void DrawFrame();
+		/// <param name="newFrame">Whether the frame wasn't drawn before, in which case its post-effects are handed on to be drawn as well.</param>
+		void DrawFrame(bool newFrame);
 #pragma endregion
 
 		/// <summary>
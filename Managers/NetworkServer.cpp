@@ -7,6 +7,12 @@
 #include "Scene.h"
 #include "SLTerrain.h"
 #include "GameActivity.h"
+#include "AHuman.h"
+#include "HDFirearm.h"
+#include "PieMenuGUI.h"
+#include "MovableMan.h"
+#include "Attachable.h"
+#include "MOPixel.h"
 
 #include "SettingsMan.h"
 #include "ConsoleMan.h"
@@ -27,31 +33,99 @@ namespace RTE {
 
 	const std::string NetworkServer::c_ClassName = "NetworkServer";
 
+	const std::array<NetworkServer::StreamQualityLevel, 6> NetworkServer::c_StreamQualityLevels = {{
+		{ 100, false, 1 },
+		{ 75, false, 1 },
+		{ 75, true, 1 },
+		{ 50, true, 1 },
+		{ 50, true, 2 },
+		{ 33, true, 2 }
+	}};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void NetworkServer::BackgroundSendThreadFunction(NetworkServer *server, short player) {
-		while (server->IsServerModeEnabled() && server->IsPlayerConnected(player)) {
-			if (server->NeedToSendSceneSetupData(player) && server->IsSceneAvailable(player)) {
-				server->SendSceneSetupData(player);
+	void NetworkServer::SendSchedulerThreadFunction(NetworkServer *server) {
+		std::chrono::steady_clock::time_point lastTurnTime = std::chrono::steady_clock::now();
+		std::vector<short> dueJobs;
+
+		while (server->IsServerModeEnabled()) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+			std::chrono::steady_clock::time_point currentTime = std::chrono::steady_clock::now();
+			long long elapsedSlots = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - lastTurnTime).count();
+			if (elapsedSlots <= 0) {
+				continue;
 			}
-			if (server->NeedToSendSceneData(player) && server->IsSceneAvailable(player)) {
-				server->ClearTerrainChangeQueue(player);
-				server->SendSceneData(player);
+			lastTurnTime += std::chrono::milliseconds(elapsedSlots);
+
+			// If the scheduler fell behind by a whole turn every waiting job is overdue, so don't bother counting rotations
+			bool allDue = elapsedSlots >= c_TimerWheelSlotCount;
+			int slotsToProcess = allDue ? c_TimerWheelSlotCount : static_cast<int>(elapsedSlots);
+
+			server->m_TimerWheelMutex.lock();
+			for (int i = 0; i < slotsToProcess; i++) {
+				server->m_TimerWheelPosition = (server->m_TimerWheelPosition + 1) % c_TimerWheelSlotCount;
+				std::vector<TimerWheelEntry> &slot = server->m_TimerWheel[server->m_TimerWheelPosition];
+
+				for (std::vector<TimerWheelEntry>::iterator entry = slot.begin(); entry != slot.end();) {
+					if (allDue || entry->Rotations == 0) {
+						dueJobs.push_back(entry->Player);
+						entry = slot.erase(entry);
+					} else {
+						entry->Rotations--;
+						++entry;
+					}
+				}
 			}
-			if (server->SendFrameData(player)) {
-				int ret = server->SendFrame(player);
-				server->SetMSecsToSleep(player, ret / 1000);
-				if (ret > 0) { std::this_thread::sleep_for(std::chrono::microseconds(ret)); }
+			server->m_TimerWheelMutex.unlock();
+
+			for (short player : dueJobs) {
+				server->m_ThreadPool.AddJob([server, player]() { server->RunSendJob(player); });
 			}
-			server->UpdateStats(player);
+			dueJobs.clear();
 		}
-		server->SetThreadExitReason(player, NetworkServer::THREAD_FINISH);
-/*
-#ifdef DEBUG_BUILD
-		// Not thread safe at all to do this, just for debugging purposes
-		g_ConsoleMan.PrintString("Thread exited " + player);
-#endif
-*/
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::ScheduleSendJob(short player, int microSecondsToWait) {
+		int slotsToWait = std::max(1, (microSecondsToWait + 999) / 1000);
+
+		m_TimerWheelMutex.lock();
+		m_TimerWheel[(m_TimerWheelPosition + slotsToWait) % c_TimerWheelSlotCount].push_back({ player, (slotsToWait - 1) / c_TimerWheelSlotCount });
+		m_SendJobScheduled[player] = true;
+		m_TimerWheelMutex.unlock();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::RunSendJob(short player) {
+		m_TimerWheelMutex.lock();
+		if (!IsServerModeEnabled() || !IsPlayerConnected(player)) {
+			// Checked under the lock so a player registering right now either sees this job as still scheduled or schedules a new one itself
+			ResetStreamController(player);
+			m_SendJobScheduled[player] = false;
+			m_TimerWheelMutex.unlock();
+			SetThreadExitReason(player, NetworkServer::THREAD_FINISH);
+			return;
+		}
+		m_TimerWheelMutex.unlock();
+
+		if (NeedToSendSceneSetupData(player) && IsSceneAvailable(player)) {
+			SendSceneSetupData(player);
+		}
+		if (NeedToSendSceneData(player) && IsSceneAvailable(player)) {
+			ClearTerrainChangeQueue(player);
+			SendSceneData(player);
+		}
+		int microSecondsToWait = 0;
+		if (SendFrameData(player)) {
+			microSecondsToWait = SendFrame(player);
+			SetMSecsToSleep(player, microSecondsToWait / 1000);
+		}
+		UpdateStats(player);
+
+		ScheduleSendJob(player, microSecondsToWait);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,6 +134,8 @@ namespace RTE {
 		for (short i = 0; i < c_MaxClients; i++) {
 			m_BackBuffer8[i] = 0;
 			m_BackBufferGUI8[i] = 0;
+			m_SentBackBuffer8[i] = 0;
+			m_SentBackBufferGUI8[i] = 0;
 
 			m_LastFrameSentTime[i] = 0;
 			m_LastStatResetTime[i] = 0;
@@ -67,6 +143,7 @@ namespace RTE {
 			m_DelayedFrames[i] = 0;
 			m_MsecPerFrame[i] = 0;
 			m_MsecPerSendCall[i] = 0;
+			m_StreamControllers[i] = StreamController();
 
 			m_LZ4CompressionState[i] = 0;
 			m_LZ4FastCompressionState[i] = 0;
@@ -84,6 +161,9 @@ namespace RTE {
 			m_ThreadExitReason[i] = 0;
 			m_MSecsToSleep[i] = 0;
 
+			m_SendJobScheduled[i] = false;
+			m_FrameBoxEncoders[i].clear();
+
 			// Set to send scene setup data by default
 			m_SendSceneSetupData[i] = false;
 			m_SendSceneData[i] = false;
@@ -93,6 +173,13 @@ namespace RTE {
 			m_ResetActivityVotes[i] = false;
 
 			m_FrameNumbers[i] = 0;
+			m_BoxFrameNumbers[i] = 0;
+			m_SentFrameBoxes[i].clear();
+			m_LostFrameBoxReceipts[i].clear();
+			m_FramesSinceKeyFrame[i] = 0;
+			m_EntityPresetsSent[i] = 0;
+			m_EntityStateFrameNumbers[i] = 0;
+			m_InputOverlays[i] = MsgInputOverlay();
 
 			m_Ping[i] = 0;
 			m_PingTimer[i].Reset();
@@ -127,6 +214,8 @@ namespace RTE {
 
 			m_EmptyBlocks[i] = 0;
 			m_FullBlocks[i] = 0;
+			m_UnchangedBlocks[i] = 0;
+			m_DeltaBlocks[i] = 0;
 		}
 
 		m_UseHighCompression = true;
@@ -140,8 +229,27 @@ namespace RTE {
 		m_TransmitAsBoxes = true;
 		m_BoxWidth = 32;
 		m_BoxHeight = 44;
+		m_UseDeltaCompression = true;
+		m_KeyFrameInterval = 90;
+		m_UseAdaptiveBitrate = true;
+		m_TargetBandwidth = 8000;
+		m_TargetLatency = 150;
+		m_ReplicateEntities = false;
+		m_EntityStates.clear();
+		m_EntityPresetIDs.clear();
+		m_EntityPresets.clear();
+		m_SendInputOverlays = true;
 		m_NatServerConnected = false;
 		m_LastPackedReceived.Reset();
+
+		for (std::vector<TimerWheelEntry> &slot : m_TimerWheel) {
+			slot.clear();
+		}
+		m_TimerWheelPosition = 0;
+
+		m_SceneTransferCache.reset();
+		m_SceneTransferCacheChanges.clear();
+		m_SceneTransferCacheBuilding = false;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,7 +263,6 @@ namespace RTE {
 			m_ClientConnections[i].InternalId = RakNet::UNASSIGNED_SYSTEM_ADDRESS;
 			m_ClientConnections[i].ClientId = RakNet::UNASSIGNED_SYSTEM_ADDRESS;
 			m_ClientConnections[i].IsActive = false;
-			m_ClientConnections[i].SendThread = 0;
 
 			m_LZ4CompressionState[i] = malloc(LZ4_sizeofStateHC());
 			m_LZ4FastCompressionState[i] = malloc(LZ4_sizeofState());
@@ -170,6 +277,17 @@ namespace RTE {
 		m_TransmitAsBoxes = g_SettingsMan.GetServerTransmitAsBoxes();
 		m_BoxWidth = g_SettingsMan.GetServerBoxWidth();
 		m_BoxHeight = g_SettingsMan.GetServerBoxHeight();
+		m_UseDeltaCompression = g_SettingsMan.GetServerUseDeltaCompression();
+		m_KeyFrameInterval = g_SettingsMan.GetServerKeyFrameInterval();
+		m_ReplicateEntities = g_SettingsMan.GetServerReplicateEntities();
+		m_UseAdaptiveBitrate = g_SettingsMan.GetServerUseAdaptiveBitrate();
+		m_TargetBandwidth = g_SettingsMan.GetServerTargetBandwidth();
+		m_TargetLatency = g_SettingsMan.GetServerTargetLatency();
+		m_SendInputOverlays = g_SettingsMan.GetServerSendInputOverlays();
+
+		for (short i = 0; i < c_MaxClients; i++) {
+			ResetStreamController(i);
+		}
 
 		return 0;
 	}
@@ -179,8 +297,9 @@ namespace RTE {
 	void NetworkServer::Destroy() {
 		//Send a signal that server is going to shutdown
 		m_IsInServerMode = false;
-		// Wait for thread to shut down
-		RakSleep(250);
+		// Wait for the scheduler and any running send jobs to finish
+		if (m_SendSchedulerThread.joinable()) { m_SendSchedulerThread.join(); }
+		m_ThreadPool.Destroy();
 		m_Server->Shutdown(300);
 		// We're done with the network
 		RakNet::RakPeerInterface::DestroyInstance(m_Server);
@@ -193,6 +312,11 @@ namespace RTE {
 
 			if (m_LZ4FastCompressionState[i]) { free(m_LZ4FastCompressionState[i]); }		
 			m_LZ4FastCompressionState[i] = 0;
+
+			for (FrameBoxEncoder &encoder : m_FrameBoxEncoders[i]) {
+				free(encoder.LZ4CompressionState);
+				free(encoder.LZ4FastCompressionState);
+			}
 		}
 		Clear();
 	}
@@ -256,6 +380,9 @@ namespace RTE {
 		}
 		m_Server->SetOccasionalPing(true);
 		m_Server->SetUnreliableTimeout(50);
+
+		m_ThreadPool.Create();
+		m_SendSchedulerThread = std::thread(SendSchedulerThreadFunction, this);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,24 +395,39 @@ namespace RTE {
 				m_SceneLock[i].unlock();
 			}
 		}
+		if (isLocked) {
+			m_SceneTransferCacheBuildMutex.lock();
+		} else {
+			m_SceneTransferCacheBuildMutex.unlock();
+		}
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void NetworkServer::ResetScene() {
+		m_SceneTransferCacheMutex.lock();
 		m_SceneID++;
+		m_SceneTransferCache.reset();
+		m_SceneTransferCacheChanges.clear();
+		m_SceneTransferCacheMutex.unlock();
+
 		for (int i = 0; i < c_MaxClients; i++) {
 			m_SendSceneSetupData[i] = true;
 			m_SceneAvailable[i] = true;
 			m_SendSceneData[i] = false;
 			m_SendFrameData[i] = false;
 		}
+		if (m_IsInServerMode) { StartSceneTransferCacheBuild(); }
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void NetworkServer::RegisterTerrainChange(SceneMan::TerrainChange terrainChange) {
 		if (m_IsInServerMode) {
+			m_SceneTransferCacheMutex.lock();
+			m_SceneTransferCacheChanges.push_back(terrainChange);
+			bool rebuildSceneTransferCache = m_SceneTransferCacheChanges.size() > c_MaxSceneTransferCacheChanges && !m_SceneTransferCacheBuilding;
+
 			for (short player = 0; player < c_MaxClients; player++) {
 				if (IsPlayerConnected(player)) {
 					m_Mutex[player].lock();
@@ -293,6 +435,10 @@ namespace RTE {
 					m_Mutex[player].unlock();
 				}
 			}
+			m_SceneTransferCacheMutex.unlock();
+
+			// Too many changes to replay to every joining player, so fold them into a fresh cache
+			if (rebuildSceneTransferCache) { StartSceneTransferCacheBuild(); }
 		}
 	}
 
@@ -377,9 +523,6 @@ namespace RTE {
 				m_ClientConnections[index].ClientId = RakNet::UNASSIGNED_SYSTEM_ADDRESS;
 				m_ClientConnections[index].InternalId = RakNet::UNASSIGNED_SYSTEM_ADDRESS;
 
-				//delete m_ClientConnections[index].SendThread;
-				m_ClientConnections[index].SendThread = 0;
-
 				m_SendSceneSetupData[index] = true;
 				m_SendSceneData[index] = false;
 				m_SendFrameData[index] = false;
@@ -410,12 +553,20 @@ namespace RTE {
 
 				m_Server->SetTimeoutTime(5000, m_ClientConnections[index].ClientId);
 
-				m_ClientConnections[index].SendThread = new std::thread(BackgroundSendThreadFunction, this, index);
 				SendAcceptedMsg(index);
 
 				m_SendSceneSetupData[index] = true;
 				m_SendSceneData[index] = false;
 				m_SendFrameData[index] = false;
+
+				// The new client numbers its input from scratch
+				ClearInputMessages(index);
+
+				// A send job from before a quick reconnect may still be around, in which case it just carries on with the new connection
+				m_TimerWheelMutex.lock();
+				bool sendJobScheduled = m_SendJobScheduled[index];
+				m_TimerWheelMutex.unlock();
+				if (!sendJobScheduled) { ScheduleSendJob(index, 0); }
 			}
 		}
 	}
@@ -452,6 +603,7 @@ namespace RTE {
 			MsgInput msg;
 
 			msg.Id = m->Id;
+			msg.InputSequence = m->InputSequence;
 
 			msg.MouseX = m->MouseX;
 			msg.MouseY = m->MouseY;
@@ -492,7 +644,30 @@ namespace RTE {
 				skip = false;
 			}
 
-			if (!skip) { m_InputMessages[player].push(msg); }
+			if (!skip) {
+				m_InputMessages[player].push(msg);
+			} else {
+				// The skipped message is covered by the queued one, so processing that one acknowledges both
+				m_InputMessages[player].back().InputSequence = msg.InputSequence;
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::ReceiveFrameBoxLoss(RakNet::Packet *packet) {
+		if (packet->length < sizeof(RakNet::MessageID) + sizeof(uint32_t)) {
+			return;
+		}
+		uint32_t receipt;
+		memcpy(&receipt, packet->data + sizeof(RakNet::MessageID), sizeof(uint32_t));
+
+		for (short player = 0; player < c_MaxClients; player++) {
+			if (m_ClientConnections[player].ClientId == packet->systemAddress) {
+				std::lock_guard<std::mutex> lostFrameBoxReceiptsLock(m_LostFrameBoxReceiptsMutex);
+				m_LostFrameBoxReceipts[player].push_back(receipt);
+				return;
+			}
 		}
 	}
 
@@ -500,6 +675,8 @@ namespace RTE {
 
 	void NetworkServer::ProcessInputMsg(short player, MsgInput msg) {
 		if (player >= 0 && player < c_MaxClients) {
+			m_LastInputSequence[player] = msg.InputSequence;
+
 			Vector input;
 			input.m_X = msg.MouseX;
 			input.m_Y = msg.MouseY;
@@ -552,6 +729,7 @@ namespace RTE {
 			while (!m_InputMessages[player].empty()) {
 				m_InputMessages[player].pop();
 			}
+			m_LastInputSequence[player] = 0;
 		}
 	}
 
@@ -673,6 +851,7 @@ namespace RTE {
 		msgSceneSetup.Width = static_cast<short>(g_SceneMan.GetSceneWidth());
 		msgSceneSetup.Height = static_cast<short>(g_SceneMan.GetSceneHeight());
 		msgSceneSetup.SceneWrapsX = g_SceneMan.SceneWrapsX();
+		msgSceneSetup.ReplicateEntities = m_ReplicateEntities;
 
 		Scene *scene = g_SceneMan.GetScene();
 
@@ -713,6 +892,11 @@ namespace RTE {
 		}
 		msgSceneSetup.BackgroundLayerCount = index;
 
+		// The client starts the new scene with fresh buffers, so nothing it had before can be used as a delta reference
+		ResetFrameDeltaState(player);
+		// It also forgets the entity presets it was sent, so send them again
+		m_EntityPresetsSent[player] = 0;
+
 		int payloadSize = sizeof(MsgSceneSetup);
 
 		m_Server->Send((const char *)&msgSceneSetup, payloadSize, HIGH_PRIORITY, RELIABLE_SEQUENCED, 0, m_ClientConnections[player].ClientId, false);
@@ -757,113 +941,171 @@ namespace RTE {
 		// Check for congestion
 		RakNet::RakNetStatistics rns;
 
-		MsgSceneLine *sceneData = (MsgSceneLine *)m_PixelLineBuffer[player];
+		m_SceneTransferCacheMutex.lock();
+		std::shared_ptr<const SceneTransferCache> sceneTransferCache = m_SceneTransferCache;
+		bool cacheIsCurrent = sceneTransferCache && sceneTransferCache->SceneID == m_SceneID;
+		if (cacheIsCurrent) {
+			// The cache already contains everything changed before it was built, so only what changed since needs to be sent on top of it
+			ClearTerrainChangeQueue(player);
+			m_Mutex[player].lock();
+			for (const SceneMan::TerrainChange &terrainChange : m_SceneTransferCacheChanges) {
+				m_PendingTerrainChanges[player].push(terrainChange);
+			}
+			m_Mutex[player].unlock();
+		}
+		m_SceneTransferCacheMutex.unlock();
 
-		// Save message ID
-		sceneData->Id = ID_SRV_SCENE;
+		// The cache is still being built, try again on the next send
+		if (!cacheIsCurrent) {
+			return;
+		}
 
-		int lineX = 0;
-		int lineY = 0;
-		int lineWidth = 1280;
+		const unsigned char *packet = sceneTransferCache->Packets.data();
 
-		Scene *scene = g_SceneMan.GetScene();
-		SLTerrain *terrain = 0;
+		for (size_t i = 0; i < sceneTransferCache->PacketSizes.size(); i++) {
+			const MsgSceneLine *sceneData = (const MsgSceneLine *)packet;
+			int payloadSize = sceneTransferCache->PacketSizes[i];
 
-		if (scene) {
-			terrain = scene->GetTerrain();
-			if (!terrain) {
-				return;
-			}
-		} else {
-			return;
-		}
+			m_Server->Send((const char *)sceneData, payloadSize, HIGH_PRIORITY, RELIABLE, 0, m_ClientConnections[player].ClientId, false);
+			packet += payloadSize;
 
-		// Lock the scene until current bitmap is fully transfered
-		m_SceneLock[player].lock();
+			m_DataSentCurrent[player][STAT_CURRENT] += payloadSize;
+			m_DataSentTotal[player] += payloadSize;
 
-		for (int layer = 0; layer < 2; layer++) {
-			BITMAP *bmp = 0;
-			if (layer == 0) {
-				bmp = terrain->GetBGColorBitmap();
-			} else if (layer == 1) {
-				bmp = terrain->GetFGColorBitmap();
-			}
+			m_TerrainDataSentCurrent[player][STAT_CURRENT] += payloadSize;
+			m_TerrainDataSentTotal[player] += payloadSize;
 
-			lock_bitmap(bmp);
+			m_DataUncompressedCurrent[player][STAT_CURRENT] += sceneData->UncompressedSize;
+			m_DataUncompressedTotal[player] += sceneData->UncompressedSize;
 
-			for (lineX = 0; ; lineX += lineWidth) {
-				int width = lineWidth;
-				if (lineX + width >= g_SceneMan.GetSceneWidth()) { width = g_SceneMan.GetSceneWidth() - lineX; }
+			// Wait for the  messages to leave to avoid congestion
+			if (i % 250 == 0) {
+				do {
+					m_Server->GetStatistics(m_ClientConnections[player].ClientId, &rns);
 
-				for (lineY = 0; lineY < g_SceneMan.GetSceneHeight(); lineY++) {
-					// Save scene fragment data
-					sceneData->DataSize = width;
-					sceneData->UncompressedSize = width;
-					sceneData->Layer = layer;
-					sceneData->X = lineX;
-					sceneData->Y = lineY;
-					sceneData->SceneId = m_SceneID;
+					m_SendBufferBytes[player] = (int)rns.bytesInSendBuffer[MEDIUM_PRIORITY] + (int)rns.bytesInSendBuffer[HIGH_PRIORITY];
+					m_SendBufferMessages[player] = (int)rns.messageInSendBuffer[MEDIUM_PRIORITY] + (int)rns.messageInSendBuffer[HIGH_PRIORITY];
 
-					// Compression section
-					int result = 0;
-					//bool lineIsEmpty = false;
+					RakSleep(25);
+				} while (rns.messageInSendBuffer[HIGH_PRIORITY] > 1000 && IsPlayerConnected(player));
 
-					result = LZ4_compress_HC_extStateHC(m_LZ4CompressionState[player], (char *)bmp->line[lineY] + lineX, (char *)(m_PixelLineBuffer[player] + sizeof(MsgSceneLine)), width, width, LZ4HC_CLEVEL_MAX);
+				if (!IsPlayerConnected(player)) {
+					break;
+				}
+			}
+		}
 
-					// Compression failed or ineffective, send as is
-					if (result == 0 || result == width) {
-#ifdef _WIN32
-						memcpy_s(m_PixelLineBuffer[player] + sizeof(MsgSceneLine), c_MaxPixelLineBufferSize, bmp->line[lineY] + lineX, width);
-#else
-						memcpy(m_PixelLineBuffer[player] + sizeof(MsgSceneLine), bmp->line[lineY] + lineX, width);
-#endif
-					} else {
-						sceneData->DataSize = result;
-					}
+		m_SendSceneSetupData[player] = false;
+		m_SendSceneData[player] = false;
+		m_SendFrameData[player] = false;
 
-					int payloadSize = sceneData->DataSize + sizeof(MsgSceneLine);
+		SendSceneEndMsg(player);
+	}
 
-					m_Server->Send((const char *)sceneData, payloadSize, HIGH_PRIORITY, RELIABLE, 0, m_ClientConnections[player].ClientId, false);
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-					m_DataSentCurrent[player][STAT_CURRENT] += payloadSize;
-					m_DataSentTotal[player] += payloadSize;
+	void NetworkServer::StartSceneTransferCacheBuild() {
+		m_SceneTransferCacheMutex.lock();
+		if (m_SceneTransferCacheBuilding) {
+			m_SceneTransferCacheMutex.unlock();
+			return;
+		}
+		m_SceneTransferCacheBuilding = true;
+		unsigned char sceneID = m_SceneID;
+		size_t changesBeforeBuild = m_SceneTransferCacheChanges.size();
+		m_SceneTransferCacheMutex.unlock();
 
-					m_TerrainDataSentCurrent[player][STAT_CURRENT] += payloadSize;
-					m_TerrainDataSentTotal[player] += payloadSize;
+		m_ThreadPool.AddJob([this, sceneID, changesBeforeBuild]() { BuildSceneTransferCache(sceneID, changesBeforeBuild); });
+	}
 
-					m_DataUncompressedCurrent[player][STAT_CURRENT] += sceneData->UncompressedSize;
-					m_DataUncompressedTotal[player] += sceneData->UncompressedSize;
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-					// Wait for the  messages to leave to avoid congestion
-					if (lineY % 250 == 0) {
-						do {
-							m_Server->GetStatistics(m_ClientConnections[player].ClientId, &rns);
+	void NetworkServer::BuildSceneTransferCache(unsigned char sceneID, size_t changesBeforeBuild) {
+		std::shared_ptr<SceneTransferCache> sceneTransferCache;
 
-							m_SendBufferBytes[player] = (int)rns.bytesInSendBuffer[MEDIUM_PRIORITY] + (int)rns.bytesInSendBuffer[HIGH_PRIORITY];
-							m_SendBufferMessages[player] = (int)rns.messageInSendBuffer[MEDIUM_PRIORITY] + (int)rns.messageInSendBuffer[HIGH_PRIORITY];
+		// Keep the scene from being swapped out until the terrain is fully compressed
+		m_SceneTransferCacheBuildMutex.lock();
 
-							RakSleep(25);
-						} while (rns.messageInSendBuffer[HIGH_PRIORITY] > 1000 && IsPlayerConnected(player));
+		Scene *scene = g_SceneMan.GetScene();
+		SLTerrain *terrain = scene ? scene->GetTerrain() : nullptr;
+
+		if (terrain && sceneID == m_SceneID) {
+			int sceneWidth = g_SceneMan.GetSceneWidth();
+			int sceneHeight = g_SceneMan.GetSceneHeight();
+			int lineWidth = 1280;
+			int columnCount = (sceneWidth + lineWidth - 1) / lineWidth;
+
+			// Every column of each layer is compressed by its own job, then they're joined in the order they're sent in
+			std::vector<SceneTransferCache> columns(2 * columnCount);
+			std::vector<std::future<void>> columnJobs;
+
+			for (int layer = 0; layer < 2; layer++) {
+				const BITMAP *bmp = (layer == 0) ? terrain->GetBGColorBitmap() : terrain->GetFGColorBitmap();
+
+				for (int column = 0; column < columnCount; column++) {
+					SceneTransferCache &columnCache = columns[layer * columnCount + column];
+					int lineX = column * lineWidth;
+					int width = std::min(lineWidth, sceneWidth - lineX);
+
+					columnJobs.push_back(m_ThreadPool.AddJob([&columnCache, bmp, sceneID, sceneHeight, layer, lineX, width]() {
+						void *compressionState = malloc(LZ4_sizeofStateHC());
+
+						for (int lineY = 0; lineY < sceneHeight; lineY++) {
+							size_t packetOffset = columnCache.Packets.size();
+							columnCache.Packets.resize(packetOffset + sizeof(MsgSceneLine) + width);
+
+							MsgSceneLine *sceneData = (MsgSceneLine *)(columnCache.Packets.data() + packetOffset);
+							sceneData->Id = ID_SRV_SCENE;
+							sceneData->SceneId = sceneID;
+							sceneData->X = lineX;
+							sceneData->Y = lineY;
+							sceneData->Width = width;
+							sceneData->Layer = layer;
+							sceneData->DataSize = width;
+							sceneData->UncompressedSize = width;
+
+							char *lineData = (char *)(columnCache.Packets.data() + packetOffset + sizeof(MsgSceneLine));
+							int result = LZ4_compress_HC_extStateHC(compressionState, (char *)bmp->line[lineY] + lineX, lineData, width, width, LZ4HC_CLEVEL_MAX);
 
-						if (!IsPlayerConnected(player)) {
-							break;
+							// Compression failed or ineffective, send as is
+							if (result == 0 || result >= width) {
+								memcpy(lineData, bmp->line[lineY] + lineX, width);
+							} else {
+								sceneData->DataSize = result;
+							}
+
+							int payloadSize = sceneData->DataSize + sizeof(MsgSceneLine);
+							columnCache.Packets.resize(packetOffset + payloadSize);
+							columnCache.PacketSizes.push_back(payloadSize);
 						}
-					}
-				}
-				if (lineX + lineWidth >= g_SceneMan.GetSceneWidth()) {
-					break;
+						free(compressionState);
+					}));
 				}
 			}
-			release_bitmap(bmp);
-		}
-
-		m_SceneLock[player].unlock();
+			for (std::future<void> &columnJob : columnJobs) {
+				m_ThreadPool.WaitForJob(columnJob);
+			}
 
-		m_SendSceneSetupData[player] = false;
-		m_SendSceneData[player] = false;
-		m_SendFrameData[player] = false;
+			sceneTransferCache = std::make_shared<SceneTransferCache>();
+			sceneTransferCache->SceneID = sceneID;
+			for (const SceneTransferCache &columnCache : columns) {
+				sceneTransferCache->Packets.insert(sceneTransferCache->Packets.end(), columnCache.Packets.begin(), columnCache.Packets.end());
+				sceneTransferCache->PacketSizes.insert(sceneTransferCache->PacketSizes.end(), columnCache.PacketSizes.begin(), columnCache.PacketSizes.end());
+			}
+		}
+		m_SceneTransferCacheBuildMutex.unlock();
+
+		m_SceneTransferCacheMutex.lock();
+		m_SceneTransferCacheBuilding = false;
+		bool sceneChanged = sceneID != m_SceneID;
+		if (sceneTransferCache && !sceneChanged) {
+			m_SceneTransferCache = sceneTransferCache;
+			m_SceneTransferCacheChanges.erase(m_SceneTransferCacheChanges.begin(), m_SceneTransferCacheChanges.begin() + changesBeforeBuild);
+		}
+		m_SceneTransferCacheMutex.unlock();
 
-		SendSceneEndMsg(player);
+		// A new scene was loaded while building, and its build was left to this one to start once done
+		if (sceneChanged) { StartSceneTransferCacheBuild(); }
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -877,6 +1119,9 @@ namespace RTE {
 			m_CurrentTerrainChanges[player].pop();
 		}
 		m_Mutex[player].unlock();
+
+		std::fill(m_DirtyTerrainTiles[player].begin(), m_DirtyTerrainTiles[player].end(), 0);
+		m_DirtyTerrainTileIndices[player].clear();
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -901,129 +1146,166 @@ namespace RTE {
 		}
 		m_Mutex[player].unlock();
 
-		while (!m_CurrentTerrainChanges[player].empty()) {
-			int maxSize = 1280;
+		int sceneWidth = g_SceneMan.GetSceneWidth();
+		int sceneHeight = g_SceneMan.GetSceneHeight();
+		int tilesX = (sceneWidth + c_TerrainTileSize - 1) / c_TerrainTileSize;
+		int tilesY = (sceneHeight + c_TerrainTileSize - 1) / c_TerrainTileSize;
 
-			SceneMan::TerrainChange terrainChange = m_CurrentTerrainChanges[player].front();
-			m_CurrentTerrainChanges[player].pop();
+		std::vector<unsigned char> &dirtyTiles = m_DirtyTerrainTiles[player];
+		std::vector<int> &dirtyTileIndices = m_DirtyTerrainTileIndices[player];
 
-			// Fragment region if it does not fit one packet
-			if (terrainChange.w * terrainChange.h > maxSize) {
-				int size = 0;
-				int height = 1;
-				int heightStart = 0;
-
-				for (int y = 0; y < terrainChange.h; y++) {
-					height++;
-					size += terrainChange.w;
-
-					// Store changed block if the size is over the MTU or if it's the last block.
-					if (size + terrainChange.w >= maxSize || y == terrainChange.h - 1) {
-						SceneMan::TerrainChange tcf;
-						tcf.x = terrainChange.x;
-						tcf.y = terrainChange.y + heightStart;
-						tcf.w = terrainChange.w;
-						tcf.h = height;
-						tcf.back = terrainChange.back;
-						tcf.color = terrainChange.color;
-
-						SendTerrainChangeMsg(player, tcf);
-
-						size = 0;
-						heightStart = y;
-						height = 1;
+		if (dirtyTiles.size() != static_cast<size_t>(2 * tilesX * tilesY)) {
+			dirtyTiles.assign(2 * tilesX * tilesY, 0);
+			dirtyTileIndices.clear();
+		}
+
+		// Changes are only recorded as dirty tiles here, the tiles' current content is read when sending so any number of changes to a tile cost the same
+		while (!m_CurrentTerrainChanges[player].empty()) {
+			const SceneMan::TerrainChange &terrainChange = m_CurrentTerrainChanges[player].front();
+
+			// SceneMan already splits changes crossing the wrap seam, so clipping to the scene is enough
+			int left = std::max(terrainChange.x, 0);
+			int top = std::max(terrainChange.y, 0);
+			int right = std::min(terrainChange.x + terrainChange.w, sceneWidth);
+			int bottom = std::min(terrainChange.y + terrainChange.h, sceneHeight);
+
+			if (left < right && top < bottom) {
+				int layerOffset = terrainChange.back ? tilesX * tilesY : 0;
+
+				for (int tileY = top / c_TerrainTileSize; tileY <= (bottom - 1) / c_TerrainTileSize; tileY++) {
+					for (int tileX = left / c_TerrainTileSize; tileX <= (right - 1) / c_TerrainTileSize; tileX++) {
+						int tileIndex = layerOffset + tileY * tilesX + tileX;
+						if (!dirtyTiles[tileIndex]) {
+							dirtyTiles[tileIndex] = 1;
+							dirtyTileIndices.push_back(tileIndex);
+						}
 					}
 				}
-			} else {
-				SendTerrainChangeMsg(player, terrainChange);
 			}
+			m_CurrentTerrainChanges[player].pop();
 		}
+
+		SendTerrainChangeMsg(player);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void NetworkServer::SendTerrainChangeMsg(short player, SceneMan::TerrainChange terrainChange) {
-		if (terrainChange.w == 1 && terrainChange.h == 1) {
-			MsgTerrainChange msg;
-			msg.Id = ID_SRV_TERRAIN;
-			msg.X = terrainChange.x;
-			msg.Y = terrainChange.y;
-			msg.W = terrainChange.w;
-			msg.H = terrainChange.h;
-			msg.DataSize = 0;
-			msg.UncompressedSize = 0;
-			msg.SceneId = m_SceneID;
-			msg.Color = terrainChange.color;
-			msg.Back = terrainChange.back;
+	void NetworkServer::SendTerrainChangeMsg(short player) {
+		std::vector<int> &dirtyTileIndices = m_DirtyTerrainTileIndices[player];
+		if (dirtyTileIndices.empty()) {
+			return;
+		}
 
-			int payloadSize = sizeof(MsgTerrainChange);
+		Scene *scene = g_SceneMan.GetScene();
+		SLTerrain *terrain = scene ? scene->GetTerrain() : nullptr;
+		if (!terrain) {
+			ClearTerrainChangeQueue(player);
+			return;
+		}
 
-			m_Server->Send((const char *)&msg, payloadSize, MEDIUM_PRIORITY, RELIABLE, 0, m_ClientConnections[player].ClientId, false);
+		int sceneWidth = g_SceneMan.GetSceneWidth();
+		int sceneHeight = g_SceneMan.GetSceneHeight();
+		int tilesX = (sceneWidth + c_TerrainTileSize - 1) / c_TerrainTileSize;
+		int tilesPerLayer = tilesX * ((sceneHeight + c_TerrainTileSize - 1) / c_TerrainTileSize);
 
-			m_DataSentCurrent[player][STAT_CURRENT] += payloadSize;
-			m_DataSentTotal[player] += payloadSize;
+		// A tile where every pixel differs from the next takes a run per pixel
+		const size_t maxTileSize = sizeof(TerrainTileNetworkData) + c_TerrainTileSize * c_TerrainTileSize * 2;
 
-			m_TerrainDataSentCurrent[player][STAT_CURRENT] += payloadSize;
-			m_TerrainDataSentTotal[player] += payloadSize;
+		std::vector<unsigned char> &payload = m_TerrainChangePayload[player];
+		payload.clear();
+		int tileCount = 0;
 
-			m_DataUncompressedCurrent[player][STAT_CURRENT] += payloadSize;
-			m_DataUncompressedTotal[player] += payloadSize;
-		} else {
-			MsgTerrainChange *msg = (MsgTerrainChange *)m_PixelLineBuffer[player];
-			msg->Id = ID_SRV_TERRAIN;
-			msg->X = terrainChange.x;
-			msg->Y = terrainChange.y;
-			msg->W = terrainChange.w;
-			msg->H = terrainChange.h;
-			int size = msg->W * msg->H;
-			msg->DataSize = size;
-			msg->UncompressedSize = size;
-			msg->SceneId = m_SceneID;
-			msg->Color = terrainChange.color;
-			msg->Back = terrainChange.back;
+		for (int tileIndex : dirtyTileIndices) {
+			m_DirtyTerrainTiles[player][tileIndex] = 0;
 
-			Scene * scene = g_SceneMan.GetScene();
-			SLTerrain * terrain = scene->GetTerrain();
+			bool back = tileIndex >= tilesPerLayer;
+			int layerTileIndex = tileIndex % tilesPerLayer;
+			int x = (layerTileIndex % tilesX) * c_TerrainTileSize;
+			int y = (layerTileIndex / tilesX) * c_TerrainTileSize;
+			int width = std::min(c_TerrainTileSize, sceneWidth - x);
+			int height = std::min(c_TerrainTileSize, sceneHeight - y);
 
-			const BITMAP *bmp = 0;
-			bmp = msg->Back ? terrain->GetBGColorBitmap() : terrain->GetFGColorBitmap();
+			const BITMAP *bmp = back ? terrain->GetBGColorBitmap() : terrain->GetFGColorBitmap();
 
-			unsigned char *dest = (unsigned char *)(m_TerrainChangeBuffer[player]);
+			size_t tileOffset = payload.size();
+			payload.resize(tileOffset + sizeof(TerrainTileNetworkData));
+			int runCount = 0;
 
-			// Copy bitmap data
-			for (int y = 0; y < msg->H && msg->Y + y < bmp->h; y++) {
-				memcpy(dest, bmp->line[msg->Y + y] + msg->X, msg->W);
-				dest += msg->W;
+			for (int line = 0; line < height; line++) {
+				const unsigned char *pixel = bmp->line[y + line] + x;
+
+				for (int px = 0; px < width;) {
+					unsigned char color = pixel[px];
+					int length = 1;
+					while (px + length < width && length < 255 && pixel[px + length] == color) {
+						length++;
+					}
+					payload.push_back(static_cast<unsigned char>(length));
+					payload.push_back(color);
+					runCount++;
+					px += length;
+				}
 			}
 
-			int result = 0;
+			TerrainTileNetworkData *tileData = (TerrainTileNetworkData *)(payload.data() + tileOffset);
+			tileData->X = x;
+			tileData->Y = y;
+			tileData->Width = width;
+			tileData->Height = height;
+			tileData->Back = back;
+			tileData->RunCount = runCount;
+			tileCount++;
+
+			if (payload.size() + maxTileSize > c_MaxTerrainChangePayloadSize) {
+				SendTerrainChangePayload(player, tileCount);
+				payload.clear();
+				tileCount = 0;
+			}
+		}
+		if (tileCount > 0) { SendTerrainChangePayload(player, tileCount); }
 
-			result = LZ4_compress_HC_extStateHC(m_LZ4CompressionState[player], (char *)m_TerrainChangeBuffer[player], (char *)(m_PixelLineBuffer[player] + sizeof(MsgTerrainChange)), size, size, LZ4HC_CLEVEL_OPT_MIN);
+		dirtyTileIndices.clear();
+	}
 
-			// Compression failed or ineffective, send as is
-			if (result == 0 || result == size) {
-#ifdef _WIN32
-				memcpy_s(m_PixelLineBuffer[player] + sizeof(MsgTerrainChange), c_MaxPixelLineBufferSize, m_TerrainChangeBuffer[player], size);
-#else
-				memcpy(m_PixelLineBuffer[player] + sizeof(MsgTerrainChange), m_TerrainChangeBuffer[player], size);
-#endif
-			} else {
-				msg->DataSize = result;
-			}
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-			int payloadSize = sizeof(MsgTerrainChange) + msg->DataSize;
+	void NetworkServer::SendTerrainChangePayload(short player, int tileCount) {
+		const std::vector<unsigned char> &payload = m_TerrainChangePayload[player];
+		std::vector<unsigned char> &message = m_TerrainChangeMessage[player];
 
-			m_Server->Send((const char *)msg, payloadSize, MEDIUM_PRIORITY, RELIABLE, 0, m_ClientConnections[player].ClientId, false);
+		int size = static_cast<int>(payload.size());
+		int maxCompressedSize = LZ4_compressBound(size);
+		message.resize(sizeof(MsgTerrainChange) + maxCompressedSize);
 
-			m_DataSentCurrent[player][STAT_CURRENT] += payloadSize;
-			m_DataSentTotal[player] += payloadSize;
+		MsgTerrainChange *msg = (MsgTerrainChange *)message.data();
+		msg->Id = ID_SRV_TERRAIN;
+		msg->SceneId = m_SceneID;
+		msg->TileCount = tileCount;
+		msg->DataSize = size;
+		msg->UncompressedSize = size;
 
-			m_TerrainDataSentCurrent[player][STAT_CURRENT] += payloadSize;
-			m_TerrainDataSentTotal[player] += payloadSize;
+		int result = LZ4_compress_fast_extState(m_LZ4FastCompressionState[player], (const char *)payload.data(), (char *)(message.data() + sizeof(MsgTerrainChange)), size, maxCompressedSize, 1);
 
-			m_DataUncompressedCurrent[player][STAT_CURRENT] += msg->UncompressedSize;
-			m_DataUncompressedTotal[player] += msg->UncompressedSize;
+		// Compression failed or ineffective, send as is
+		if (result == 0 || result >= size) {
+			memcpy(message.data() + sizeof(MsgTerrainChange), payload.data(), size);
+		} else {
+			msg->DataSize = result;
 		}
+
+		int payloadSize = sizeof(MsgTerrainChange) + msg->DataSize;
+
+		// Tiles carry their full content, so a later message about a tile must not be overtaken by an earlier one
+		m_Server->Send((const char *)msg, payloadSize, MEDIUM_PRIORITY, RELIABLE_ORDERED, 1, m_ClientConnections[player].ClientId, false);
+
+		m_DataSentCurrent[player][STAT_CURRENT] += payloadSize;
+		m_DataSentTotal[player] += payloadSize;
+
+		m_TerrainDataSentCurrent[player][STAT_CURRENT] += payloadSize;
+		m_TerrainDataSentTotal[player] += payloadSize;
+
+		m_DataUncompressedCurrent[player][STAT_CURRENT] += msg->UncompressedSize;
+		m_DataUncompressedTotal[player] += msg->UncompressedSize;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1047,6 +1329,15 @@ namespace RTE {
 	void NetworkServer::CreateBackBuffer(short player, int w, int h) {
 		m_BackBuffer8[player] = create_bitmap_ex(8, w, h);
 		m_BackBufferGUI8[player] = create_bitmap_ex(8, w, h);
+
+		m_SentBackBuffer8[player] = create_bitmap_ex(8, w, h);
+		m_SentBackBufferGUI8[player] = create_bitmap_ex(8, w, h);
+
+		int boxCount = (w / m_StreamControllers[player].BoxWidth + 1) * (h / m_StreamControllers[player].BoxHeight + 1);
+		for (int layer = 0; layer < 2; layer++) {
+			m_SentBoxFrameNumbers[player][layer].resize(boxCount);
+		}
+		ResetFrameDeltaState(player);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1057,6 +1348,374 @@ namespace RTE {
 
 		if (m_BackBufferGUI8) { destroy_bitmap(m_BackBufferGUI8[player]); }
 		m_BackBufferGUI8[player] = 0;
+
+		destroy_bitmap(m_SentBackBuffer8[player]);
+		m_SentBackBuffer8[player] = 0;
+
+		destroy_bitmap(m_SentBackBufferGUI8[player]);
+		m_SentBackBufferGUI8[player] = 0;
+
+		for (int layer = 0; layer < 2; layer++) {
+			m_SentBoxFrameNumbers[player][layer].clear();
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::ResetFrameDeltaState(short player) {
+		for (int layer = 0; layer < 2; layer++) {
+			std::fill(m_SentBoxFrameNumbers[player][layer].begin(), m_SentBoxFrameNumbers[player][layer].end(), 0);
+		}
+		m_FramesSinceKeyFrame[player] = 0;
+
+		m_SentFrameBoxes[player].clear();
+		std::lock_guard<std::mutex> lostFrameBoxReceiptsLock(m_LostFrameBoxReceiptsMutex);
+		m_LostFrameBoxReceipts[player].clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::HandleLostFrameBoxes(short player) {
+		std::vector<uint32_t> lostReceipts;
+		{
+			std::lock_guard<std::mutex> lostFrameBoxReceiptsLock(m_LostFrameBoxReceiptsMutex);
+			lostReceipts.swap(m_LostFrameBoxReceipts[player]);
+		}
+		std::deque<SentFrameBox> &sentFrameBoxes = m_SentFrameBoxes[player];
+
+		// Receipt numbers only ever go up, so the sent boxes are sorted by them
+		for (uint32_t lostReceipt : lostReceipts) {
+			std::deque<SentFrameBox>::iterator sentFrameBox = std::lower_bound(sentFrameBoxes.begin(), sentFrameBoxes.end(), lostReceipt, [](const SentFrameBox &lhs, uint32_t receipt) { return lhs.Receipt < receipt; });
+			if (sentFrameBox != sentFrameBoxes.end() && sentFrameBox->Receipt == lostReceipt) {
+				std::vector<unsigned short> &sentBoxFrameNumbers = m_SentBoxFrameNumbers[player][sentFrameBox->Layer];
+				// Sending the box again in full also replaces whatever deltas were made against the lost content since
+				if (sentFrameBox->BoxIndex < static_cast<int>(sentBoxFrameNumbers.size())) { sentBoxFrameNumbers[sentFrameBox->BoxIndex] = 0; }
+			}
+		}
+		while (!sentFrameBoxes.empty() && static_cast<unsigned short>(m_BoxFrameNumbers[player] - sentFrameBoxes.front().BoxFrameNumber) > c_SentFrameBoxesTrackedFrames) {
+			sentFrameBoxes.pop_front();
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::SetInterlacingMode(bool newMode) {
+		m_UseInterlacing = newMode;
+		for (short player = 0; player < c_MaxClients; player++) {
+			m_StreamControllers[player].UseInterlacing = newMode || c_StreamQualityLevels[m_StreamControllers[player].QualityLevel].UseInterlacing;
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::ResetStreamController(short player) {
+		StreamController &streamController = m_StreamControllers[player];
+		streamController.HighCompressionLevel = m_HighCompressionLevel;
+		streamController.FastAccelerationFactor = m_FastAccelerationFactor;
+
+		streamController.Bandwidth = 0;
+		streamController.Latency = 0;
+		streamController.CompressionRatio = 0;
+		streamController.EncodeMsec = 0;
+		streamController.CongestedFrames = 0;
+		streamController.SpareWindows = 0;
+
+		// The window is left to expire right away, the first one after a reset only marks where measuring starts
+		streamController.WindowStartTime = 0;
+		streamController.WindowFrames = 0;
+		streamController.WindowCongestedFrames = 0;
+		streamController.WindowEncodeMsec = 0;
+
+		SetStreamQualityLevel(player, 0);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::UpdateStreamController(short player, bool congested) {
+		StreamController &streamController = m_StreamControllers[player];
+		streamController.WindowFrames++;
+		if (congested) { streamController.WindowCongestedFrames++; }
+
+		long long currentTicks = g_TimerMan.GetRealTickCount();
+		double windowSecs = static_cast<double>(currentTicks - streamController.WindowStartTime) / static_cast<double>(g_TimerMan.GetTicksPerSecond());
+		if (windowSecs >= 0 && windowSecs * 1000.0 < static_cast<double>(c_StreamControllerWindowMsec)) {
+			return;
+		}
+
+		// A window that ran much longer than it should have means the stream was paused, e.g. while a scene was loading, so what was measured in it says nothing about the connection
+		if (windowSecs > 0 && windowSecs * 1000.0 < static_cast<double>(c_StreamControllerWindowMsec * 4)) {
+			unsigned long dataSent = m_DataSentTotal[player] - streamController.WindowStartDataSent;
+			unsigned long dataUncompressed = m_DataUncompressedTotal[player] - streamController.WindowStartDataUncompressed;
+			int sentFrames = streamController.WindowFrames - streamController.WindowCongestedFrames;
+
+			streamController.Bandwidth = static_cast<int>(static_cast<double>(dataSent) * 8.0 / 1000.0 / windowSecs);
+			streamController.CompressionRatio = (dataUncompressed > 0) ? static_cast<double>(dataSent) / static_cast<double>(dataUncompressed) : 0;
+			streamController.EncodeMsec = (sentFrames > 0) ? streamController.WindowEncodeMsec / sentFrames : 0;
+			streamController.CongestedFrames = streamController.WindowCongestedFrames;
+
+			// Bits divided by kbit per second comes out in ms
+			int sendBufferDrainMsec = (streamController.Bandwidth > 0) ? static_cast<int>(static_cast<long long>(m_SendBufferBytes[player]) * 8 / streamController.Bandwidth) : 0;
+			streamController.Latency = m_Ping[player] + sendBufferDrainMsec;
+
+			int frameBudgetMsec = 1000 / std::max(streamController.EncodingFps, 1);
+			bool overBandwidth = streamController.Bandwidth > m_TargetBandwidth;
+			bool overLatency = streamController.Latency > m_TargetLatency;
+			bool lowestQuality = streamController.QualityLevel >= static_cast<int>(c_StreamQualityLevels.size()) - 1;
+
+			// Fast compression trades ratio for speed the other way around, so a higher acceleration factor means less compression
+			auto raiseCompression = [this, &streamController]() {
+				if (m_UseHighCompression && streamController.HighCompressionLevel < LZ4HC_CLEVEL_MAX) {
+					streamController.HighCompressionLevel++;
+					return true;
+				} else if (!m_UseHighCompression && m_UseFastCompression && streamController.FastAccelerationFactor > 1) {
+					streamController.FastAccelerationFactor--;
+					return true;
+				}
+				return false;
+			};
+			auto lowerCompression = [this, &streamController](int highCompressionLevelFloor, int fastAccelerationFactorCeiling) {
+				if (m_UseHighCompression && streamController.HighCompressionLevel > highCompressionLevelFloor) {
+					streamController.HighCompressionLevel--;
+					return true;
+				} else if (!m_UseHighCompression && m_UseFastCompression && streamController.FastAccelerationFactor < fastAccelerationFactorCeiling) {
+					streamController.FastAccelerationFactor++;
+					return true;
+				}
+				return false;
+			};
+
+			if (streamController.CongestedFrames > 0 || overBandwidth || overLatency) {
+				streamController.SpareWindows = 0;
+				// Squeezing frames harder is the cheapest way to save bandwidth while there's time to spare in the frame, but it won't clear a backlog quickly enough, that needs less data per second outright
+				bool compressionRaised = overBandwidth && !overLatency && streamController.CongestedFrames == 0 && streamController.EncodeMsec * 2 < frameBudgetMsec && raiseCompression();
+				if (!compressionRaised && !lowestQuality) { SetStreamQualityLevel(player, streamController.QualityLevel + 1); }
+			} else if (streamController.EncodeMsec * 4 > frameBudgetMsec * 3) {
+				// Encoding can't keep up with the frame rate, which shows up as frames arriving late and unevenly
+				streamController.SpareWindows = 0;
+				if (!lowerCompression(LZ4HC_CLEVEL_MIN, c_MaxAdaptiveFastAccelerationFactor) && !lowestQuality) { SetStreamQualityLevel(player, streamController.QualityLevel + 1); }
+			} else if (streamController.Bandwidth * 10 < m_TargetBandwidth * 7 && streamController.Latency * 10 < m_TargetLatency * 7) {
+				streamController.SpareWindows++;
+				if (streamController.SpareWindows >= c_StreamControllerSpareWindowsToRaise) {
+					streamController.SpareWindows = 0;
+					if (streamController.QualityLevel > 0) {
+						SetStreamQualityLevel(player, streamController.QualityLevel - 1);
+					} else {
+						// Back at full quality with bandwidth to spare, so any extra compression only costs CPU time
+						lowerCompression(m_HighCompressionLevel, m_FastAccelerationFactor);
+					}
+				}
+			} else {
+				streamController.SpareWindows = 0;
+			}
+		}
+
+		streamController.WindowStartTime = currentTicks;
+		streamController.WindowStartDataSent = m_DataSentTotal[player];
+		streamController.WindowStartDataUncompressed = m_DataUncompressedTotal[player];
+		streamController.WindowFrames = 0;
+		streamController.WindowCongestedFrames = 0;
+		streamController.WindowEncodeMsec = 0;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::SetStreamQualityLevel(short player, int qualityLevel) {
+		StreamController &streamController = m_StreamControllers[player];
+		const StreamQualityLevel &streamQualityLevel = c_StreamQualityLevels[qualityLevel];
+
+		streamController.QualityLevel = qualityLevel;
+		streamController.EncodingFps = std::max(m_EncodingFps * streamQualityLevel.FpsPercent / 100, std::min(m_EncodingFps, c_MinAdaptiveEncodingFps));
+		streamController.UseInterlacing = m_UseInterlacing || streamQualityLevel.UseInterlacing;
+
+		// Scaled boxes still have to fit in a box message and the client's decoding buffer
+		int boxScale = streamQualityLevel.BoxScale;
+		while (boxScale > 1 && (m_BoxWidth * boxScale > std::numeric_limits<unsigned char>::max() || m_BoxHeight * boxScale > std::numeric_limits<unsigned char>::max() || m_BoxWidth * m_BoxHeight * boxScale * boxScale > c_MaxPixelLineBufferSize)) {
+			boxScale--;
+		}
+		int boxWidth = m_BoxWidth * boxScale;
+		int boxHeight = m_BoxHeight * boxScale;
+
+		if (boxWidth != streamController.BoxWidth || boxHeight != streamController.BoxHeight) {
+			streamController.BoxWidth = boxWidth;
+			streamController.BoxHeight = boxHeight;
+
+			// What was last sent is tracked per box, so it can't carry over to a different box layout
+			if (m_BackBuffer8[player]) {
+				int boxCount = (m_BackBuffer8[player]->w / boxWidth + 1) * (m_BackBuffer8[player]->h / boxHeight + 1);
+				for (int layer = 0; layer < 2; layer++) {
+					m_SentBoxFrameNumbers[player][layer].resize(boxCount);
+				}
+				ResetFrameDeltaState(player);
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int NetworkServer::PrepareFrameBoxDelta(short player, short layer, int boxIndex, unsigned char *boxData, int bpx, int bpy, int width, int height, bool isKeyFrame, bool allowDelta) {
+		BITMAP *sentBuffer = (layer == 0) ? m_SentBackBuffer8[player] : m_SentBackBufferGUI8[player];
+		unsigned short &sentFrameNumber = m_SentBoxFrameNumbers[player][layer][boxIndex];
+
+		bool sendInFull = isKeyFrame || sentFrameNumber == 0;
+		int changedPixels = 0;
+
+		if (!sendInFull) {
+			const unsigned char *current = boxData;
+			for (int line = 0; line < height; line++) {
+				const unsigned char *sent = sentBuffer->line[bpy + line] + bpx;
+				for (int x = 0; x < width; x++) {
+					if (current[x] != sent[x]) { changedPixels++; }
+				}
+				current += width;
+			}
+			if (changedPixels == 0) {
+				return -1;
+			}
+			// A delta only pays off when most of the box stayed the same, otherwise the XORed data compresses worse than the box itself
+			sendInFull = !allowDelta || changedPixels * 2 > width * height;
+		}
+
+		int referenceFrameNumber = sendInFull ? 0 : sentFrameNumber;
+		unsigned char *current = boxData;
+
+		for (int line = 0; line < height; line++) {
+			unsigned char *sent = sentBuffer->line[bpy + line] + bpx;
+			if (sendInFull) {
+				memcpy(sent, current, width);
+			} else {
+				for (int x = 0; x < width; x++) {
+					unsigned char pixel = current[x];
+					current[x] ^= sent[x];
+					sent[x] = pixel;
+				}
+			}
+			current += width;
+		}
+		sentFrameNumber = m_BoxFrameNumbers[player];
+
+		return referenceFrameNumber;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::EncodeFrameBoxRows(short player, FrameBoxEncoder &encoder, int firstRow, int lastRow, bool isKeyFrame) {
+		encoder.Packets.clear();
+		encoder.PacketSizes.clear();
+		encoder.PacketBoxes.clear();
+		encoder.FullBlocks = 0;
+		encoder.EmptyBlocks = 0;
+		encoder.UnchangedBlocks = 0;
+		encoder.DeltaBlocks = 0;
+		encoder.DataUncompressed = 0;
+
+		const StreamController &streamController = m_StreamControllers[player];
+		int boxWidth = streamController.BoxWidth;
+		int boxHeight = streamController.BoxHeight;
+
+		const BITMAP *backBuffer8 = m_BackBuffer8[player];
+		int bw = backBuffer8->w / boxWidth;
+
+		for (int by = firstRow; by < lastRow; by++) {
+			int step = 1;
+			int startLine = 0;
+
+			if (streamController.UseInterlacing) {
+				step = 2;
+				if (m_SendEven[player]) {
+					startLine = (by % 2 == 0) ? 1 : 0;
+				} else {
+					startLine = (by % 2 == 0) ? 0 : 1;
+				}
+			}
+
+			for (int bx = startLine; bx <= bw; bx += step) {
+				int bpx = bx * boxWidth;
+				int bpy = by * boxHeight;
+
+				if (bpx >= backBuffer8->w || bpy >= backBuffer8->h) {
+					break;
+				}
+
+				int maxWidth = boxWidth;
+				if (bpx + boxWidth >= backBuffer8->w) { maxWidth = backBuffer8->w - bpx; }
+
+				int maxHeight = boxHeight;
+				if (bpy + boxHeight >= backBuffer8->h) { maxHeight = backBuffer8->h - bpy; }
+
+				int size = maxWidth * maxHeight;
+				int boxIndex = by * (bw + 1) + bx;
+
+				for (int layer = m_ReplicateEntities ? 1 : 0; layer < 2; layer++) {
+					const BITMAP *backBuffer = (layer == 0) ? m_BackBuffer8[player] : m_BackBufferGUI8[player];
+					unsigned char *boxData = encoder.BoxBuffer.data();
+
+					// Copy block to box buffer and also check if block is empty
+					bool boxIsEmpty = true;
+					unsigned char *dest = boxData;
+					for (int line = 0; line < maxHeight; line++) {
+						const unsigned char *source = backBuffer->line[bpy + line] + bpx;
+						memcpy(dest, source, maxWidth);
+						if (boxIsEmpty) { boxIsEmpty = std::all_of(source, source + maxWidth, [](unsigned char pixel) { return pixel == 0; }); }
+						dest += maxWidth;
+					}
+
+					int referenceFrameNumber = 0;
+					if (m_UseDeltaCompression) {
+						referenceFrameNumber = PrepareFrameBoxDelta(player, layer, boxIndex, boxData, bpx, bpy, maxWidth, maxHeight, isKeyFrame, !boxIsEmpty);
+						if (referenceFrameNumber < 0) {
+							encoder.UnchangedBlocks++;
+							continue;
+						}
+						if (referenceFrameNumber > 0) { encoder.DeltaBlocks++; }
+					}
+
+					// Reserve room for the box in full, the packet is trimmed to the compressed size afterwards
+					size_t packetOffset = encoder.Packets.size();
+					encoder.Packets.resize(packetOffset + sizeof(MsgFrameBox) + (boxIsEmpty ? 0 : size));
+
+					MsgFrameBox *frameData = (MsgFrameBox *)(encoder.Packets.data() + packetOffset);
+					frameData->Id = ID_SRV_FRAME_BOX;
+					frameData->FrameNumber = m_FrameNumbers[player];
+					frameData->BoxFrameNumber = m_BoxFrameNumbers[player];
+					frameData->ReferenceFrameNumber = static_cast<unsigned short>(referenceFrameNumber);
+					frameData->Layer = layer;
+					frameData->BoxX = bpx;
+					frameData->BoxY = bpy;
+					frameData->BoxWidth = maxWidth;
+					frameData->BoxHeight = maxHeight;
+					frameData->UncompressedSize = size;
+					frameData->DataSize = size;
+
+					if (!boxIsEmpty) {
+						char *compressedData = (char *)(encoder.Packets.data() + packetOffset + sizeof(MsgFrameBox));
+						int result = 0;
+
+						if (m_UseHighCompression) {
+							result = LZ4_compress_HC_extStateHC(encoder.LZ4CompressionState, (char *)boxData, compressedData, size, size, streamController.HighCompressionLevel);
+						} else if (m_UseFastCompression) {
+							result = LZ4_compress_fast_extState(encoder.LZ4FastCompressionState, (char *)boxData, compressedData, size, size, streamController.FastAccelerationFactor);
+						}
+
+						// Compression failed or ineffective, send as is
+						if (result == 0 || result >= size) {
+							memcpy(compressedData, boxData, size);
+						} else {
+							frameData->DataSize = result;
+						}
+						encoder.FullBlocks++;
+					} else {
+						frameData->DataSize = 0;
+						encoder.EmptyBlocks++;
+					}
+
+					int payloadSize = frameData->DataSize + sizeof(MsgFrameBox);
+					encoder.Packets.resize(packetOffset + payloadSize);
+					encoder.PacketSizes.push_back(payloadSize);
+					encoder.PacketBoxes.emplace_back(static_cast<short>(layer), boxIndex);
+					encoder.DataUncompressed += size;
+				}
+			}
+		}
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1149,7 +1808,8 @@ namespace RTE {
 
 	int NetworkServer::SendFrame(short player) {
 		long long currentTicks = g_TimerMan.GetRealTickCount();
-		double fps = static_cast<double>(m_EncodingFps);
+		StreamController &streamController = m_StreamControllers[player];
+		double fps = static_cast<double>(streamController.EncodingFps);
 		double secsPerFrame = 1.0 / fps;
 		double secsSinceLastFrame = static_cast<double>(currentTicks - m_LastFrameSentTime[player]) / static_cast<double>(g_TimerMan.GetTicksPerSecond());
 		int microSeconds = 1000000;
@@ -1181,6 +1841,8 @@ namespace RTE {
 		m_SendBufferBytes[player] = (int)rns.bytesInSendBuffer[MEDIUM_PRIORITY] + (int)rns.bytesInSendBuffer[HIGH_PRIORITY];
 		m_SendBufferMessages[player] = (int)rns.messageInSendBuffer[MEDIUM_PRIORITY] + (int)rns.messageInSendBuffer[HIGH_PRIORITY];
 
+		if (m_UseAdaptiveBitrate) { UpdateStreamController(player, rns.isLimitedByCongestionControl || rns.messageInSendBuffer[MEDIUM_PRIORITY] > 1000); }
+
 		if (rns.isLimitedByCongestionControl) {
 			SetThreadExitReason(player, NetworkServer::SEND_BUFFER_IS_LIMITED_BY_CONGESTION);
 			m_FramesSkipped[player]++;
@@ -1219,6 +1881,8 @@ namespace RTE {
 		blit(frameManGUIBmp, m_BackBufferGUI8[player], 0, 0, 0, 0, frameManGUIBmp->w, frameManGUIBmp->h);
 
 		SendFrameSetupMsg(player);
+		if (m_SendInputOverlays) { SendInputOverlayMsg(player); }
+		if (m_ReplicateEntities) { SendEntityStates(player); }
 		SendPostEffectData(player);
 		SendSoundData(player);
 		SendMusicData(player);
@@ -1226,150 +1890,79 @@ namespace RTE {
 		m_FramesSent[player]++;
 
 		// Compression section
-		int compressionMethod = m_HighCompressionLevel;
-		int accelerationFactor = m_FastAccelerationFactor;
+		int compressionMethod = streamController.HighCompressionLevel;
+		int accelerationFactor = streamController.FastAccelerationFactor;
 
 		m_SendEven[player] = !m_SendEven[player];
 
 		if (m_TransmitAsBoxes) {
-			MsgFrameBox *frameData = (MsgFrameBox *)m_PixelLineBuffer[player];
-			frameData->FrameNumber = m_FrameNumbers[player];
-
-			// Save message ID
-			frameData->Id = ID_SRV_FRAME_BOX;
-			frameData->BoxWidth = m_BoxWidth;
-			frameData->BoxHeight = m_BoxHeight;
-
-			int bw = m_BackBuffer8[player]->w / m_BoxWidth;
-			int bh = m_BackBuffer8[player]->h / m_BoxHeight;
-
-			for (int by = 0; by <= bh; by++) {
-				int step = 1;
-				int startLine = 0;
-
-				if (m_UseInterlacing) {
-					step = 2;
-					if (m_SendEven[player]) {
-						startLine = (by % 2 == 0) ? 1 : 0;
-					} else {
-						startLine = (by % 2 == 0) ? 0 : 1;
-					}
+			m_BoxFrameNumbers[player]++;
+			if (m_BoxFrameNumbers[player] == 0) { m_BoxFrameNumbers[player] = 1; }
+
+			if (m_UseDeltaCompression) { HandleLostFrameBoxes(player); }
+
+			// With interlacing every box is only visited every other frame, so a key frame has to span two frames to refresh all of them
+			bool isKeyFrame = m_FramesSinceKeyFrame[player] < (streamController.UseInterlacing ? 2 : 1);
+			m_FramesSinceKeyFrame[player]++;
+			if (m_FramesSinceKeyFrame[player] >= std::max(m_KeyFrameInterval, 2)) { m_FramesSinceKeyFrame[player] = 0; }
+
+			std::vector<FrameBoxEncoder> &encoders = m_FrameBoxEncoders[player];
+			if (encoders.empty()) {
+				encoders.resize(std::min(static_cast<int>(m_ThreadPool.GetThreadCount()) + 1, c_MaxFrameBoxEncoders));
+				for (FrameBoxEncoder &encoder : encoders) {
+					encoder.LZ4CompressionState = malloc(LZ4_sizeofStateHC());
+					encoder.LZ4FastCompressionState = malloc(LZ4_sizeofState());
 				}
+			}
+			for (FrameBoxEncoder &encoder : encoders) {
+				if (encoder.BoxBuffer.size() < static_cast<size_t>(streamController.BoxWidth * streamController.BoxHeight)) { encoder.BoxBuffer.resize(streamController.BoxWidth * streamController.BoxHeight); }
+			}
 
-				for (int bx = startLine; bx <= bw; bx += step) {
-					int bpx = bx * m_BoxWidth;
-					int bpy = by * m_BoxHeight;
-
-					if (bpx >= m_BackBuffer8[player]->w || bpy >= m_BackBuffer8[player]->h) {
-						break;
-					}
-
-					frameData->BoxX = bpx;
-					frameData->BoxY = bpy;
+			// Split the box rows between the encoders, each compressing its rows into its own buffers so they can run in parallel
+			int rowCount = m_BackBuffer8[player]->h / streamController.BoxHeight + 1;
+			int encoderCount = std::min(static_cast<int>(encoders.size()), rowCount);
+			int rowsPerEncoder = (rowCount + encoderCount - 1) / encoderCount;
 
-					int maxWidth = m_BoxWidth;
-					if (bpx + m_BoxWidth >= m_BackBuffer8[player]->w) {
-						maxWidth = m_BackBuffer8[player]->w - bpx;
-						frameData->BoxWidth = maxWidth;
-					}
+			std::vector<std::future<void>> encodeJobs;
+			for (int i = 1; i < encoderCount; i++) {
+				int firstRow = i * rowsPerEncoder;
+				int lastRow = std::min(firstRow + rowsPerEncoder, rowCount);
+				encodeJobs.push_back(m_ThreadPool.AddJob([this, player, &encoders, i, firstRow, lastRow, isKeyFrame]() { EncodeFrameBoxRows(player, encoders[i], firstRow, lastRow, isKeyFrame); }));
+			}
+			EncodeFrameBoxRows(player, encoders[0], 0, std::min(rowsPerEncoder, rowCount), isKeyFrame);
+			for (std::future<void> &encodeJob : encodeJobs) {
+				m_ThreadPool.WaitForJob(encodeJob);
+			}
 
-					int maxHeight = m_BoxHeight;
-					if (bpy + m_BoxHeight >= m_BackBuffer8[player]->h) {
-						maxHeight = m_BackBuffer8[player]->h - bpy;
-						frameData->BoxHeight = maxHeight;
+			// Send the boxes in the order they were laid out in, same as if they were encoded one by one
+			for (int i = 0; i < encoderCount; i++) {
+				const FrameBoxEncoder &encoder = encoders[i];
+				const unsigned char *packet = encoder.Packets.data();
+
+				for (size_t packetIndex = 0; packetIndex < encoder.PacketSizes.size(); packetIndex++) {
+					int payloadSize = encoder.PacketSizes[packetIndex];
+					if (m_UseDeltaCompression) {
+						// Not sequenced, since a box dropped for arriving out of order wouldn't be reported lost. The client drops boxes older than the ones it holds itself
+						uint32_t receipt = m_Server->Send((const char *)packet, payloadSize, MEDIUM_PRIORITY, UNRELIABLE_WITH_ACK_RECEIPT, 0, m_ClientConnections[player].ClientId, false);
+						if (receipt != 0) { m_SentFrameBoxes[player].push_back({ receipt, m_BoxFrameNumbers[player], encoder.PacketBoxes[packetIndex].first, encoder.PacketBoxes[packetIndex].second }); }
+					} else {
+						m_Server->Send((const char *)packet, payloadSize, MEDIUM_PRIORITY, UNRELIABLE_SEQUENCED, 0, m_ClientConnections[player].ClientId, false);
 					}
+					packet += payloadSize;
 
-					int size = maxWidth * maxHeight;
-					frameData->UncompressedSize = size;
-					frameData->DataSize = size;
-
-					for (int layer = 0; layer < 2; layer++) {
-						bool boxIsEmpty = true;
-						int line = 0;
-
-						const BITMAP *backBuffer = 0;
-						if (layer == 0) {
-							backBuffer = m_BackBuffer8[player];
-						} else if (layer == 1) {
-							backBuffer = m_BackBufferGUI8[player];
-						}
-
-						frameData->Layer = layer;
-
-						unsigned char *dest = (unsigned char *)(m_TerrainChangeBuffer[player]);
-
-						// Copy block to line buffer and also check if block is empty
-						for (line = 0; line < maxHeight; line++) {
-							// Copy bitmap data
-							memcpy(dest, backBuffer->line[bpy + line] + bpx, maxWidth);
-							dest += maxWidth;
-						}
-
-						// Check if block is empty
-						unsigned long *pixelInt = (unsigned long *)m_TerrainChangeBuffer[player];
-						int counter = 0;
-
-						for (counter = 0; counter < size; counter += sizeof(unsigned long)) {
-							if (*pixelInt > 0) {
-								boxIsEmpty = false;
-								break;
-							}
-							pixelInt++;
-						}
-						if (boxIsEmpty && counter > size) {
-							pixelInt--;
-							counter -= sizeof(unsigned long);
-
-							const unsigned char *pixelChr = (unsigned char *)pixelInt;
-							for (; counter < size; counter++) {
-								if (*pixelChr > 0) {
-									boxIsEmpty = false;
-									break;
-								}
-								pixelChr++;
-							}
-						}
-
-						if (!boxIsEmpty) {
-							int result = 0;
-
-							if (m_UseHighCompression) {
-								result = LZ4_compress_HC_extStateHC(m_LZ4CompressionState[player], (char *)m_TerrainChangeBuffer[player], (char *)(m_PixelLineBuffer[player] + sizeof(MsgFrameBox)), size, size, compressionMethod);
-							} else if (m_UseFastCompression) {
-								result = LZ4_compress_fast_extState(m_LZ4FastCompressionState[player], (char *)m_TerrainChangeBuffer[player], (char *)(m_PixelLineBuffer[player] + sizeof(MsgFrameBox)), size, size, accelerationFactor);
-							}
-
-							// Compression failed or ineffective, send as is
-							if (result == 0 || result == backBuffer->w) {
-#ifdef _WIN32
-								memcpy_s(m_PixelLineBuffer[player] + sizeof(MsgFrameBox), c_MaxPixelLineBufferSize, m_TerrainChangeBuffer[player], size);
-#else
-								memcpy(m_PixelLineBuffer[player] + sizeof(MsgFrameBox), m_TerrainChangeBuffer[player], size);
-#endif
-							} else {
-								frameData->DataSize = result;
-							}
-
-							m_FullBlocks[player]++;
-						} else {
-							frameData->DataSize = 0;
-							m_EmptyBlocks[player]++;
-						}
-
-						int payloadSize = frameData->DataSize + sizeof(MsgFrameBox);
-
-						m_Server->Send((const char *)frameData, payloadSize, MEDIUM_PRIORITY, UNRELIABLE_SEQUENCED, 0, m_ClientConnections[player].ClientId, false);
-
-						m_DataSentCurrent[player][STAT_CURRENT] += payloadSize;
-						m_DataSentTotal[player] += payloadSize;
-
-						m_FrameDataSentCurrent[player][STAT_CURRENT] += payloadSize;
-						m_FrameDataSentTotal[player] += payloadSize;
+					m_DataSentCurrent[player][STAT_CURRENT] += payloadSize;
+					m_DataSentTotal[player] += payloadSize;
 
-						m_DataUncompressedCurrent[player][STAT_CURRENT] += frameData->UncompressedSize;
-						m_DataUncompressedTotal[player] += frameData->UncompressedSize;
-					}
+					m_FrameDataSentCurrent[player][STAT_CURRENT] += payloadSize;
+					m_FrameDataSentTotal[player] += payloadSize;
 				}
+				m_DataUncompressedCurrent[player][STAT_CURRENT] += encoder.DataUncompressed;
+				m_DataUncompressedTotal[player] += encoder.DataUncompressed;
+
+				m_FullBlocks[player] += encoder.FullBlocks;
+				m_EmptyBlocks[player] += encoder.EmptyBlocks;
+				m_UnchangedBlocks[player] += encoder.UnchangedBlocks;
+				m_DeltaBlocks[player] += encoder.DeltaBlocks;
 			}
 		} else {
 			MsgFrameLine *frameData = (MsgFrameLine *)m_PixelLineBuffer[player];
@@ -1381,14 +1974,14 @@ namespace RTE {
 			int startLine = 0;
 			int step = 1;
 
-			if (m_UseInterlacing) {
+			if (streamController.UseInterlacing) {
 				step = 2;
 				m_SendEven[player] = !m_SendEven[player];
 				startLine = m_SendEven[player] ? 0 : 1;
 			}
 
 			for (int m_CurrentFrameLine = startLine; m_CurrentFrameLine < m_BackBuffer8[player]->h; m_CurrentFrameLine += step) {
-				for (int layer = 0; layer < 2; layer++) {
+				for (int layer = m_ReplicateEntities ? 1 : 0; layer < 2; layer++) {
 					const BITMAP *backBuffer = 0;
 
 					if (layer == 0) {
@@ -1478,11 +2071,294 @@ namespace RTE {
 
 		double secsSinceSendStart = static_cast<double>(g_TimerMan.GetRealTickCount() - currentTicks) / static_cast<double>(g_TimerMan.GetTicksPerSecond());
 		m_MsecPerSendCall[player] = static_cast<int>(secsSinceSendStart * 1000.0);
+		streamController.WindowEncodeMsec += m_MsecPerSendCall[player];
 
 		SetThreadExitReason(player, NetworkServer::NORMAL);
 		return 0;
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::GatherEntityStates() {
+		std::vector<const MovableObject *> rootObjects;
+		g_MovableMan.GetObjectsInDrawOrder(rootObjects);
+
+		m_EntityStateMutex.lock();
+		m_EntityStates.clear();
+		for (const MovableObject *movableObject : rootObjects) {
+			GatherEntityState(movableObject);
+		}
+		m_EntityStateMutex.unlock();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::GatherEntityState(const MovableObject *movableObject) {
+		if (!movableObject || movableObject->ToDelete()) {
+			return;
+		}
+		const MOSRotating *moSRotating = dynamic_cast<const MOSRotating *>(movableObject);
+
+		if (moSRotating) {
+			for (const Attachable *attachable : moSRotating->GetAllAttachables()) {
+				if (!attachable->IsDrawnAfterParent()) { GatherEntityState(attachable); }
+			}
+		}
+
+		ReplicatedEntity entity;
+		EntityStateNetworkData &state = entity.State;
+		state.UniqueID = static_cast<unsigned int>(movableObject->GetUniqueID());
+		state.PosX = static_cast<short>(movableObject->GetPos().GetFloorIntX());
+		state.PosY = static_cast<short>(movableObject->GetPos().GetFloorIntY());
+		state.RotAngle = 0;
+		state.Scale = static_cast<unsigned char>(std::clamp(movableObject->GetScale() * 64.0F, 0.0F, 255.0F));
+		state.HFlipped = movableObject->IsHFlipped();
+		entity.Radius = movableObject->GetRadius();
+
+		if (const MOSprite *moSprite = dynamic_cast<const MOSprite *>(movableObject)) {
+			state.PresetID = GetEntityPresetID(movableObject);
+			// Clients can't draw sprites that have no preset for them to look up
+			if (state.PresetID != c_PixelEntityPresetID) {
+				state.Frame = static_cast<unsigned short>(moSprite->GetFrame());
+				// Plain MOSprites are always drawn upright, only MOSRotatings use their rotation when drawing
+				if (moSRotating) { state.RotAngle = static_cast<unsigned char>(static_cast<int>(std::round(movableObject->GetRotAngle() / c_PI * -128.0F)) & 0xFF); }
+				m_EntityStates.push_back(entity);
+			}
+		} else if (const MOPixel *moPixel = dynamic_cast<const MOPixel *>(movableObject)) {
+			state.PresetID = c_PixelEntityPresetID;
+			state.Frame = moPixel->GetColor().GetIndex();
+			m_EntityStates.push_back(entity);
+		}
+
+		if (moSRotating) {
+			for (const Attachable *attachable : moSRotating->GetAllAttachables()) {
+				if (attachable->IsDrawnAfterParent()) { GatherEntityState(attachable); }
+			}
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	unsigned short NetworkServer::GetEntityPresetID(const MovableObject *movableObject) {
+		const Entity *presetKey = movableObject->GetOriginalPreset();
+		if (!presetKey) {
+			return c_PixelEntityPresetID;
+		}
+
+		std::unordered_map<const Entity *, unsigned short>::const_iterator presetItr = m_EntityPresetIDs.find(presetKey);
+		if (presetItr != m_EntityPresetIDs.end()) {
+			return presetItr->second;
+		}
+		unsigned short presetID = static_cast<unsigned short>(m_EntityPresets.size());
+		if (presetID == c_PixelEntityPresetID) {
+			return c_PixelEntityPresetID;
+		}
+
+		MsgEntityPreset msg;
+		msg.Id = ID_SRV_ENTITY_PRESET;
+		msg.PresetID = presetID;
+		msg.ModuleID = presetKey->GetModuleID();
+		std::snprintf(msg.ClassName, sizeof(msg.ClassName), "%s", presetKey->GetClassName().c_str());
+		std::snprintf(msg.PresetName, sizeof(msg.PresetName), "%s", presetKey->GetPresetName().c_str());
+
+		m_EntityPresets.push_back(msg);
+		m_EntityPresetIDs.insert({ presetKey, presetID });
+		return presetID;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::SendEntityStates(short player) {
+		// Keep each message within a typical MTU so a single lost fragment doesn't take a whole frame's worth of states with it
+		const int maxStatesPerMessage = (1200 - static_cast<int>(sizeof(MsgEntityStates))) / static_cast<int>(sizeof(EntityStateNetworkData));
+
+		Vector targetPos = g_FrameMan.GetTargetPos(player);
+		float viewWidth = static_cast<float>(m_BackBuffer8[player]->w);
+		float viewHeight = static_cast<float>(m_BackBuffer8[player]->h);
+		bool sceneWrapsX = g_SceneMan.SceneWrapsX();
+		float sceneWidth = static_cast<float>(g_SceneMan.GetSceneWidth());
+
+		std::vector<const EntityStateNetworkData *> visibleStates;
+
+		m_EntityStateMutex.lock();
+
+		// Presets have to be known before the states referencing them can be drawn, so they're sent reliably and only once
+		for (; m_EntityPresetsSent[player] < m_EntityPresets.size(); m_EntityPresetsSent[player]++) {
+			const MsgEntityPreset &presetMsg = m_EntityPresets[m_EntityPresetsSent[player]];
+			m_Server->Send((const char *)&presetMsg, sizeof(MsgEntityPreset), HIGH_PRIORITY, RELIABLE_ORDERED, 0, m_ClientConnections[player].ClientId, false);
+
+			m_DataSentCurrent[player][STAT_CURRENT] += sizeof(MsgEntityPreset);
+			m_DataSentTotal[player] += sizeof(MsgEntityPreset);
+
+			m_OtherDataSentCurrent[player][STAT_CURRENT] += sizeof(MsgEntityPreset);
+			m_OtherDataSentTotal[player] += sizeof(MsgEntityPreset);
+
+			m_DataUncompressedCurrent[player][STAT_CURRENT] += sizeof(MsgEntityPreset);
+			m_DataUncompressedTotal[player] += sizeof(MsgEntityPreset);
+		}
+
+		// Only send the entities that are in or near this player's view
+		for (const ReplicatedEntity &entity : m_EntityStates) {
+			float relativeX = static_cast<float>(entity.State.PosX) - targetPos.m_X;
+			float relativeY = static_cast<float>(entity.State.PosY) - targetPos.m_Y;
+
+			if (sceneWrapsX) {
+				if (relativeX < -entity.Radius) {
+					relativeX += sceneWidth;
+				} else if (relativeX > viewWidth + entity.Radius) {
+					relativeX -= sceneWidth;
+				}
+			}
+			if (relativeX >= -entity.Radius && relativeX <= viewWidth + entity.Radius && relativeY >= -entity.Radius && relativeY <= viewHeight + entity.Radius) { visibleStates.push_back(&entity.State); }
+		}
+
+		m_EntityStateFrameNumbers[player]++;
+
+		MsgEntityStates *msg = (MsgEntityStates *)m_PixelLineBuffer[player];
+		msg->Id = ID_SRV_ENTITY_STATES;
+		msg->FrameNumber = m_FrameNumbers[player];
+		msg->StateFrameNumber = m_EntityStateFrameNumbers[player];
+		msg->TotalEntityCount = static_cast<unsigned short>(std::min(visibleStates.size(), static_cast<size_t>(std::numeric_limits<unsigned short>::max())));
+
+		// Send at least one message even if nothing is visible, so the client knows to stop drawing the entities of the previous frame
+		int firstState = 0;
+		do {
+			msg->EntityCount = static_cast<unsigned short>(std::min(maxStatesPerMessage, msg->TotalEntityCount - firstState));
+
+			EntityStateNetworkData *stateData = (EntityStateNetworkData *)(m_PixelLineBuffer[player] + sizeof(MsgEntityStates));
+			for (int i = 0; i < msg->EntityCount; i++) {
+				stateData[i] = *visibleStates[firstState + i];
+			}
+
+			int payloadSize = sizeof(MsgEntityStates) + msg->EntityCount * sizeof(EntityStateNetworkData);
+			m_Server->Send((const char *)msg, payloadSize, MEDIUM_PRIORITY, UNRELIABLE_SEQUENCED, 0, m_ClientConnections[player].ClientId, false);
+
+			m_DataSentCurrent[player][STAT_CURRENT] += payloadSize;
+			m_DataSentTotal[player] += payloadSize;
+
+			m_FrameDataSentCurrent[player][STAT_CURRENT] += payloadSize;
+			m_FrameDataSentTotal[player] += payloadSize;
+
+			m_DataUncompressedCurrent[player][STAT_CURRENT] += payloadSize;
+			m_DataUncompressedTotal[player] += payloadSize;
+
+			firstState += maxStatesPerMessage;
+		} while (firstState < msg->TotalEntityCount);
+
+		m_EntityStateMutex.unlock();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool NetworkServer::IsInputOverlayDrawnByClient(short player) const {
+		return m_SendInputOverlays && player >= 0 && player < c_MaxClients && IsPlayerConnected(player) && g_UInputMan.GetControlScheme(player)->GetDevice() == InputDevice::DEVICE_MOUSE_KEYB;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::GatherInputOverlays() {
+		GameActivity *gameActivity = dynamic_cast<GameActivity *>(g_ActivityMan.GetActivity());
+		float trapRadius = g_UInputMan.GetMouseTrapRadius();
+
+		m_InputOverlayMutex.lock();
+		for (short player = 0; player < c_MaxClients; player++) {
+			MsgInputOverlay &overlay = m_InputOverlays[player];
+			overlay = MsgInputOverlay();
+			overlay.Id = ID_SRV_INPUT_OVERLAY;
+			overlay.InputSequence = m_LastInputSequence[player];
+			overlay.MouseTrapRadius = trapRadius;
+
+			// The mouse movement of the last processed input message is only applied on the next input update, so apply it here already to match the sequence number
+			Vector analogAim = g_UInputMan.GetNetworkAnalogMoveData(player);
+			const Vector &pendingMovement = g_UInputMan.PeekNetworkAccumulatedRawMouseMovement(player);
+			if (!pendingMovement.IsZero()) {
+				analogAim += pendingMovement * 3;
+				analogAim.CapMagnitude(trapRadius);
+			}
+			overlay.AnalogAimX = analogAim.m_X;
+			overlay.AnalogAimY = analogAim.m_Y;
+
+			if (!gameActivity || !IsInputOverlayDrawnByClient(player)) {
+				continue;
+			}
+			const AHuman *human = dynamic_cast<const AHuman *>(gameActivity->GetControlledActor(player));
+
+			if (human && g_MovableMan.IsActor(human)) {
+				overlay.AimFlipped = human->IsHFlipped();
+				overlay.AimAngle = human->GetAimAngle(false);
+				overlay.AimRange = human->GetAimRange();
+
+				// Same as the condition HDFirearm::DrawHUD draws the reticle under
+				const HDFirearm *firearm = dynamic_cast<const HDFirearm *>(human->GetEquippedItem());
+				if (firearm && firearm->GetSharpAim() >= 0.15F) {
+					overlay.AimReticleVisible = true;
+					overlay.AimDevicePosX = static_cast<short>(firearm->GetPos().GetFloorIntX());
+					overlay.AimDevicePosY = static_cast<short>(firearm->GetPos().GetFloorIntY());
+					overlay.AimDeviceRotation = firearm->GetRotAngle();
+					overlay.MuzzleOffsetX = firearm->GetMuzzleOffset().m_X;
+					overlay.MuzzleOffsetY = firearm->GetMuzzleOffset().m_Y;
+					overlay.SharpLength = firearm->GetSharpLength() * firearm->GetSharpAim();
+				}
+
+				// The view leads ahead of the actor in the aim direction, which the client can only predict while the view is actually following that lead
+				short screen = gameActivity->ScreenOfPlayer(player);
+				if (screen >= 0 && g_SceneMan.ShortestDistance(g_SceneMan.GetScrollTarget(screen), human->GetViewPoint()).GetLargest() < 1.0F) {
+					Vector viewLead = human->GetViewPoint() - human->GetPos().GetFloored();
+					if (human->GetVel().GetMagnitude() > 10.0F) { viewLead -= human->GetVel() * 6; }
+					overlay.ScrollLeadVisible = true;
+					overlay.ScrollLeadLength = viewLead.GetMagnitude();
+					overlay.ScrollSpeed = g_SceneMan.GetScrollSpeed(screen);
+				}
+			}
+
+			const PieMenuGUI *pieMenu = gameActivity->GetPieMenu(player);
+			if (pieMenu && pieMenu->IsFullyEnabled()) {
+				overlay.PieMenuVisible = true;
+				overlay.PieCursorPointing = pieMenu->IsCursorPointing();
+				overlay.PieCenterX = static_cast<short>(pieMenu->GetPos().GetFloorIntX());
+				overlay.PieCenterY = static_cast<short>(pieMenu->GetPos().GetFloorIntY());
+				overlay.PieInnerRadius = static_cast<unsigned char>(std::clamp(pieMenu->GetInnerRadius(), 0, 255));
+				overlay.PieThickness = static_cast<unsigned char>(std::clamp(pieMenu->GetThickness(), 0, 255));
+				overlay.PieCursorAngle = pieMenu->GetCursorAngle();
+
+				for (const PieMenuGUI::Slice *slice : pieMenu->GetCurrentSlices()) {
+					if (overlay.PieSliceCount >= c_MaxPieSlicesForNetwork) {
+						break;
+					}
+					PieSliceNetworkData &sliceData = overlay.PieSlices[overlay.PieSliceCount++];
+					sliceData.AreaStart = slice->m_AreaStart;
+					sliceData.AreaArc = slice->m_AreaArc;
+					sliceData.Enabled = slice->m_Enabled;
+				}
+			}
+		}
+		m_InputOverlayMutex.unlock();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void NetworkServer::SendInputOverlayMsg(short player) {
+		m_InputOverlayMutex.lock();
+		MsgInputOverlay msg = m_InputOverlays[player];
+		m_InputOverlayMutex.unlock();
+
+		msg.FrameNumber = m_FrameNumbers[player];
+
+		int payloadSize = sizeof(MsgInputOverlay);
+
+		// Only the latest state matters, so a lost one is not worth resending
+		m_Server->Send((const char *)&msg, payloadSize, MEDIUM_PRIORITY, UNRELIABLE_SEQUENCED, 0, m_ClientConnections[player].ClientId, false);
+
+		m_DataSentCurrent[player][STAT_CURRENT] += payloadSize;
+		m_DataSentTotal[player] += payloadSize;
+
+		m_OtherDataSentCurrent[player][STAT_CURRENT] += payloadSize;
+		m_OtherDataSentTotal[player] += payloadSize;
+
+		m_DataUncompressedCurrent[player][STAT_CURRENT] += payloadSize;
+		m_DataUncompressedTotal[player] += payloadSize;
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void NetworkServer::UpdateStats(short player) {
@@ -1528,7 +2404,7 @@ namespace RTE {
 		guid += GetServerGUID().ToString();
 		g_FrameMan.GetLargeFont()->DrawAligned(&guiBMP, midX, 5, guid, GUIFont::Centre);
 
-		char buf[256];
+		char buf[512];
 
 		if (m_NatServerConnected) {
 			std::snprintf(buf, sizeof(buf), "NAT SERVICE CONNECTED\nName: %s  Pass: %s", g_SettingsMan.GetNATServerName().c_str(), g_SettingsMan.GetNATServerPassword().c_str());
@@ -1568,6 +2444,8 @@ namespace RTE {
 
 		m_FullBlocks[c_MaxClients] = 0;
 		m_EmptyBlocks[c_MaxClients] = 0;
+		m_UnchangedBlocks[c_MaxClients] = 0;
+		m_DeltaBlocks[c_MaxClients] = 0;
 
 
 		for (short i = 0; i < MAX_STAT_RECORDS; i++) {
@@ -1594,6 +2472,8 @@ namespace RTE {
 
 				m_FullBlocks[c_MaxClients] += m_FullBlocks[i];
 				m_EmptyBlocks[c_MaxClients] += m_EmptyBlocks[i];
+				m_UnchangedBlocks[c_MaxClients] += m_UnchangedBlocks[i];
+				m_DeltaBlocks[c_MaxClients] += m_DeltaBlocks[i];
 			}
 
 			// Update compression ratio
@@ -1606,7 +2486,7 @@ namespace RTE {
 
 			// Jesus christ
 			std::snprintf(buf, sizeof(buf),
-					  "%s\nPing %u\nCmp Mbit: %.1f\nUnc Mbit: %.1f\nR: %.2f\nFrame Kbit: %lu\nGlow Kbit: %lu\nSound Kbit: %lu\nScene Kbit: %lu\nFrames sent: %uK\nFrame skipped: %uK\nBlocks full: %uK\nBlocks empty: %uK\nBlk Ratio: %.2f\nFPS: %d\nSend Ms %d\nTotal Data %lu MB",
+					  "%s\nPing %u\nCmp Mbit: %.1f\nUnc Mbit: %.1f\nR: %.2f\nFrame Kbit: %lu\nGlow Kbit: %lu\nSound Kbit: %lu\nScene Kbit: %lu\nFrames sent: %uK\nFrame skipped: %uK\nBlocks full: %uK\nBlocks empty: %uK\nBlocks unchanged: %uK\nBlocks delta: %uK\nBlk Ratio: %.2f\nFPS: %d\nSend Ms %d\nTotal Data %lu MB",
 					  (i == c_MaxClients) ? "- TOTALS - " : playerName.c_str(),
 					  (i < c_MaxClients) ? m_Ping[i] : 0,
 					  static_cast<double>(m_DataSentCurrent[i][STAT_SHOWN]) / 125000,
@@ -1620,6 +2500,8 @@ namespace RTE {
 					  m_FramesSkipped[i] / 1000,
 					  m_FullBlocks[i] / 1000,
 					  m_EmptyBlocks[i] / 1000,
+					  m_UnchangedBlocks[i] / 1000,
+					  m_DeltaBlocks[i] / 1000,
 					  emptyRatio,
 					  (i < c_MaxClients) ? fps : 0,
 					  (i < c_MaxClients) ? m_MsecPerSendCall[i] : 0,
@@ -1629,8 +2511,27 @@ namespace RTE {
 			g_FrameMan.GetLargeFont()->DrawAligned(&guiBMP, 10 + i * g_FrameMan.GetResX() / 5, 75, buf, GUIFont::Left);
 
 			if (i < c_MaxClients) {
-				int lines = 2;
-				std::snprintf(buf, sizeof(buf), "Thread: %d\nBuffer: %d / %d", m_ThreadExitReason[i], m_SendBufferMessages[i], m_SendBufferBytes[i] / 1024);
+				const StreamController &streamController = m_StreamControllers[i];
+				int lines = 9;
+				std::snprintf(buf, sizeof(buf), "Quality: %d%s\nStream FPS: %d%s\nBox: %dx%d\n%s %d\nKbit: %d / %d\nLatency: %d / %d\nEnc Ms: %d  R: %.2f\nThread: %d\nBuffer: %d / %d",
+						  streamController.QualityLevel,
+						  m_UseAdaptiveBitrate ? "" : " (Fixed)",
+						  streamController.EncodingFps,
+						  streamController.UseInterlacing ? " Interlaced" : "",
+						  streamController.BoxWidth,
+						  streamController.BoxHeight,
+						  m_UseHighCompression ? "LZ4 HC Level:" : "LZ4 Acceleration:",
+						  m_UseHighCompression ? streamController.HighCompressionLevel : streamController.FastAccelerationFactor,
+						  streamController.Bandwidth,
+						  m_TargetBandwidth,
+						  streamController.Latency,
+						  m_TargetLatency,
+						  streamController.EncodeMsec,
+						  streamController.CompressionRatio,
+						  m_ThreadExitReason[i],
+						  m_SendBufferMessages[i],
+						  m_SendBufferBytes[i] / 1024
+				);
 				g_FrameMan.GetLargeFont()->DrawAligned(&guiBMP, 10 + i * g_FrameMan.GetResX() / 5, g_FrameMan.GetResY() - lines * 15, buf, GUIFont::Left);
 			}
 		}
@@ -1703,7 +2604,11 @@ namespace RTE {
 			}
 		}
 
-		DrawStatisticsData();
+		if (m_ReplicateEntities) { GatherEntityStates(); }
+		if (m_SendInputOverlays) { GatherInputOverlays(); }
+
+		// The statistics overlay is only ever seen in a local window
+		if (!g_FrameMan.IsHeadless()) { DrawStatisticsData(); }
 
 		// Clear sound events for unconnected players because AudioMan does not know about their state and stores broadcast sounds to their event lists
 		std::list<AudioMan::NetworkSoundData> soundList;
@@ -1775,6 +2680,12 @@ namespace RTE {
 				case ID_CLT_INPUT:
 					ReceiveInputMsg(packet);
 					break;
+				// Frame boxes are sent with ack receipts when delta compressing, so the lost ones can be sent again in full
+				case ID_SND_RECEIPT_LOSS:
+					ReceiveFrameBoxLoss(packet);
+					break;
+				case ID_SND_RECEIPT_ACKED:
+					break;
 				case ID_CLT_SCENE_ACCEPTED:
 					ReceiveSceneAcceptedMsg(packet);
 					break;
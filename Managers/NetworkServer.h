@@ -5,6 +5,7 @@
 #include "SceneMan.h"
 
 #include "NetworkClient.h"
+#include "ThreadPool.h"
 
 #define g_NetworkServer NetworkServer::Instance()
 
@@ -109,7 +110,7 @@ namespace RTE {
 		/// Sets whether interlacing is used to reduce bandwidth usage or not.
 		/// </summary>
 		/// <param name="newMode">Whether to use interlacing or not.</param>
-		void SetInterlacingMode(bool newMode) { m_UseInterlacing = newMode; }
+		void SetInterlacingMode(bool newMode);
 
 		/// <summary>
 		/// Sets the duration this thread should be put to sleep for in milliseconds.
@@ -124,6 +125,19 @@ namespace RTE {
 		/// <param name="player">The player to get for.</param>
 		/// <returns>The ping time of the player.</returns>
 		unsigned short GetPing(short player) const { return m_Ping[player]; }
+
+		/// <summary>
+		/// Gets whether the server replicates entity states for clients to draw locally instead of streaming the rendered scene layer.
+		/// </summary>
+		/// <returns>Whether entity states are replicated or not.</returns>
+		bool IsReplicatingEntities() const { return m_ReplicateEntities; }
+
+		/// <summary>
+		/// Gets whether the specified player's client draws its aim reticle and pie menu cursor itself from its own input, in which case they're left out of the GUI layer streamed to it.
+		/// </summary>
+		/// <param name="player">The player to check for.</param>
+		/// <returns>Whether the player's client draws its input overlays itself.</returns>
+		bool IsInputOverlayDrawnByClient(short player) const;
 #pragma endregion
 
 #pragma region Concrete Methods
@@ -168,6 +182,94 @@ namespace RTE {
 
 	protected:
 
+		/// <summary>
+		/// A player's send job waiting in the timer wheel.
+		/// </summary>
+		struct TimerWheelEntry {
+			short Player; //!< The player whose send job is waiting.
+			int Rotations; //!< How many more full turns of the wheel to wait before the job is due.
+		};
+
+		/// <summary>
+		/// The state of one of the jobs a frame's boxes are encoded by in parallel. Each job encodes a contiguous range of box rows into its own buffers.
+		/// </summary>
+		struct FrameBoxEncoder {
+			void *LZ4CompressionState = nullptr; //!< This job's LZ4 high compression state.
+			void *LZ4FastCompressionState = nullptr; //!< This job's LZ4 fast compression state.
+			std::vector<unsigned char> BoxBuffer; //!< Scratch buffer the box being encoded is copied to.
+			std::vector<unsigned char> Packets; //!< The encoded box messages back to back, in the order they have to be sent in.
+			std::vector<int> PacketSizes; //!< The size of each encoded box message.
+			std::vector<std::pair<short, int>> PacketBoxes; //!< The layer and index of the box each encoded box message carries.
+			int FullBlocks = 0; //!< Number of non-empty boxes encoded this frame.
+			int EmptyBlocks = 0; //!< Number of empty boxes encoded this frame.
+			int UnchangedBlocks = 0; //!< Number of boxes skipped this frame because they didn't change.
+			int DeltaBlocks = 0; //!< Number of boxes encoded as deltas this frame.
+			int DataUncompressed = 0; //!< Uncompressed size of all boxes encoded this frame.
+		};
+
+		/// <summary>
+		/// A box sent to a client with an ack receipt, so it can be sent again in full if RakNet reports it lost.
+		/// </summary>
+		struct SentFrameBox {
+			uint32_t Receipt; //!< The receipt number RakNet returned when the box was sent.
+			unsigned short BoxFrameNumber; //!< The frame number the box was sent with.
+			short Layer; //!< The layer of the box.
+			int BoxIndex; //!< The index of the box in its layer.
+		};
+
+		/// <summary>
+		/// One step of the quality ladder the adaptive bitrate controller moves clients along. Each step needs less bandwidth than the one before it, at the cost of picture quality.
+		/// </summary>
+		struct StreamQualityLevel {
+			int FpsPercent; //!< The share of the configured encoding fps sent at this level, in percent.
+			bool UseInterlacing; //!< Whether interlacing is forced on at this level.
+			int BoxScale; //!< What the configured box width and height are multiplied by at this level. Bigger boxes carry less header overhead and compress better, but are resent in full more often.
+		};
+
+		/// <summary>
+		/// A client's adaptive bitrate controller. Holds the stream settings currently used for the client and the measurements they're picked from.
+		/// </summary>
+		struct StreamController {
+			int QualityLevel = 0; //!< The step of the quality ladder the client is on.
+			int EncodingFps = 30; //!< Frames per second sent to the client.
+			bool UseInterlacing = false; //!< Whether frames are sent to the client interlaced.
+			int HighCompressionLevel = 0; //!< LZ4 high compression level used for the client's frames.
+			int FastAccelerationFactor = 1; //!< LZ4 fast compression acceleration factor used for the client's frames.
+			int BoxWidth = 32; //!< Width of the boxes the client's frames are split into.
+			int BoxHeight = 44; //!< Height of the boxes the client's frames are split into.
+
+			int Bandwidth = 0; //!< Kbit per second sent to the client over the last measurement window.
+			int Latency = 0; //!< Estimated latency in ms over the last measurement window. Ping plus the time it takes to drain the send buffer.
+			double CompressionRatio = 0; //!< Ratio of sent to uncompressed data over the last measurement window.
+			int EncodeMsec = 0; //!< Average ms it took to encode and send a frame over the last measurement window.
+			int CongestedFrames = 0; //!< Number of frames skipped because of congestion over the last measurement window.
+			int SpareWindows = 0; //!< Number of consecutive measurement windows with bandwidth and latency to spare. Quality is only raised after a few of these so the controller doesn't oscillate.
+
+			long long WindowStartTime = 0; //!< Real tick count the current measurement window started at.
+			unsigned long WindowStartDataSent = 0; //!< Total data sent to the client when the current measurement window started.
+			unsigned long WindowStartDataUncompressed = 0; //!< Total uncompressed data sent to the client when the current measurement window started.
+			int WindowFrames = 0; //!< Number of frames sent or skipped in the current measurement window.
+			int WindowCongestedFrames = 0; //!< Number of frames skipped because of congestion in the current measurement window.
+			int WindowEncodeMsec = 0; //!< Total ms spent encoding and sending frames in the current measurement window.
+		};
+
+		/// <summary>
+		/// The scene's terrain compressed into ready to send scene messages, shared by every player joining the scene.
+		/// </summary>
+		struct SceneTransferCache {
+			unsigned char SceneID = 0; //!< The ID of the scene the cache was built for.
+			std::vector<unsigned char> Packets; //!< The scene messages back to back, in the order they have to be sent in.
+			std::vector<int> PacketSizes; //!< The size of each scene message.
+		};
+
+		/// <summary>
+		/// A replicated entity's state along with the server-side data needed to decide which clients need it.
+		/// </summary>
+		struct ReplicatedEntity {
+			EntityStateNetworkData State; //!< The state as sent to clients.
+			float Radius; //!< The radius of the entity, used to check whether it's in a client's view.
+		};
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -177,7 +279,6 @@ namespace RTE {
 			RakNet::SystemAddress InternalId; //!<
 			int ResX; //!<
 			int ResY; //!<
-			std::thread *SendThread; //!<
 			std::string PlayerName; //!<
 		};
 
@@ -234,10 +335,14 @@ namespace RTE {
 		bool m_SendFrameData[c_MaxClients]; //!<
 		std::mutex m_SceneLock[c_MaxClients]; //!<
 
-		unsigned char m_TerrainChangeBuffer[c_MaxClients][c_MaxPixelLineBufferSize]; //!<
 		std::queue<SceneMan::TerrainChange> m_PendingTerrainChanges[c_MaxClients]; //!<
 		std::queue<SceneMan::TerrainChange> m_CurrentTerrainChanges[c_MaxClients]; //!<
 
+		std::vector<unsigned char> m_DirtyTerrainTiles[c_MaxClients]; //!< For every tile of the foreground and then the background layer, whether it changed since terrain changes were last sent to each player.
+		std::vector<int> m_DirtyTerrainTileIndices[c_MaxClients]; //!< The indices of the dirty tiles of each player, so they don't have to be searched for.
+		std::vector<unsigned char> m_TerrainChangePayload[c_MaxClients]; //!< Buffer the run-length encoded tiles are gathered in before compression.
+		std::vector<unsigned char> m_TerrainChangeMessage[c_MaxClients]; //!< Buffer the compressed terrain change message is built in.
+
 		std::mutex m_Mutex[c_MaxClients]; //!<
 
 		//std::mutex m_InputQueueMutex[c_MaxClients];
@@ -259,8 +364,65 @@ namespace RTE {
 		int m_BoxWidth; //!<
 		int m_BoxHeight; //!<
 
+		bool m_UseDeltaCompression; //!< Whether boxes that didn't change since they were last sent are skipped and changed boxes are sent XORed against their last sent content.
+		int m_KeyFrameInterval; //!< How many frames pass between full refreshes of all boxes, so boxes gone stale from lost packets are eventually corrected.
+		int m_FramesSinceKeyFrame[c_MaxClients]; //!< How many frames were sent to each client since the last full refresh.
+		unsigned short m_BoxFrameNumbers[c_MaxClients]; //!< Running frame counter each sent box is tagged with so the client can match deltas to the content they were made against. 0 is never used.
+		BITMAP *m_SentBackBuffer8[c_MaxClients]; //!< The content of every box as it was last sent to each client.
+		BITMAP *m_SentBackBufferGUI8[c_MaxClients]; //!< The content of every GUI box as it was last sent to each client.
+		std::vector<unsigned short> m_SentBoxFrameNumbers[c_MaxClients][2]; //!< The frame number each box of each layer was last sent with. 0 means the box wasn't sent yet.
+		static constexpr int c_SentFrameBoxesTrackedFrames = 120; //!< How many frames sent boxes are tracked for. RakNet reports lost boxes well within this, anything older is assumed delivered.
+		std::deque<SentFrameBox> m_SentFrameBoxes[c_MaxClients]; //!< The boxes recently sent to each client, oldest first, so the ones reported lost can be found. Only touched by the client's send job.
+		std::mutex m_LostFrameBoxReceiptsMutex; //!< Mutex guarding the lost frame box receipts, which are written by the main thread and read by the send threads.
+		std::vector<uint32_t> m_LostFrameBoxReceipts[c_MaxClients]; //!< Receipt numbers of the boxes RakNet reported lost for each client, waiting for the client's send job to send those boxes again in full.
+
 		int m_EmptyBlocks[MAX_STAT_RECORDS]; //!<
 		int m_FullBlocks[MAX_STAT_RECORDS]; //!<
+		int m_UnchangedBlocks[MAX_STAT_RECORDS]; //!< Number of boxes that were skipped because they didn't change since they were last sent.
+		int m_DeltaBlocks[MAX_STAT_RECORDS]; //!< Number of boxes that were sent as deltas against their last sent content.
+
+		static constexpr int c_TimerWheelSlotCount = 128; //!< Number of slots in the timer wheel send jobs are paced with. Each slot is a millisecond.
+		static constexpr int c_MaxFrameBoxEncoders = 8; //!< The most jobs a single frame's boxes are split between.
+
+		ThreadPool m_ThreadPool; //!< Worker threads shared by the send jobs of all players and the box encoding jobs of their frames.
+		std::thread m_SendSchedulerThread; //!< Thread that turns the timer wheel and hands due send jobs to the thread pool.
+		std::mutex m_TimerWheelMutex; //!< Mutex guarding the timer wheel and the scheduled send job flags.
+		std::array<std::vector<TimerWheelEntry>, c_TimerWheelSlotCount> m_TimerWheel; //!< Players waiting for their next send job, in the slot of the millisecond it's due in.
+		int m_TimerWheelPosition; //!< The slot of the timer wheel that was processed last.
+		bool m_SendJobScheduled[c_MaxClients]; //!< Whether each player has a send job waiting in the timer wheel or running. Each player has at most one, so a player's state is only ever touched by one job at a time.
+		std::vector<FrameBoxEncoder> m_FrameBoxEncoders[c_MaxClients]; //!< The box encoding jobs of each player.
+
+		static constexpr int c_MaxSceneTransferCacheChanges = 16384; //!< How many terrain changes can pile up on top of the scene transfer cache before it's rebuilt.
+
+		std::mutex m_SceneTransferCacheMutex; //!< Mutex guarding the scene transfer cache, the terrain changes made since it was built and its build state.
+		std::mutex m_SceneTransferCacheBuildMutex; //!< Held while the scene transfer cache is built from the terrain, so the scene can't be swapped out from under it.
+		std::shared_ptr<const SceneTransferCache> m_SceneTransferCache; //!< The compressed terrain of the current scene. Null until it's built.
+		std::vector<SceneMan::TerrainChange> m_SceneTransferCacheChanges; //!< Terrain changes made since the scene transfer cache was built, replayed to each player after sending them the cache.
+		bool m_SceneTransferCacheBuilding; //!< Whether a scene transfer cache build is queued or running.
+
+		static constexpr int c_StreamControllerWindowMsec = 500; //!< How long the adaptive bitrate controller measures a client's stream for before adjusting it.
+		static constexpr int c_StreamControllerSpareWindowsToRaise = 4; //!< How many measurement windows in a row need bandwidth and latency to spare before a client's quality is raised.
+		static constexpr int c_MinAdaptiveEncodingFps = 5; //!< The lowest frame rate the adaptive bitrate controller goes down to.
+		static constexpr int c_MaxAdaptiveFastAccelerationFactor = 16; //!< The highest LZ4 fast compression acceleration factor the adaptive bitrate controller goes up to when encoding can't keep up.
+		static const std::array<StreamQualityLevel, 6> c_StreamQualityLevels; //!< The quality ladder, from best to worst.
+
+		bool m_UseAdaptiveBitrate; //!< Whether each client's stream settings are continuously adjusted to hit the target bandwidth and latency, instead of being fixed to the configured ones.
+		int m_TargetBandwidth; //!< The bandwidth in kbit per second the adaptive bitrate controller aims to stay under for each client.
+		int m_TargetLatency; //!< The latency in ms the adaptive bitrate controller aims to stay under for each client.
+		StreamController m_StreamControllers[c_MaxClients]; //!< The adaptive bitrate controller of each client. These are only touched by the client's send job.
+
+		bool m_ReplicateEntities; //!< Whether entity states are sent for clients to draw locally instead of streaming the rendered scene layer. The GUI layer is still streamed.
+		std::mutex m_EntityStateMutex; //!< Mutex guarding the entity state snapshot and preset registry, which are written by the main thread and read by the send threads.
+		std::vector<ReplicatedEntity> m_EntityStates; //!< Snapshot of the states of all replicated entities, in draw order.
+		std::unordered_map<const Entity *, unsigned short> m_EntityPresetIDs; //!< Network preset IDs, keyed by the original preset the entities were created from.
+		std::vector<MsgEntityPreset> m_EntityPresets; //!< Ready to send preset messages, indexed by network preset ID.
+		size_t m_EntityPresetsSent[c_MaxClients]; //!< How many of the registered presets were already sent to each client. Presets are sent in ID order.
+		unsigned short m_EntityStateFrameNumbers[c_MaxClients]; //!< Running counter of entity state frames sent to each client.
+
+		bool m_SendInputOverlays; //!< Whether clients are sent the state of their input-driven overlays so they can draw them from their own input without waiting for a round trip.
+		std::mutex m_InputOverlayMutex; //!< Mutex guarding the input overlay snapshots, which are written by the main thread and read by the send threads.
+		MsgInputOverlay m_InputOverlays[c_MaxClients]; //!< Snapshot of the input overlay state of each player.
+		unsigned int m_LastInputSequence[c_MaxClients]; //!< The sequence number of the last input message processed for each player.
 		int m_SendBufferBytes[MAX_STAT_RECORDS]; //!<
 		int m_SendBufferMessages[MAX_STAT_RECORDS]; //!<
 		int m_DelayedFrames[c_MaxClients]; //!<
@@ -298,11 +460,23 @@ namespace RTE {
 
 #pragma region Thread Handling
 		/// <summary>
-		/// 
+		/// Turns the timer wheel once every millisecond and hands the send jobs that are due to the thread pool, until server mode is disabled.
 		/// </summary>
-		/// <param name="server"></param>
-		/// <param name="player"></param>
-		static void BackgroundSendThreadFunction(NetworkServer *server, short player);
+		/// <param name="server">The NetworkServer to schedule send jobs for.</param>
+		static void SendSchedulerThreadFunction(NetworkServer *server);
+
+		/// <summary>
+		/// Puts the send job of the specified player into the timer wheel.
+		/// </summary>
+		/// <param name="player">The player to schedule the send job for.</param>
+		/// <param name="microSecondsToWait">How long to wait before running the job. It's run in the next slot at the earliest.</param>
+		void ScheduleSendJob(short player, int microSecondsToWait);
+
+		/// <summary>
+		/// Sends whatever scene data, frame data and stats the specified player is due, then schedules the player's next send job.
+		/// </summary>
+		/// <param name="player">The player to send to.</param>
+		void RunSendJob(short player);
 
 		/// <summary>
 		/// 
@@ -356,6 +530,12 @@ namespace RTE {
 		/// <param name="packet"></param>
 		void ReceiveInputMsg(RakNet::Packet *packet);
 
+		/// <summary>
+		/// Queues a frame box RakNet reported lost to be sent again in full.
+		/// </summary>
+		/// <param name="packet">The ID_SND_RECEIPT_LOSS packet, carrying the receipt number of the lost box message.</param>
+		void ReceiveFrameBoxLoss(RakNet::Packet *packet);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -422,6 +602,18 @@ namespace RTE {
 		/// <param name="player"></param>
 		void SendSceneData(short player);
 
+		/// <summary>
+		/// Queues a build of the scene transfer cache for the current scene on the thread pool, unless one is already queued or running.
+		/// </summary>
+		void StartSceneTransferCacheBuild();
+
+		/// <summary>
+		/// Compresses the current scene's terrain into a new scene transfer cache and replaces the old one with it, if the scene didn't change in the meantime.
+		/// </summary>
+		/// <param name="sceneID">The ID of the scene the build was started for.</param>
+		/// <param name="changesBeforeBuild">How many of the logged terrain changes were made before the build started. These are contained in the new cache.</param>
+		void BuildSceneTransferCache(unsigned char sceneID, size_t changesBeforeBuild);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -436,17 +628,23 @@ namespace RTE {
 		bool NeedToProcessTerrainChanges(short player);
 
 		/// <summary>
-		/// 
+		/// Marks the terrain tiles touched by the pending terrain changes of the specified player as dirty and sends all dirty tiles.
 		/// </summary>
 		/// <param name="player"></param>
 		void ProcessTerrainChanges(short player);
 
 		/// <summary>
-		/// 
+		/// Run-length encodes the current content of all dirty terrain tiles of the specified player and sends them compressed, usually as a single message.
 		/// </summary>
-		/// <param name="player"></param>
-		/// <param name="terrainChange"></param>
-		void SendTerrainChangeMsg(short player, SceneMan::TerrainChange terrainChange);
+		/// <param name="player">The player to send to.</param>
+		void SendTerrainChangeMsg(short player);
+
+		/// <summary>
+		/// Compresses the gathered terrain tiles of the specified player into a terrain change message and sends it.
+		/// </summary>
+		/// <param name="player">The player to send to.</param>
+		/// <param name="tileCount">The number of tiles gathered in the payload buffer.</param>
+		void SendTerrainChangePayload(short player, int tileCount);
 
 		/// <summary>
 		/// 
@@ -476,6 +674,65 @@ namespace RTE {
 		/// <param name="player"></param>
 		void DestroyBackBuffer(short player);
 
+		/// <summary>
+		/// Forgets what was last sent to the specified player so the next frame sends every box in full.
+		/// </summary>
+		/// <param name="player">The player to reset frame delta state for.</param>
+		void ResetFrameDeltaState(short player);
+
+		/// <summary>
+		/// Makes the boxes reported lost since the last frame be sent in full, since the client doesn't hold the content any deltas against them would be made against.
+		/// Also forgets boxes sent too long ago to still be reported lost.
+		/// </summary>
+		/// <param name="player">The player to handle lost boxes of.</param>
+		void HandleLostFrameBoxes(short player);
+
+		/// <summary>
+		/// Resets the specified player's adaptive bitrate controller to the configured stream settings and starts a new measurement window.
+		/// </summary>
+		/// <param name="player">The player to reset the stream controller for.</param>
+		void ResetStreamController(short player);
+
+		/// <summary>
+		/// Counts a frame towards the specified player's current measurement window and, once the window is over, moves the player along the quality ladder and tunes the compression level to hit the target bandwidth and latency.
+		/// </summary>
+		/// <param name="player">The player to update the stream controller for.</param>
+		/// <param name="congested">Whether the frame is skipped because the connection is congested.</param>
+		void UpdateStreamController(short player, bool congested);
+
+		/// <summary>
+		/// Moves the specified player to a step of the quality ladder and applies its stream settings. Changing the box size forces every box to be resent in full.
+		/// </summary>
+		/// <param name="player">The player to set the quality level of.</param>
+		/// <param name="qualityLevel">The step of the quality ladder to move to.</param>
+		void SetStreamQualityLevel(short player, int qualityLevel);
+
+		/// <summary>
+		/// Compares a box against its last sent content and prepares it for sending, either as is or XORed against the last sent content.
+		/// </summary>
+		/// <param name="player">The player the box is being sent to.</param>
+		/// <param name="layer">The layer the box belongs to. 0 is the scene layer and 1 is the GUI layer.</param>
+		/// <param name="boxIndex">The index of the box in the per-layer box arrays.</param>
+		/// <param name="boxData">The box's current content, which is XORed in place if the box is to be sent as a delta.</param>
+		/// <param name="bpx">The X position of the box in the back buffer.</param>
+		/// <param name="bpy">The Y position of the box in the back buffer.</param>
+		/// <param name="width">The width of the box.</param>
+		/// <param name="height">The height of the box.</param>
+		/// <param name="isKeyFrame">Whether the box must be sent in full regardless of what was sent before.</param>
+		/// <param name="allowDelta">Whether the box may be sent as a delta if it changed. Empty boxes are always sent in full since the client clears them without any data.</param>
+		/// <returns>The frame number the box was XORed against, 0 if the box is to be sent in full or -1 if the box is unchanged and doesn't need to be sent.</returns>
+		int PrepareFrameBoxDelta(short player, short layer, int boxIndex, unsigned char *boxData, int bpx, int bpy, int width, int height, bool isKeyFrame, bool allowDelta);
+
+		/// <summary>
+		/// Encodes a range of box rows of the specified player's current frame into the encoder's buffers.
+		/// </summary>
+		/// <param name="player">The player the frame is being sent to.</param>
+		/// <param name="encoder">The encoder to encode with.</param>
+		/// <param name="firstRow">The first box row to encode.</param>
+		/// <param name="lastRow">The box row to stop at, exclusive.</param>
+		/// <param name="isKeyFrame">Whether every box must be sent in full.</param>
+		void EncodeFrameBoxRows(short player, FrameBoxEncoder &encoder, int firstRow, int lastRow, bool isKeyFrame);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -501,6 +758,41 @@ namespace RTE {
 		/// <param name="player"></param>
 		/// <returns></returns>
 		int SendFrame(short player);
+
+		/// <summary>
+		/// Takes a snapshot of the states of all entities for the send threads to replicate. Must be called from the main thread.
+		/// </summary>
+		void GatherEntityStates();
+
+		/// <summary>
+		/// Adds the state of a MovableObject and its Attachables to the entity state snapshot, in the order they're drawn in.
+		/// </summary>
+		/// <param name="movableObject">The MovableObject to add.</param>
+		void GatherEntityState(const MovableObject *movableObject);
+
+		/// <summary>
+		/// Gets the network preset ID for the preset of a MovableObject, registering the preset if it wasn't seen before.
+		/// </summary>
+		/// <param name="movableObject">The MovableObject to get the preset ID for.</param>
+		/// <returns>The network preset ID, or c_PixelEntityPresetID if the MovableObject wasn't created from a preset or no more IDs are available.</returns>
+		unsigned short GetEntityPresetID(const MovableObject *movableObject);
+
+		/// <summary>
+		/// Sends the presets the specified player doesn't know yet, then the states of all replicated entities in or near that player's view.
+		/// </summary>
+		/// <param name="player">The player to send to.</param>
+		void SendEntityStates(short player);
+
+		/// <summary>
+		/// Takes a snapshot of the input overlay state of each player, i.e. their analog aim, aim reticle, view lead and pie menu, for the send threads to send. Must be called from the main thread.
+		/// </summary>
+		void GatherInputOverlays();
+
+		/// <summary>
+		/// Sends the last snapshot of the specified player's input overlay state.
+		/// </summary>
+		/// <param name="player">The player to send to.</param>
+		void SendInputOverlayMsg(short player);
 #pragma endregion
 
 #pragma region Network Stats Handling
@@ -198,6 +198,11 @@ namespace RTE {
 			}
 			g_FrameMan.GetLargeFont()->DrawAligned(&bitmapToDrawTo, c_StatsOffsetX, c_StatsHeight + 100, str, GUIFont::Left);
 
+			if (g_FrameMan.IsDynamicResolutionEnabled()) {
+				std::snprintf(str, sizeof(str), "Render Scale: %.0f%% (Target %i FPS)", g_FrameMan.GetRenderScale() * 100.0F, g_FrameMan.GetDynamicResolutionTargetFPS());
+				g_FrameMan.GetLargeFont()->DrawAligned(&bitmapToDrawTo, c_StatsOffsetX, c_StatsHeight + 110, str, GUIFont::Left);
+			}
+
 			// If in split screen mode don't draw graphs because they don't fit anyway.
 			if (m_AdvancedPerfStats && g_FrameMan.GetScreenCount() == 1) { DrawPeformanceGraphs(bitmapToDrawTo); }
 		}
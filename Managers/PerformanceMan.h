@@ -105,6 +105,12 @@ namespace RTE {
 		/// </summary>
 		/// <param name="showGraphs">Whether to show the performance graphs or not.</param>
 		void ShowAdvancedPerformanceStats(bool showGraphs = true) { m_AdvancedPerfStats = showGraphs; }
+
+		/// <summary>
+		/// Gets the average of the last few milliseconds per frame readings.
+		/// </summary>
+		/// <returns>The average milliseconds per frame.</returns>
+		size_t GetMSPFAverage() const { return m_MSPFAverage; }
 #pragma endregion
 
 #pragma region Performance Counter Handling
@@ -13,6 +13,7 @@
 
 #include "PresetMan.h"
 #include "DataModule.h"
+#include "LoadProfiler.h"
 #include "SceneObject.h"
 #include "Loadout.h"
 #include "ACraft.h"
@@ -43,6 +44,39 @@ void PresetMan::Clear()
     m_DataModuleIDs.clear();
     m_OfficialModuleCount = 0;
     m_TotalGroupRegister.clear();
+    m_FoundPresets.clear();
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          ClearFoundPresets
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Forgets all the presets found by GetEntityPreset so far, so they're
+//                  searched for again the next time they're asked for.
+
+void PresetMan::ClearFoundPresets()
+{
+    // Clearing the maps instead of the vector keeps their buckets around for refilling
+    for (std::unordered_map<DataModule::PresetKey, const Entity *, DataModule::PresetKeyHash> &foundPresets : m_FoundPresets)
+        foundPresets.clear();
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          ForgetFoundPreset
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Forgets the presets found by GetEntityPreset so far under the type and
+//                  name of a newly added preset, since searches for it may find that one now.
+
+void PresetMan::ForgetFoundPreset(const Entity *pAddedPreset)
+{
+    // Searches are by exact type and name, so no others can find something else than before
+    DataModule::PresetKey presetKey(pAddedPreset->GetClassName(), pAddedPreset->GetPresetName());
+    for (std::unordered_map<DataModule::PresetKey, const Entity *, DataModule::PresetKeyHash> &foundPresets : m_FoundPresets)
+    {
+        if (!foundPresets.empty())
+            foundPresets.erase(presetKey);
+    }
 }
 
 /*
@@ -166,12 +200,17 @@ bool PresetMan::LoadDataModule(string moduleName, bool official, ProgressCallbac
 		m_DataModuleIDs.insert(pair<string, int>(lowercaseName, m_pDataModules.size() - 1));
     }
 
+    // Inserting an official module shifts the IDs of the ones after it, and the new module is searched before the official ones from its own ID
+    ClearFoundPresets();
+
     // Now actually create it
+    int profilerSection = LoadProfiler::BeginSection(LoadProfiler::DataModuleSection, moduleName);
     if (pModule->Create(moduleName, fpProgressCallback) < 0)
     {
         RTEAbort("Failed to find the " + moduleName + " Data Module!");
         return false;
     }
+    LoadProfiler::EndSection(profilerSection);
 
     pModule = 0;
 
@@ -326,7 +365,11 @@ bool PresetMan::AddEntityPreset(Entity *pEntToAdd, int whichModule, bool overwri
 {
     RTEAssert(whichModule >= 0 && whichModule < m_pDataModules.size(), "Tried to access an out of bounds data module number!");
 
-    return m_pDataModules[whichModule]->AddEntityPreset(pEntToAdd, overwriteSame, readFromFile);
+    if (!m_pDataModules[whichModule]->AddEntityPreset(pEntToAdd, overwriteSame, readFromFile))
+        return false;
+
+    ForgetFoundPreset(pEntToAdd);
+    return true;
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -349,18 +392,32 @@ const Entity * PresetMan::GetEntityPreset(string type, string preset, int whichM
         preset = preset.substr(slashPos + 1);
     }
 
+    if (whichModule < 0)
+        whichModule = -1;
+
+    // The hash of the key is only computed once for all the lookups below
+    DataModule::PresetKey presetKey(std::move(type), std::move(preset));
+
+    // See if this was already found before, from the same module
+    if (m_FoundPresets.size() != m_pDataModules.size() + 1)
+        m_FoundPresets.resize(m_pDataModules.size() + 1);
+    std::unordered_map<DataModule::PresetKey, const Entity *, DataModule::PresetKeyHash> &foundPresets = m_FoundPresets[whichModule + 1];
+    std::unordered_map<DataModule::PresetKey, const Entity *, DataModule::PresetKeyHash>::const_iterator foundItr = foundPresets.find(presetKey);
+    if (foundItr != foundPresets.end())
+        return foundItr->second;
+
     // All modules
     if (whichModule < 0)
     {
         // Search all modules
         for (int i = 0; i < m_pDataModules.size() && !pRetEntity; ++i)
-            pRetEntity = m_pDataModules[i]->GetEntityPreset(type, preset);
+            pRetEntity = m_pDataModules[i]->GetEntityPreset(presetKey);
     }
     // Specific module
     else
     {
         // Try to get it from the asked for module
-        pRetEntity = m_pDataModules[whichModule]->GetEntityPreset(type, preset);
+        pRetEntity = m_pDataModules[whichModule]->GetEntityPreset(presetKey);
 
         // If couldn't find it in there, then try all the official modules!
         if (!pRetEntity)
@@ -368,11 +425,15 @@ const Entity * PresetMan::GetEntityPreset(string type, string preset, int whichM
             RTEAssert(m_OfficialModuleCount <= m_pDataModules.size(), "More official modules than modules loaded?!");
             for (int i = 0; i < m_OfficialModuleCount && !pRetEntity; ++i)
             {
-                pRetEntity = m_pDataModules[i]->GetEntityPreset(type, preset);
+                pRetEntity = m_pDataModules[i]->GetEntityPreset(presetKey);
             }
         }
     }
 
+    // Only remember presets that were found, so misses don't pile up
+    if (pRetEntity)
+        foundPresets.emplace(std::move(presetKey), pRetEntity);
+
     return pRetEntity;
 }
 
@@ -419,7 +480,8 @@ const Entity * PresetMan::GetEntityPreset(Reader &reader)
 		else if (pNewInstance)
 		{
 			// Try to add the instance to the collection
-			m_pDataModules[whichModule]->AddEntityPreset(pNewInstance, reader.GetPresetOverwriting(), entityFilePath);
+			if (m_pDataModules[whichModule]->AddEntityPreset(pNewInstance, reader.GetPresetOverwriting(), entityFilePath))
+				ForgetFoundPreset(pNewInstance);
 
 			// Regardless of whether there was a collision or not, use whatever now exists in the instance map of that class and name
 			pReturnPreset = m_pDataModules[whichModule]->GetEntityPreset(pNewInstance->GetClassName(), pNewInstance->GetPresetName());
@@ -479,7 +541,8 @@ Entity * PresetMan::ReadReflectedPreset(Reader &reader)
 		{
 			// Try to add the instance to the collection.
 			// Note that we'll return this instance regardless of whether the adding was succesful or not
-			m_pDataModules[whichModule]->AddEntityPreset(pNewInstance, reader.GetPresetOverwriting(), entityFilePath);
+			if (m_pDataModules[whichModule]->AddEntityPreset(pNewInstance, reader.GetPresetOverwriting(), entityFilePath))
+				ForgetFoundPreset(pNewInstance);
 		    return pNewInstance;
 		}
     }
@@ -589,42 +652,13 @@ bool PresetMan::GetAllOfGroup(list<Entity *> &entityList, string group, string t
 Entity * PresetMan::GetRandomOfGroup(string group, string type, int whichModule)
 {
     RTEAssert(!group.empty(), "Looking for empty group!");
+    RTEAssert(whichModule < (int)m_pDataModules.size(), "Trying to get from an out of bounds DataModule ID!");
 
-    bool foundAny = false;
-    // The total list we'll select a random one from
-    list<Entity *> entityList;
-
-    // All modules
-    if (whichModule < 0)
-    {
-        // Get from all modules
-        for (int i = 0; i < m_pDataModules.size(); ++i)
-            // Send the list to each module, let them add
-            foundAny = m_pDataModules[i]->GetAllOfGroup(entityList, group, type) || foundAny;
-    }
-    // Specific one
-    else
-    {
-        RTEAssert(whichModule < m_pDataModules.size(), "Trying to get from an out of bounds DataModule ID!");
-        foundAny = m_pDataModules[whichModule]->GetAllOfGroup(entityList, group, type);
-    }
-
-    // Didn't find any of that group in those module(s)
-    if (!foundAny)
-        return 0;
-
-    // Pick one and return it
-    int current = 0;
-    int selection = RandomNum<int>(0, entityList.size() - 1);
-    for (list<Entity *>::iterator itr = entityList.begin(); itr != entityList.end(); ++itr)
-    {
-        if (current == selection)
-            return (*itr);
-        current++;
-    }
+    // The group members of the module(s) we'll select a random one from
+    vector<const DataModule::GroupMembers *> groupMembers;
+    AddGroupMembers(groupMembers, group, type, whichModule);
 
-    RTEAssert(0, "Tried selecting randomly but didn't?");
-    return 0;
+    return GetRandomOfGroupMembers(groupMembers, false, false);
 }
 
 
@@ -637,125 +671,33 @@ Entity * PresetMan::GetRandomOfGroup(string group, string type, int whichModule)
 Entity * PresetMan::GetRandomBuyableOfGroupFromTech(string group, string type, int whichModule)
 {
     RTEAssert(!group.empty(), "Looking for empty group!");
+    RTEAssert(whichModule < (int)m_pDataModules.size(), "Trying to get from an out of bounds DataModule ID!");
 
-    bool foundAny = false;
-    // The total list we'll select a random one from
-    list<Entity *> entityList;
-    list<Entity *> tempList;
-
-
-    string techString = " Tech";
-    string techName;
-    string::size_type techPos = string::npos;
+    // The group members of the module(s) we'll select a random one from
+    vector<const DataModule::GroupMembers *> groupMembers;
 
     // All modules
     if (whichModule < 0)
     {
+        string techString = " Tech";
         // Get from all modules
         for (int i = 0; i < m_pDataModules.size(); ++i)
-		{
-			// Select from tech-only modules
-			techName = m_pDataModules[i]->GetFriendlyName();
-			if (techName.find(techString) != string::npos)
-				// Send the list to each module, let them add
-				foundAny = m_pDataModules[i]->GetAllOfGroup(tempList, group, type) || foundAny;
-		}
+        {
+            // Select from tech-only modules
+            if (m_pDataModules[i]->GetFriendlyName().find(techString) != string::npos)
+                AddGroupMembers(groupMembers, group, type, i);
+        }
     }
     // Specific one
     else
-    {
-        RTEAssert(whichModule < m_pDataModules.size(), "Trying to get from an out of bounds DataModule ID!");
-        foundAny = m_pDataModules[whichModule]->GetAllOfGroup(tempList, group, type);
-    }
-
-	//Filter found entities, we need only buyables
-	if (foundAny)
-	{
-		//Do not filter anything if we're looking for brains
-		if (group == "Brains")
-		{
-			foundAny = false;
-			for (list<Entity *>::iterator oItr = tempList.begin(); oItr != tempList.end(); ++oItr)
-			{
-				entityList.push_back(*oItr);
-				foundAny = true;
-			}
-		}
-		else
-		{
-			foundAny = false;
-			for (list<Entity *>::iterator oItr = tempList.begin(); oItr != tempList.end(); ++oItr)
-			{
-				SceneObject * pSObject = dynamic_cast<SceneObject *>(*oItr);
-				// Buyable and not brain?
-				if (pSObject && pSObject->IsBuyable() && !pSObject->IsInGroup("Brains"))
-				{
-					entityList.push_back(*oItr);
-					foundAny = true;
-				}
-			}
-		}
-	}
-
-	// Didn't find any of that group in those module(s)
-    if (!foundAny)
-        return 0;
-
-    // Pick one and return it
-    int current = 0;
-    int selection = RandomNum<int>(0, entityList.size() - 1);
-
-	int totalWeight = 0;
-	for (list<Entity *>::iterator itr = entityList.begin(); itr != entityList.end(); ++itr)
-		totalWeight += (*itr)->GetRandomWeight();
-
-	// Use random weights if looking in specific modules
-	if (whichModule >= 0)
-	{
-		if (totalWeight == 0)
-			return 0;
-
-		selection = RandomNum(0, totalWeight - 1);
-
-		for (list<Entity *>::iterator itr = entityList.begin(); itr != entityList.end(); ++itr)
-		{
-			bool found = false;
-			int bucketCounter = 0;
-
-			if ((*itr)->GetRandomWeight() > 0)
-			{
-				while (bucketCounter < (*itr)->GetRandomWeight())
-				{
-					if (current == selection)
-					{
-						found = true;
-						break;
-					}
-
-					current++;
-					bucketCounter++;
-				}
-			}
-
-			if (found)
-				return (*itr);
-		}
-	}
-	else 
-	{
-		for (list<Entity *>::iterator itr = entityList.begin(); itr != entityList.end(); ++itr)
-		{
-			if (current == selection)
-				return (*itr);
+        AddGroupMembers(groupMembers, group, type, whichModule);
 
-			current++;
-		}
-	}
-
-    RTEAssert(0, "Tried selecting randomly but didn't?");
-    return 0;
+    // We need only buyables, but do not filter anything if we're looking for brains
+    // Use random weights if looking in specific modules
+    return GetRandomOfGroupMembers(groupMembers, group != "Brains", whichModule >= 0);
 }
 
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          GetAllOfGroupInModuleSpace
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -797,37 +739,97 @@ bool PresetMan::GetAllOfGroupInModuleSpace(list<Entity *> &entityList, string gr
 Entity * PresetMan::GetRandomOfGroupInModuleSpace(string group, string type, int whichModuleSpace)
 {
     RTEAssert(!group.empty(), "Looking for empty group!");
+    RTEAssert(whichModuleSpace < (int)m_pDataModules.size(), "Trying to get from an out of bounds DataModule ID!");
 
-    bool foundAny = false;
-    // The total list we'll select a random one from
-    list<Entity *> entityList;
+    // The group members of the modules we'll select a random one from
+    vector<const DataModule::GroupMembers *> groupMembers;
 
     // All modules
     if (whichModuleSpace < 0)
-        foundAny = GetAllOfGroup(entityList, group, type, whichModuleSpace);
+        AddGroupMembers(groupMembers, group, type, whichModuleSpace);
     // Specific module space
     else
     {
         // Get all entitys of the specific group the official modules loaded before the specified one
         for (int module = 0; module < m_OfficialModuleCount && module < whichModuleSpace; ++module)
-            foundAny = GetAllOfGroup(entityList, group, type, module) || foundAny;
+            AddGroupMembers(groupMembers, group, type, module);
 
         // Now get the groups of the specified module (official or not)
-        foundAny = GetAllOfGroup(entityList, group, type, whichModuleSpace) || foundAny;
+        AddGroupMembers(groupMembers, group, type, whichModuleSpace);
+    }
+
+    return GetRandomOfGroupMembers(groupMembers, false, false);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          AddGroupMembers
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Adds the group members of a specific type in a specific group of one
+//                  or all modules to a list of them.
+
+void PresetMan::AddGroupMembers(vector<const DataModule::GroupMembers *> &groupMembers, const string &group, const string &type, int whichModule)
+{
+    // All modules
+    if (whichModule < 0)
+    {
+        for (int i = 0; i < m_pDataModules.size(); ++i)
+            AddGroupMembers(groupMembers, group, type, i);
+    }
+    // Specific one, if it has any
+    else if (const DataModule::GroupMembers *moduleGroupMembers = m_pDataModules[whichModule]->GetGroupMembers(group, type))
+        groupMembers.push_back(moduleGroupMembers);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetRandomOfGroupMembers
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Picks a random Entity out of the group members of several modules,
+//                  without gathering them all into one list first.
+
+Entity * PresetMan::GetRandomOfGroupMembers(const vector<const DataModule::GroupMembers *> &groupMembers, bool buyableOnly, bool useRandomWeights) const
+{
+    // Every Entity takes up as many selections as its random weight, or just one if not using weights
+    int totalWeight = 0;
+    for (const DataModule::GroupMembers *moduleGroupMembers : groupMembers)
+    {
+        const vector<Entity *> &members = buyableOnly ? moduleGroupMembers->Buyable : moduleGroupMembers->All;
+        if (!useRandomWeights)
+            totalWeight += (int)members.size();
+        else
+        {
+            for (const Entity *pEntity : members)
+                totalWeight += std::max(pEntity->GetRandomWeight(), 0);
+        }
     }
 
     // Didn't find any of that group in those module(s)
-    if (!foundAny)
+    if (totalWeight <= 0)
         return 0;
 
     // Pick one and return it
-    int current = 0;
-    int selection = RandomNum<int>(0, entityList.size() - 1);
-    for (list<Entity *>::iterator itr = entityList.begin(); itr != entityList.end(); ++itr)
+    int selection = RandomNum<int>(0, totalWeight - 1);
+    for (const DataModule::GroupMembers *moduleGroupMembers : groupMembers)
     {
-        if (current == selection)
-            return (*itr);
-        current++;
+        const vector<Entity *> &members = buyableOnly ? moduleGroupMembers->Buyable : moduleGroupMembers->All;
+        if (!useRandomWeights)
+        {
+            // Without weights the selection can skip over whole modules
+            if (selection < (int)members.size())
+                return members[selection];
+            selection -= (int)members.size();
+        }
+        else
+        {
+            for (Entity *pEntity : members)
+            {
+                int weight = std::max(pEntity->GetRandomWeight(), 0);
+                if (selection < weight)
+                    return pEntity;
+                selection -= weight;
+            }
+        }
     }
 
     RTEAssert(0, "Tried selecting randomly but didn't?");
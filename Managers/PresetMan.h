@@ -15,6 +15,7 @@
 // Inclusions of header files
 
 #include "Entity.h"
+#include "DataModule.h"
 #include "Singleton.h"
 
 #define g_PresetMan PresetMan::Instance()
@@ -23,7 +24,6 @@ namespace RTE
 {
 
 class Actor;
-class DataModule;
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -516,6 +516,12 @@ protected:
     // This is just a handy total of all the groups registered in all the individual DataModule:s
     std::list<std::string> m_TotalGroupRegister;
 
+    // Presets already found by GetEntityPreset, mapped by type and preset name for each module searched from.
+    // The first map is for searches of all modules, the rest are offset by one from the module ID.
+    // Cleared whenever a module is loaded, and the entry of a preset's type and name whenever one is added, since those can change what a search finds.
+    // Overwriting a preset clones over the existing instance, so what was found for it stays valid
+    std::vector<std::unordered_map<DataModule::PresetKey, const Entity *, DataModule::PresetKeyHash>> m_FoundPresets;
+
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // Private member variable and method declarations
@@ -533,6 +539,59 @@ private:
     void Clear();
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          ClearFoundPresets
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Forgets all the presets found by GetEntityPreset so far, so they're
+//                  searched for again the next time they're asked for.
+// Arguments:       None.
+// Return value:    None.
+
+    void ClearFoundPresets();
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          ForgetFoundPreset
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Forgets the presets found by GetEntityPreset so far under the type and
+//                  name of a newly added preset, since searches for it may find that one now.
+// Arguments:       The preset that was just added. Ownership is NOT transferred!
+// Return value:    None.
+
+    void ForgetFoundPreset(const Entity *pAddedPreset);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          AddGroupMembers
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Adds the group members of a specific type in a specific group of one
+//                  or all modules to a list of them.
+// Arguments:       The list the group members of each module will be added to.
+//                  Ownership of the list or the group members is NOT transferred!
+//                  The group to look for. "All" will look in all.
+//                  The name of the least common denominator type of the Entitys you want.
+//                  "All" will look at all types.
+//                  Whether to only get those of one specific DataModule (0-n), or all (-1).
+// Return value:    None.
+
+    void AddGroupMembers(std::vector<const DataModule::GroupMembers *> &groupMembers, const std::string &group, const std::string &type, int whichModule);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetRandomOfGroupMembers
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Picks a random Entity out of the group members of several modules,
+//                  without gathering them all into one list first.
+// Arguments:       The group members of each module to pick from. Ownership is NOT transferred!
+//                  Whether to only pick from the buyable group members.
+//                  Whether to give each Entity a chance according to its random weight,
+//                  instead of the same chance for all.
+// Return value:    The Entity preset that was randomly selected, or 0 if there were none
+//                  to select from. Ownership is NOT transferred!
+
+    Entity * GetRandomOfGroupMembers(const std::vector<const DataModule::GroupMembers *> &groupMembers, bool buyableOnly, bool useRandomWeights) const;
+
+
 	// Disallow the use of some implicit methods.
 	PresetMan(const PresetMan &reference) = delete;
 	PresetMan & operator=(const PresetMan &rhs) = delete;
@@ -1,4 +1,5 @@
 #include "PrimitiveMan.h"
+#include "SceneMan.h"
 #include "Entity.h"
 #include "MOSprite.h"
 
@@ -6,30 +7,106 @@ namespace RTE {
 
 	const std::string PrimitiveMan::c_ClassName = "PrimitiveMan";
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	PrimitiveMan::~PrimitiveMan() {
+		ClearPrimitivesList();
+		for (std::vector<GraphicalPrimitive *> &primitivePool : m_PrimitivePools) {
+			for (const GraphicalPrimitive *primitive : primitivePool) {
+				delete primitive;
+			}
+			primitivePool.clear();
+		}
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void PrimitiveMan::DrawBitmapPrimitive(short player, Vector centerPos, Entity *entity, float rotAngle, unsigned short frame, bool hFlipped, bool vFlipped) {
 		const MOSprite *moSprite = dynamic_cast<MOSprite *>(entity);
 		if (moSprite) {
 			BITMAP *bitmap = moSprite->GetSpriteFrame(frame);
-			if (bitmap) { m_Primitives.push_back(new BitmapPrimitive(player, centerPos, bitmap, rotAngle, hFlipped, vFlipped)); }
+			if (bitmap) { SchedulePrimitive<BitmapPrimitive>(player, centerPos, bitmap, rotAngle, hFlipped, vFlipped); }
 		}
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void PrimitiveMan::ClearPrimitivesList() {
-		for (const GraphicalPrimitive *primitive : m_Primitives) {
-			delete primitive;
+		for (GraphicalPrimitive *primitive : m_Primitives) {
+			m_PrimitivePools[static_cast<size_t>(primitive->GetPrimitiveType())].push_back(primitive);
 		}
 		m_Primitives.clear();
+		for (std::vector<GraphicalPrimitive *> &screenPrimitives : m_ScreenPrimitives) {
+			screenPrimitives.clear();
+		}
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void PrimitiveMan::DrawPrimitives(short player, BITMAP *targetBitmap, const Vector &targetPos) const {
-		for (GraphicalPrimitive *primitive : m_Primitives) {
-			if (player == primitive->m_Player || primitive->m_Player == -1) { primitive->Draw(targetBitmap, targetPos); }
+	bool PrimitiveMan::IsPrimitiveOnScreen(const GraphicalPrimitive *primitive, const Box &screenBox) const {
+		Box primitiveBox = primitive->GetBoundingBox();
+
+		// Check against the screen and, on wrapping scenes, against the screen shifted across the seams
+		int sceneWidth = g_SceneMan.SceneWrapsX() ? g_SceneMan.GetSceneWidth() : 0;
+		int sceneHeight = g_SceneMan.SceneWrapsY() ? g_SceneMan.GetSceneHeight() : 0;
+
+		for (int wrapX = (sceneWidth > 0) ? -1 : 0; wrapX <= ((sceneWidth > 0) ? 1 : 0); ++wrapX) {
+			for (int wrapY = (sceneHeight > 0) ? -1 : 0; wrapY <= ((sceneHeight > 0) ? 1 : 0); ++wrapY) {
+				float left = primitiveBox.m_Corner.m_X + static_cast<float>(wrapX * sceneWidth);
+				float top = primitiveBox.m_Corner.m_Y + static_cast<float>(wrapY * sceneHeight);
+				// Inclusive and with a pixel to spare, as the primitives are drawn inclusive of their end coordinates and lines and boxes can be zero width
+				if (left <= screenBox.m_Corner.m_X + screenBox.m_Width + 1 && left + primitiveBox.m_Width + 1 >= screenBox.m_Corner.m_X &&
+					top <= screenBox.m_Corner.m_Y + screenBox.m_Height + 1 && top + primitiveBox.m_Height + 1 >= screenBox.m_Corner.m_Y) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PrimitiveMan::FlushPrimitiveBatch(BITMAP *targetBitmap, const Vector &targetPos) {
+		if (m_PrimitiveBatch.empty()) {
+			return;
+		}
+		switch (m_PrimitiveBatch.front()->GetPrimitiveType()) {
+			case GraphicalPrimitive::PrimitiveType::Line:
+				LinePrimitive::DrawBatch(targetBitmap, targetPos, m_PrimitiveBatch);
+				break;
+			case GraphicalPrimitive::PrimitiveType::Box:
+				BoxPrimitive::DrawBatch(targetBitmap, targetPos, m_PrimitiveBatch);
+				break;
+			case GraphicalPrimitive::PrimitiveType::BoxFill:
+				BoxFillPrimitive::DrawBatch(targetBitmap, targetPos, m_PrimitiveBatch);
+				break;
+			default:
+				for (GraphicalPrimitive *primitive : m_PrimitiveBatch) {
+					primitive->Draw(targetBitmap, targetPos);
+				}
+				break;
+		}
+		m_PrimitiveBatch.clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PrimitiveMan::DrawPrimitives(short player, BITMAP *targetBitmap, const Vector &targetPos) {
+		if (player < 0 || player >= c_MaxScreenCount) {
+			return;
+		}
+		Box screenBox(targetPos, static_cast<float>(targetBitmap->w), static_cast<float>(targetBitmap->h));
+
+		// Primitives are drawn in the order they were scheduled so overlapping ones layer the same way, so only consecutive visible primitives of the same type are batched together
+		for (GraphicalPrimitive *primitive : m_ScreenPrimitives[player]) {
+			if (!IsPrimitiveOnScreen(primitive, screenBox)) {
+				continue;
+			}
+			if (!m_PrimitiveBatch.empty() && m_PrimitiveBatch.front()->GetPrimitiveType() != primitive->GetPrimitiveType()) {
+				FlushPrimitiveBatch(targetBitmap, targetPos);
+			}
+			m_PrimitiveBatch.push_back(primitive);
 		}
+		FlushPrimitiveBatch(targetBitmap, targetPos);
 	}
-}
\ No newline at end of file
+}
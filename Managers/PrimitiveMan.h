@@ -3,6 +3,7 @@
 
 #include "Singleton.h"
 #include "Primitive.h"
+#include "Constants.h"
 
 #define g_PrimitiveMan PrimitiveMan::Instance()
 
@@ -28,22 +29,22 @@ namespace RTE {
 		/// <summary>
 		/// Destructor method used to clean up a PrimitiveMan object before deletion from system memory.
 		/// </summary>
-		~PrimitiveMan() { ClearPrimitivesList(); }
+		~PrimitiveMan();
 
 		/// <summary>
-		/// Delete all scheduled primitives, called on every FrameMan sim update.
+		/// Clears all scheduled primitives, called on every FrameMan sim update. The primitive objects themselves are kept around to be reused by the next frame's primitives.
 		/// </summary>
 		void ClearPrimitivesList();
 #pragma endregion
 
 #pragma region Primitive Drawing
 		/// <summary>
-		/// Draws all stored primitives on the screen for specified player.
+		/// Draws all stored primitives on the screen for specified player. Primitives that don't intersect the screen are culled, and runs of consecutive primitives of the same type are drawn as batches where possible.
 		/// </summary>
 		/// <param name="player">Player to draw for.</param>
 		/// <param name="targetBitmap">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position to draw.</param>
-		void DrawPrimitives(short player, BITMAP *targetBitmap, const Vector &targetPos) const;
+		void DrawPrimitives(short player, BITMAP *targetBitmap, const Vector &targetPos);
 
 		/// <summary>
 		/// Schedule to draw a line primitive.
@@ -51,7 +52,7 @@ namespace RTE {
 		/// <param name="startPos">Start position of primitive in scene coordinates.</param>
 		/// <param name="endPos">End position of primitive in scene coordinates.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawLinePrimitive(Vector startPos, Vector endPos, unsigned char color) { m_Primitives.push_back(new LinePrimitive(-1, startPos, endPos, color)); }
+		void DrawLinePrimitive(Vector startPos, Vector endPos, unsigned char color) { SchedulePrimitive<LinePrimitive>(-1, startPos, endPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a line primitive visible only to a specified player.
@@ -60,7 +61,7 @@ namespace RTE {
 		/// <param name="startPos">Start position of primitive in scene coordinates.</param>
 		/// <param name="endPos">End position of primitive in scene coordinates.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawLinePrimitive(short player, Vector startPos, Vector endPos, unsigned char color) { m_Primitives.push_back(new LinePrimitive(player, startPos, endPos, color)); }
+		void DrawLinePrimitive(short player, Vector startPos, Vector endPos, unsigned char color) { SchedulePrimitive<LinePrimitive>(player, startPos, endPos, color); }
 
 		/// <summary>
 		/// Schedule to draw an arc primitive.
@@ -70,7 +71,7 @@ namespace RTE {
 		/// <param name="endAngle">The angle at which the arc drawing ends.</param>
 		/// <param name="radius">Radius of the arc primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawArcPrimitive(Vector centerPos, float startAngle, float endAngle, short radius, unsigned char color) { m_Primitives.push_back(new ArcPrimitive(-1, centerPos, startAngle, endAngle, radius, 1, color)); }
+		void DrawArcPrimitive(Vector centerPos, float startAngle, float endAngle, short radius, unsigned char color) { SchedulePrimitive<ArcPrimitive>(-1, centerPos, startAngle, endAngle, radius, 1, color); }
 
 		/// <summary>
 		/// Schedule to draw an arc primitive with the option to change thickness.
@@ -81,7 +82,7 @@ namespace RTE {
 		/// <param name="radius">Radius of the arc primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
 		/// <param name="thickness">Thickness of the arc in pixels.</param>
-		void DrawArcPrimitive(Vector centerPos, float startAngle, float endAngle, short radius, unsigned char color, short thickness) { m_Primitives.push_back(new ArcPrimitive(-1, centerPos, startAngle, endAngle, radius, thickness, color)); }
+		void DrawArcPrimitive(Vector centerPos, float startAngle, float endAngle, short radius, unsigned char color, short thickness) { SchedulePrimitive<ArcPrimitive>(-1, centerPos, startAngle, endAngle, radius, thickness, color); }
 
 		/// <summary>
 		/// Schedule to draw an arc primitive visible only to a specified player.
@@ -92,7 +93,7 @@ namespace RTE {
 		/// <param name="endAngle">The angle at which the arc drawing ends.</param>
 		/// <param name="radius">Radius of the arc primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawArcPrimitive(short player, Vector centerPos, float startAngle, float endAngle, short radius, unsigned char color) { m_Primitives.push_back(new ArcPrimitive(player, centerPos, startAngle, endAngle, radius, 1, color)); }
+		void DrawArcPrimitive(short player, Vector centerPos, float startAngle, float endAngle, short radius, unsigned char color) { SchedulePrimitive<ArcPrimitive>(player, centerPos, startAngle, endAngle, radius, 1, color); }
 
 		/// <summary>
 		/// Schedule to draw an arc primitive visible only to a specified player with the option to change thickness.
@@ -104,7 +105,7 @@ namespace RTE {
 		/// <param name="radius">Radius of the arc primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
 		/// <param name="thickness">Thickness of the arc in pixels.</param>
-		void DrawArcPrimitive(short player, Vector centerPos, float startAngle, float endAngle, short radius, unsigned char color, short thickness) { m_Primitives.push_back(new ArcPrimitive(player, centerPos, startAngle, endAngle, radius, thickness, color)); }
+		void DrawArcPrimitive(short player, Vector centerPos, float startAngle, float endAngle, short radius, unsigned char color, short thickness) { SchedulePrimitive<ArcPrimitive>(player, centerPos, startAngle, endAngle, radius, thickness, color); }
 
 		/// <summary>
 		/// Schedule to draw a Bezier spline primitive.
@@ -114,7 +115,7 @@ namespace RTE {
 		/// <param name="guideB">The second guide point that controls the curve of the spline. The spline won't necessarily pass through this point, but it will affect it's shape.</param>
 		/// <param name="endPos">End position of primitive in scene coordinates.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawSplinePrimitive(Vector startPos, Vector guideA, Vector guideB, Vector endPos, unsigned char color) { m_Primitives.push_back(new SplinePrimitive(-1, startPos, guideA, guideB, endPos, color)); }
+		void DrawSplinePrimitive(Vector startPos, Vector guideA, Vector guideB, Vector endPos, unsigned char color) { SchedulePrimitive<SplinePrimitive>(-1, startPos, guideA, guideB, endPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a Bezier spline primitive visible only to a specified player.
@@ -125,7 +126,7 @@ namespace RTE {
 		/// <param name="guideB">The second guide point that controls the curve of the spline. The spline won't necessarily pass through this point, but it will affect it's shape.</param>
 		/// <param name="endPos">End position of primitive in scene coordinates.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawSplinePrimitive(short player, Vector startPos, Vector guideA, Vector guideB, Vector endPos, unsigned char color) { m_Primitives.push_back(new SplinePrimitive(player, startPos, guideA, guideB, endPos, color)); }
+		void DrawSplinePrimitive(short player, Vector startPos, Vector guideA, Vector guideB, Vector endPos, unsigned char color) { SchedulePrimitive<SplinePrimitive>(player, startPos, guideA, guideB, endPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a box primitive.
@@ -133,7 +134,7 @@ namespace RTE {
 		/// <param name="topLeftPos">Start position of primitive in scene coordinates. Top left corner.</param>
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawBoxPrimitive(Vector topLeftPos, Vector bottomRightPos, unsigned char color) { m_Primitives.push_back(new BoxPrimitive(-1, topLeftPos, bottomRightPos, color)); }
+		void DrawBoxPrimitive(Vector topLeftPos, Vector bottomRightPos, unsigned char color) { SchedulePrimitive<BoxPrimitive>(-1, topLeftPos, bottomRightPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a box primitive visible only to a specified player.
@@ -142,7 +143,7 @@ namespace RTE {
 		/// <param name="topLeftPos">Start position of primitive in scene coordinates. Top left corner.</param>
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawBoxPrimitive(short player, Vector topLeftPos, Vector bottomRightPos, unsigned char color) { m_Primitives.push_back(new BoxPrimitive(player, topLeftPos, bottomRightPos, color)); }
+		void DrawBoxPrimitive(short player, Vector topLeftPos, Vector bottomRightPos, unsigned char color) { SchedulePrimitive<BoxPrimitive>(player, topLeftPos, bottomRightPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled box primitive.
@@ -150,7 +151,7 @@ namespace RTE {
 		/// <param name="topLeftPos">Start position of primitive in scene coordinates. Top left corner.</param>
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawBoxFillPrimitive(Vector topLeftPos, Vector bottomRightPos, unsigned char color) { m_Primitives.push_back(new BoxFillPrimitive(-1, topLeftPos, bottomRightPos, color)); }
+		void DrawBoxFillPrimitive(Vector topLeftPos, Vector bottomRightPos, unsigned char color) { SchedulePrimitive<BoxFillPrimitive>(-1, topLeftPos, bottomRightPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled box primitive visible only to a specified player.
@@ -159,7 +160,7 @@ namespace RTE {
 		/// <param name="topLeftPos">Start position of primitive in scene coordinates. Top left corner.</param>
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawBoxFillPrimitive(short player, Vector topLeftPos, Vector bottomRightPos, unsigned char color) { m_Primitives.push_back(new BoxFillPrimitive(player, topLeftPos, bottomRightPos, color)); }
+		void DrawBoxFillPrimitive(short player, Vector topLeftPos, Vector bottomRightPos, unsigned char color) { SchedulePrimitive<BoxFillPrimitive>(player, topLeftPos, bottomRightPos, color); }
 
 		/// <summary>
 		/// Schedule to draw a rounded box primitive.
@@ -168,7 +169,7 @@ namespace RTE {
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="cornerRadius">The radius of the corners of the box. Smaller radius equals sharper corners.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawRoundedBoxPrimitive(Vector topLeftPos, Vector bottomRightPos, float cornerRadius, unsigned char color) { m_Primitives.push_back(new RoundedBoxPrimitive(-1, topLeftPos, bottomRightPos, cornerRadius, color)); }
+		void DrawRoundedBoxPrimitive(Vector topLeftPos, Vector bottomRightPos, float cornerRadius, unsigned char color) { SchedulePrimitive<RoundedBoxPrimitive>(-1, topLeftPos, bottomRightPos, cornerRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a rounded box primitive visible only to a specified player.
@@ -178,7 +179,7 @@ namespace RTE {
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="cornerRadius">The radius of the corners of the box. Smaller radius equals sharper corners.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawRoundedBoxPrimitive(short player, Vector topLeftPos, Vector bottomRightPos, float cornerRadius, unsigned char color) { m_Primitives.push_back(new RoundedBoxPrimitive(player, topLeftPos, bottomRightPos, cornerRadius, color)); }
+		void DrawRoundedBoxPrimitive(short player, Vector topLeftPos, Vector bottomRightPos, float cornerRadius, unsigned char color) { SchedulePrimitive<RoundedBoxPrimitive>(player, topLeftPos, bottomRightPos, cornerRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled rounded box primitive.
@@ -187,7 +188,7 @@ namespace RTE {
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="cornerRadius">The radius of the corners of the box. Smaller radius equals sharper corners.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawRoundedBoxFillPrimitive(Vector topLeftPos, Vector bottomRightPos, float cornerRadius, unsigned char color) { m_Primitives.push_back(new RoundedBoxFillPrimitive(-1, topLeftPos, bottomRightPos, cornerRadius, color)); }
+		void DrawRoundedBoxFillPrimitive(Vector topLeftPos, Vector bottomRightPos, float cornerRadius, unsigned char color) { SchedulePrimitive<RoundedBoxFillPrimitive>(-1, topLeftPos, bottomRightPos, cornerRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled rounded box primitive visible only to a specified player.
@@ -197,7 +198,7 @@ namespace RTE {
 		/// <param name="bottomRightPos">End position of primitive in scene coordinates. Bottom right corner.</param>
 		/// <param name="cornerRadius">The radius of the corners of the box. Smaller radius equals sharper corners.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawRoundedBoxFillPrimitive(short player, Vector topLeftPos, Vector bottomRightPos, float cornerRadius, unsigned char color) { m_Primitives.push_back(new RoundedBoxFillPrimitive(player, topLeftPos, bottomRightPos, cornerRadius, color)); }
+		void DrawRoundedBoxFillPrimitive(short player, Vector topLeftPos, Vector bottomRightPos, float cornerRadius, unsigned char color) { SchedulePrimitive<RoundedBoxFillPrimitive>(player, topLeftPos, bottomRightPos, cornerRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a circle primitive.
@@ -205,7 +206,7 @@ namespace RTE {
 		/// <param name="centerPos">Position of primitive's center in scene coordinates.</param>
 		/// <param name="radius">Radius of circle primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawCirclePrimitive(Vector centerPos, short radius, unsigned char color) { m_Primitives.push_back(new CirclePrimitive(-1, centerPos, radius, color)); }
+		void DrawCirclePrimitive(Vector centerPos, short radius, unsigned char color) { SchedulePrimitive<CirclePrimitive>(-1, centerPos, radius, color); }
 
 		/// <summary>
 		/// Schedule to draw a circle primitive visible only to a specified player.
@@ -214,7 +215,7 @@ namespace RTE {
 		/// <param name="centerPos">Position of primitive's center in scene coordinates.</param>
 		/// <param name="radius">Radius of circle primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawCirclePrimitive(short player, Vector centerPos, short radius, unsigned char color) { m_Primitives.push_back(new CirclePrimitive(player, centerPos, radius, color)); }
+		void DrawCirclePrimitive(short player, Vector centerPos, short radius, unsigned char color) { SchedulePrimitive<CirclePrimitive>(player, centerPos, radius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled circle primitive.
@@ -222,7 +223,7 @@ namespace RTE {
 		/// <param name="centerPos">Position of primitive's center in scene coordinates.</param>
 		/// <param name="radius">Radius of circle primitive.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawCircleFillPrimitive(Vector centerPos, short radius, unsigned char color) { m_Primitives.push_back(new CircleFillPrimitive(-1, centerPos, radius, color)); }
+		void DrawCircleFillPrimitive(Vector centerPos, short radius, unsigned char color) { SchedulePrimitive<CircleFillPrimitive>(-1, centerPos, radius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled circle primitive visible only to a specified player.
@@ -231,7 +232,7 @@ namespace RTE {
 		/// <param name="centerPos">Position of primitive's center in scene coordinates.</param>
 		/// <param name="radius">Radius of circle primitive.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawCircleFillPrimitive(short player, Vector centerPos, short radius, unsigned char color) { m_Primitives.push_back(new CircleFillPrimitive(player, centerPos, radius, color)); }
+		void DrawCircleFillPrimitive(short player, Vector centerPos, short radius, unsigned char color) { SchedulePrimitive<CircleFillPrimitive>(player, centerPos, radius, color); }
 
 		/// <summary>
 		/// Schedule to draw an ellipse primitive.
@@ -240,7 +241,7 @@ namespace RTE {
 		/// <param name="horizRadius">Horizontal radius of the ellipse primitive.</param>
 		/// <param name="vertRadius">Vertical radius of the ellipse primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawEllipsePrimitive(Vector centerPos, short horizRadius, short vertRadius, unsigned char color) { m_Primitives.push_back(new EllipsePrimitive(-1, centerPos, horizRadius, vertRadius, color)); }
+		void DrawEllipsePrimitive(Vector centerPos, short horizRadius, short vertRadius, unsigned char color) { SchedulePrimitive<EllipsePrimitive>(-1, centerPos, horizRadius, vertRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw an ellipse primitive visible only to a specified player.
@@ -250,7 +251,7 @@ namespace RTE {
 		/// <param name="horizRadius">Horizontal radius of the ellipse primitive.</param>
 		/// <param name="vertRadius">Vertical radius of the ellipse primitive.</param>
 		/// <param name="color">Color to draw primitive with.</param>
-		void DrawEllipsePrimitive(short player, Vector centerPos, short horizRadius, short vertRadius, unsigned char color) { m_Primitives.push_back(new EllipsePrimitive(player, centerPos, horizRadius, vertRadius, color)); }
+		void DrawEllipsePrimitive(short player, Vector centerPos, short horizRadius, short vertRadius, unsigned char color) { SchedulePrimitive<EllipsePrimitive>(player, centerPos, horizRadius, vertRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled ellipse primitive.
@@ -259,7 +260,7 @@ namespace RTE {
 		/// <param name="horizRadius">Horizontal radius of the ellipse primitive.</param>
 		/// <param name="vertRadius">Vertical radius of the ellipse primitive.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawEllipseFillPrimitive(Vector centerPos, short horizRadius, short vertRadius, unsigned char color) { m_Primitives.push_back(new EllipseFillPrimitive(-1, centerPos, horizRadius, vertRadius, color)); }
+		void DrawEllipseFillPrimitive(Vector centerPos, short horizRadius, short vertRadius, unsigned char color) { SchedulePrimitive<EllipseFillPrimitive>(-1, centerPos, horizRadius, vertRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled ellipse primitive visible only to a specified player.
@@ -269,7 +270,7 @@ namespace RTE {
 		/// <param name="horizRadius">Horizontal radius of the ellipse primitive.</param>
 		/// <param name="vertRadius">Vertical radius of the ellipse primitive.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawEllipseFillPrimitive(short player, Vector centerPos, short horizRadius, short vertRadius, unsigned char color) { m_Primitives.push_back(new EllipseFillPrimitive(player, centerPos, horizRadius, vertRadius, color)); }
+		void DrawEllipseFillPrimitive(short player, Vector centerPos, short horizRadius, short vertRadius, unsigned char color) { SchedulePrimitive<EllipseFillPrimitive>(player, centerPos, horizRadius, vertRadius, color); }
 
 		/// <summary>
 		/// Schedule to draw a triangle primitive.
@@ -278,7 +279,7 @@ namespace RTE {
 		/// <param name="pointB">Position of the second point of the triangle in scene coordinates.</param>
 		/// <param name="pointC">Position of the third point of the triangle in scene coordinates.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawTrianglePrimitive(Vector pointA, Vector pointB, Vector pointC, unsigned char color) { m_Primitives.push_back(new TrianglePrimitive(-1, pointA, pointB, pointC, color)); }
+		void DrawTrianglePrimitive(Vector pointA, Vector pointB, Vector pointC, unsigned char color) { SchedulePrimitive<TrianglePrimitive>(-1, pointA, pointB, pointC, color); }
 
 		/// <summary>
 		/// Schedule to draw a triangle primitive visible only to a specified player.
@@ -288,7 +289,7 @@ namespace RTE {
 		/// <param name="pointB">Position of the second point of the triangle in scene coordinates.</param>
 		/// <param name="pointC">Position of the third point of the triangle in scene coordinates.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawTrianglePrimitive(short player, Vector pointA, Vector pointB, Vector pointC, unsigned char color) { m_Primitives.push_back(new TrianglePrimitive(player, pointA, pointB, pointC, color)); }
+		void DrawTrianglePrimitive(short player, Vector pointA, Vector pointB, Vector pointC, unsigned char color) { SchedulePrimitive<TrianglePrimitive>(player, pointA, pointB, pointC, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled triangle primitive.
@@ -297,7 +298,7 @@ namespace RTE {
 		/// <param name="pointB">Position of the second point of the triangle in scene coordinates.</param>
 		/// <param name="pointC">Position of the third point of the triangle in scene coordinates.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawTriangleFillPrimitive(Vector pointA, Vector pointB, Vector pointC, unsigned char color) { m_Primitives.push_back(new TriangleFillPrimitive(-1, pointA, pointB, pointC, color)); }
+		void DrawTriangleFillPrimitive(Vector pointA, Vector pointB, Vector pointC, unsigned char color) { SchedulePrimitive<TriangleFillPrimitive>(-1, pointA, pointB, pointC, color); }
 
 		/// <summary>
 		/// Schedule to draw a filled triangle primitive visible only to a specified player.
@@ -307,7 +308,7 @@ namespace RTE {
 		/// <param name="pointB">Position of the second point of the triangle in scene coordinates.</param>
 		/// <param name="pointC">Position of the third point of the triangle in scene coordinates.</param>
 		/// <param name="color">Color to fill primitive with.</param>
-		void DrawTriangleFillPrimitive(short player, Vector pointA, Vector pointB, Vector pointC, unsigned char color) { m_Primitives.push_back(new TriangleFillPrimitive(player, pointA, pointB, pointC, color)); }
+		void DrawTriangleFillPrimitive(short player, Vector pointA, Vector pointB, Vector pointC, unsigned char color) { SchedulePrimitive<TriangleFillPrimitive>(player, pointA, pointB, pointC, color); }
 
 		/// <summary>
 		/// Schedule to draw a text primitive.
@@ -316,7 +317,7 @@ namespace RTE {
 		/// <param name="text">Text string to draw.</param>
 		/// <param name="isSmall">Use small or large font. True for small font.</param>
 		/// <param name="alignment">Alignment of text.</param>
-		void DrawTextPrimitive(Vector start, std::string text, bool isSmall, short alignment) { m_Primitives.push_back(new TextPrimitive(-1, start, text, isSmall, alignment)); }
+		void DrawTextPrimitive(Vector start, std::string text, bool isSmall, short alignment) { SchedulePrimitive<TextPrimitive>(-1, start, text, isSmall, alignment); }
 
 		/// <summary>
 		/// Schedule to draw a text primitive visible only to a specified player.
@@ -326,7 +327,7 @@ namespace RTE {
 		/// <param name="text">Text string to draw.</param>
 		/// <param name="isSmall">Use small or large font. True for small font.</param>
 		/// <param name="alignment">Alignment of text.</param>
-		void DrawTextPrimitive(short player, Vector start, std::string text, bool isSmall, short alignment) { m_Primitives.push_back(new TextPrimitive(player, start, text, isSmall, alignment)); }
+		void DrawTextPrimitive(short player, Vector start, std::string text, bool isSmall, short alignment) { SchedulePrimitive<TextPrimitive>(player, start, text, isSmall, alignment); }
 
 		/// <summary>
 		/// Schedule to draw a bitmap primitive.
@@ -382,10 +383,53 @@ namespace RTE {
 	protected:
 
 		static const std::string c_ClassName; //! A string with the friendly-formatted type name of this object.
-		std::list<GraphicalPrimitive *> m_Primitives; //!< List of graphical primitives scheduled to draw this frame, cleared every frame during FrameMan::Draw().
+		std::vector<GraphicalPrimitive *> m_Primitives; //!< List of graphical primitives scheduled to draw this frame, cleared every frame during FrameMan::Draw().
+		std::array<std::vector<GraphicalPrimitive *>, c_MaxScreenCount> m_ScreenPrimitives; //!< The scheduled primitives binned by the player screen they are visible on, in scheduling order. Primitives visible to all players are in every bin.
+		std::array<std::vector<GraphicalPrimitive *>, static_cast<size_t>(GraphicalPrimitive::PrimitiveType::PrimitiveTypeCount)> m_PrimitivePools; //!< Primitives from previous frames that are free to be reused, pooled by PrimitiveType.
+		std::vector<GraphicalPrimitive *> m_PrimitiveBatch; //!< Reusable buffer for gathering a run of same-type primitives to draw in one go.
 
 	private:
 
+		/// <summary>
+		/// Schedules a primitive of the given type to be drawn, reusing a pooled primitive object from previous frames if there's one available.
+		/// </summary>
+		/// <param name="args">The arguments to construct the primitive with.</param>
+		template <typename PrimitiveClass, typename... Args> void SchedulePrimitive(Args &&...args) {
+			std::vector<GraphicalPrimitive *> &primitivePool = m_PrimitivePools[static_cast<size_t>(PrimitiveClass::c_PrimitiveType)];
+			PrimitiveClass *primitive;
+			if (primitivePool.empty()) {
+				primitive = new PrimitiveClass(std::forward<Args>(args)...);
+			} else {
+				primitive = static_cast<PrimitiveClass *>(primitivePool.back());
+				primitivePool.pop_back();
+				*primitive = PrimitiveClass(std::forward<Args>(args)...);
+			}
+			m_Primitives.push_back(primitive);
+
+			if (primitive->m_Player == -1) {
+				for (std::vector<GraphicalPrimitive *> &screenPrimitives : m_ScreenPrimitives) {
+					screenPrimitives.push_back(primitive);
+				}
+			} else if (primitive->m_Player >= 0 && primitive->m_Player < c_MaxScreenCount) {
+				m_ScreenPrimitives[primitive->m_Player].push_back(primitive);
+			}
+		}
+
+		/// <summary>
+		/// Tells whether a primitive intersects a player screen, taking scene wrapping into account.
+		/// </summary>
+		/// <param name="primitive">The primitive to check.</param>
+		/// <param name="screenBox">The area of the scene the player screen covers.</param>
+		/// <returns>Whether the primitive could be visible on the screen.</returns>
+		bool IsPrimitiveOnScreen(const GraphicalPrimitive *primitive, const Box &screenBox) const;
+
+		/// <summary>
+		/// Draws the gathered batch of same-type primitives and clears it.
+		/// </summary>
+		/// <param name="targetBitmap">Bitmap to draw on.</param>
+		/// <param name="targetPos">Position to draw.</param>
+		void FlushPrimitiveBatch(BITMAP *targetBitmap, const Vector &targetPos);
+
 		// Disallow the use of some implicit methods.
 		PrimitiveMan(const PrimitiveMan &reference) = delete;
 		PrimitiveMan & operator=(const PrimitiveMan &rhs) = delete;
@@ -178,13 +178,14 @@ int SceneMan::LoadScene(Scene *pNewScene, bool placeObjects, bool placeUnits) {
 	g_MovableMan.PurgeAllMOs();
 	g_PostProcessMan.ClearScenePostEffects();
 
+	// Lock before the old scene is deleted, the network server may still be reading its terrain
+	g_NetworkServer.LockScene(true);
+
 	if (m_pCurrentScene) {
 		delete m_pCurrentScene;
 		m_pCurrentScene = nullptr;
 	}
 
-	g_NetworkServer.LockScene(true);
-
     m_pCurrentScene = pNewScene;
     if (m_pCurrentScene->LoadData(placeObjects, true, placeUnits) < 0)
     {
@@ -3576,6 +3577,25 @@ void SceneMan::Update(int screen)
 //                  BITMAP of choice.
 
 void SceneMan::Draw(BITMAP *pTargetBitmap, BITMAP *pTargetGUIBitmap, const Vector &targetPos, bool skipSkybox, bool skipTerrain)
+{
+    if (m_pCurrentScene == nullptr) {
+        return;
+    }
+    DrawLayers(pTargetBitmap, skipSkybox, skipTerrain);
+
+    // The HUDs only go over the normally drawn layers
+    if (m_LayerDrawMode != g_LayerTerrainMatter && m_LayerDrawMode != g_LayerMOID)
+        DrawHUD(pTargetGUIBitmap, targetPos);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DrawLayers
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Draws the scene layers of the last updated screen, without any of the
+//                  HUDs and GUIs drawn over them, to a BITMAP of choice.
+
+void SceneMan::DrawLayers(BITMAP *pTargetBitmap, bool skipSkybox, bool skipTerrain, float renderScale)
 {
     if (m_pCurrentScene == nullptr) {
         return;
@@ -3587,17 +3607,21 @@ void SceneMan::Draw(BITMAP *pTargetBitmap, BITMAP *pTargetGUIBitmap, const Vecto
     int team = m_ScreenTeam[m_LastUpdatedScreen];
     SceneLayer *pUnseenLayer = team != Activity::NoTeam ? m_pCurrentScene->GetUnseenLayer(team) : 0;
 
+    // The layers work out what to draw in full resolution view coordinates, so the target box is in those too
+    int viewWidth = renderScale == 1.0F ? pTargetBitmap->w : static_cast<int>(std::ceil(static_cast<float>(pTargetBitmap->w) / renderScale));
+    int viewHeight = renderScale == 1.0F ? pTargetBitmap->h : static_cast<int>(std::ceil(static_cast<float>(pTargetBitmap->h) / renderScale));
+
     // Set up the target box to draw to on the target bitmap, if it is larger than the scene in either dimension
-    Box targetBox(Vector(0, 0), pTargetBitmap->w, pTargetBitmap->h);
+    Box targetBox(Vector(0, 0), viewWidth, viewHeight);
 
-    if (!pTerrain->WrapsX() && pTargetBitmap->w > GetSceneWidth())
+    if (!pTerrain->WrapsX() && viewWidth > GetSceneWidth())
     {
-        targetBox.m_Corner.m_X = (pTargetBitmap->w - GetSceneWidth()) / 2;
+        targetBox.m_Corner.m_X = (viewWidth - GetSceneWidth()) / 2;
         targetBox.m_Width = GetSceneWidth();
     }
-    if (!pTerrain->WrapsY() && pTargetBitmap->h > GetSceneHeight())
+    if (!pTerrain->WrapsY() && viewHeight > GetSceneHeight())
     {
-        targetBox.m_Corner.m_Y = (pTargetBitmap->h - GetSceneHeight()) / 2;
+        targetBox.m_Corner.m_Y = (viewHeight - GetSceneHeight()) / 2;
         targetBox.m_Height = GetSceneHeight();
     }
 
@@ -3605,10 +3629,10 @@ void SceneMan::Draw(BITMAP *pTargetBitmap, BITMAP *pTargetGUIBitmap, const Vecto
     {
         case g_LayerTerrainMatter:
             pTerrain->SetToDrawMaterial(true);
-            pTerrain->Draw(pTargetBitmap, targetBox);
+            pTerrain->Draw(pTargetBitmap, targetBox, Vector(-1, -1), renderScale);
             break;
         case g_LayerMOID:
-            m_pMOIDLayer->Draw(pTargetBitmap, targetBox);
+            m_pMOIDLayer->Draw(pTargetBitmap, targetBox, Vector(-1, -1), renderScale);
             break;
         // Draw normally
         default:
@@ -3620,41 +3644,53 @@ void SceneMan::Draw(BITMAP *pTargetBitmap, BITMAP *pTargetGUIBitmap, const Vecto
 			{
 				// Background Layers
 				for (list<SceneLayer *>::reverse_iterator itr = m_pCurrentScene->GetBackLayers().rbegin(); itr != m_pCurrentScene->GetBackLayers().rend(); ++itr)
-					(*itr)->Draw(pTargetBitmap, targetBox);
+					(*itr)->Draw(pTargetBitmap, targetBox, Vector(-1, -1), renderScale);
 			}
 
 			if (!skipTerrain)
 				// Terrain background
-				pTerrain->DrawBackground(pTargetBitmap, targetBox);
+				pTerrain->DrawBackground(pTargetBitmap, targetBox, Vector(-1, -1), renderScale);
             // Movables' color layer
-            m_pMOColorLayer->Draw(pTargetBitmap, targetBox);
+            m_pMOColorLayer->Draw(pTargetBitmap, targetBox, Vector(-1, -1), renderScale);
             // Terrain foreground
             pTerrain->SetToDrawMaterial(false);
 			if (!skipTerrain)
-				pTerrain->Draw(pTargetBitmap, targetBox);
+				pTerrain->Draw(pTargetBitmap, targetBox, Vector(-1, -1), renderScale);
 
             // Obscure unexplored/unseen areas
             if (pUnseenLayer && !g_FrameMan.IsInMultiplayerMode())
             {
                 // Draw the unseen obstruction layer so it obscures the team's view
-                pUnseenLayer->DrawScaled(pTargetBitmap, targetBox);
+                pUnseenLayer->DrawScaled(pTargetBitmap, targetBox, Vector(-1, -1), renderScale);
             }
 
-            // Actor and gameplay HUDs and GUIs
-            g_MovableMan.DrawHUD(pTargetGUIBitmap, targetPos, m_LastUpdatedScreen);
-			g_PrimitiveMan.DrawPrimitives(m_LastUpdatedScreen, pTargetGUIBitmap, targetPos);
-//            g_ActivityMan.GetActivity()->Draw(pTargetBitmap, targetPos, m_LastUpdatedScreen);
-            g_ActivityMan.GetActivity()->DrawGUI(pTargetGUIBitmap, targetPos, m_LastUpdatedScreen);
-
-//            std::snprintf(str, sizeof(str), "Normal Layer Draw Mode\nHit M to cycle modes");
-
 #ifdef DEBUG_BUILD
-            m_pDebugLayer->Draw(pTargetBitmap, Box());
+            Box debugBox;
+            m_pDebugLayer->Draw(pTargetBitmap, debugBox, Vector(-1, -1), renderScale);
 #endif
     }
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DrawHUD
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Draws the actor and gameplay HUDs, primitives and Activity GUI of the
+//                  last updated screen to a BITMAP of choice.
+
+void SceneMan::DrawHUD(BITMAP *pTargetGUIBitmap, const Vector &targetPos)
+{
+    if (m_pCurrentScene == nullptr) {
+        return;
+    }
+    // Actor and gameplay HUDs and GUIs
+    g_MovableMan.DrawHUD(pTargetGUIBitmap, targetPos, m_LastUpdatedScreen);
+    g_PrimitiveMan.DrawPrimitives(m_LastUpdatedScreen, pTargetGUIBitmap, targetPos);
+//    g_ActivityMan.GetActivity()->Draw(pTargetBitmap, targetPos, m_LastUpdatedScreen);
+    g_ActivityMan.GetActivity()->DrawGUI(pTargetGUIBitmap, targetPos, m_LastUpdatedScreen);
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          ClearMOColorLayer
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -692,6 +692,16 @@ public:
     const Vector & GetScrollTarget(int screen = 0) const { return m_ScrollTarget[screen]; }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetScrollSpeed
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the speed at which a screen is scrolling toward its scroll target.
+// Arguments:       Which screen to get the speed for.
+// Return value:    The normalized scroll speed, as set by SetScrollTarget.
+
+    float GetScrollSpeed(int screen = 0) const { return m_ScrollSpeed[screen]; }
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          TargetDistanceScalar
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -1606,6 +1616,34 @@ public:
     void Draw(BITMAP *pTargetBitmap, BITMAP *pTargetGUIBitmap,  const Vector &targetPos = Vector(), bool skipSkybox = false, bool skipTerrain = false);
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DrawLayers
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Draws the scene layers of the last updated screen, without any of the
+//                  HUDs and GUIs drawn over them, to a BITMAP of choice.
+// Arguments:       A pointer to a BITMAP to draw on.
+//                  Whether to skip the background layers.
+//                  Whether to skip the terrain.
+//                  The fraction of full resolution the target bitmap is drawn at. The
+//                  same area of the scene is drawn regardless, just with fewer pixels.
+// Return value:    None.
+
+    void DrawLayers(BITMAP *pTargetBitmap, bool skipSkybox = false, bool skipTerrain = false, float renderScale = 1.0F);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          DrawHUD
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Draws the actor and gameplay HUDs, primitives and Activity GUI of the
+//                  last updated screen to a BITMAP of choice.
+// Arguments:       A pointer to a BITMAP to draw on, at full resolution.
+//                  The offset into the scene where the target bitmap's upper left corner
+//                  is located.
+// Return value:    None.
+
+    void DrawHUD(BITMAP *pTargetGUIBitmap, const Vector &targetPos = Vector());
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          ClearMOColorLayer
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,13 @@ namespace RTE {
 		m_ServerTransmitAsBoxes = true;
 		m_ServerBoxWidth = 32;
 		m_ServerBoxHeight = 44;
+		m_ServerUseDeltaCompression = true;
+		m_ServerKeyFrameInterval = 90;
+		m_ServerReplicateEntities = false;
+		m_ServerUseAdaptiveBitrate = true;
+		m_ServerTargetBandwidth = 8000;
+		m_ServerTargetLatency = 150;
+		m_ServerSendInputOverlays = true;
 		m_ServerUseHighCompression = true;
 		m_ServerUseFastCompression = false;
 		m_ServerHighCompressionLevel = 10;
@@ -66,6 +73,9 @@ namespace RTE {
 		m_ToolTips = true;
 		m_DisableLoadingScreen = true;
 		m_LoadingScreenReportPrecision = 100;
+		m_UsePresetCache = true;
+		m_LoadSoundsOnDemand = false;
+		m_ProfileLoading = false;
 		m_MenuTransitionDurationMultiplier = 1.0F;
 		m_PrintDebugInfo = false;
 	}
@@ -113,6 +123,12 @@ namespace RTE {
 			g_FrameMan.ReadProperty(propName, reader);
 		} else if (propName == "VSplitScreen") {
 			g_FrameMan.ReadProperty(propName, reader);
+		} else if (propName == "DynamicResolution") {
+			g_FrameMan.ReadProperty(propName, reader);
+		} else if (propName == "DynamicResolutionTargetFPS") {
+			g_FrameMan.ReadProperty(propName, reader);
+		} else if (propName == "DynamicResolutionMinScale") {
+			g_FrameMan.ReadProperty(propName, reader);
 		} else if (propName == "ForceVirtualFullScreenGfxDriver") {
 			reader >> m_ForceVirtualFullScreenGfxDriver;
 		} else if (propName == "ForceOverlayedWindowGfxDriver") {
@@ -191,6 +207,12 @@ namespace RTE {
 			reader >> m_DisableLoadingScreen;
 		} else if (propName == "LoadingScreenReportPrecision") {
 			reader >> m_LoadingScreenReportPrecision;
+		} else if (propName == "UsePresetCache") {
+			reader >> m_UsePresetCache;
+		} else if (propName == "LoadSoundsOnDemand") {
+			reader >> m_LoadSoundsOnDemand;
+		} else if (propName == "ProfileLoading") {
+			reader >> m_ProfileLoading;
 		} else if (propName == "ConsoleScreenRatio") {
 			g_ConsoleMan.SetConsoleScreenSize(std::stof(reader.ReadPropValue()));
 		} else if (propName == "AdvancedPerformanceStats") {
@@ -219,6 +241,20 @@ namespace RTE {
 			reader >> m_ServerBoxWidth;
 		} else if (propName == "ServerBoxHeight") {
 			reader >> m_ServerBoxHeight;
+		} else if (propName == "ServerUseDeltaCompression") {
+			reader >> m_ServerUseDeltaCompression;
+		} else if (propName == "ServerKeyFrameInterval") {
+			reader >> m_ServerKeyFrameInterval;
+		} else if (propName == "ServerReplicateEntities") {
+			reader >> m_ServerReplicateEntities;
+		} else if (propName == "ServerUseAdaptiveBitrate") {
+			reader >> m_ServerUseAdaptiveBitrate;
+		} else if (propName == "ServerTargetBandwidth") {
+			reader >> m_ServerTargetBandwidth;
+		} else if (propName == "ServerTargetLatency") {
+			reader >> m_ServerTargetLatency;
+		} else if (propName == "ServerSendInputOverlays") {
+			reader >> m_ServerSendInputOverlays;
 		} else if (propName == "ServerUseHighCompression") {
 			reader >> m_ServerUseHighCompression;
 		} else if (propName == "ServerUseFastCompression") {
@@ -273,6 +309,12 @@ namespace RTE {
 		writer << g_FrameMan.GetHSplit();
 		writer.NewProperty("VSplitScreen");
 		writer << g_FrameMan.GetVSplit();
+		writer.NewProperty("DynamicResolution");
+		writer << g_FrameMan.IsDynamicResolutionEnabled();
+		writer.NewProperty("DynamicResolutionTargetFPS");
+		writer << g_FrameMan.GetDynamicResolutionTargetFPS();
+		writer.NewProperty("DynamicResolutionMinScale");
+		writer << g_FrameMan.GetDynamicResolutionMinScale();
 		writer.NewProperty("ForceVirtualFullScreenGfxDriver");
 		writer << m_ForceVirtualFullScreenGfxDriver;
 		writer.NewProperty("ForceOverlayedWindowGfxDriver");
@@ -379,6 +421,12 @@ namespace RTE {
 		writer << m_DisableLoadingScreen;
 		writer.NewProperty("LoadingScreenReportPrecision");
 		writer << m_LoadingScreenReportPrecision;
+		writer.NewProperty("UsePresetCache");
+		writer << m_UsePresetCache;
+		writer.NewProperty("LoadSoundsOnDemand");
+		writer << m_LoadSoundsOnDemand;
+		writer.NewProperty("ProfileLoading");
+		writer << m_ProfileLoading;
 		writer.NewProperty("ConsoleScreenRatio");
 		writer << g_ConsoleMan.GetConsoleScreenSize();
 		writer.NewProperty("AdvancedPerformanceStats");
@@ -417,6 +465,20 @@ namespace RTE {
 		writer << m_ServerBoxWidth;
 		writer.NewProperty("ServerBoxHeight");
 		writer << m_ServerBoxHeight;
+		writer.NewProperty("ServerUseDeltaCompression");
+		writer << m_ServerUseDeltaCompression;
+		writer.NewProperty("ServerKeyFrameInterval");
+		writer << m_ServerKeyFrameInterval;
+		writer.NewProperty("ServerReplicateEntities");
+		writer << m_ServerReplicateEntities;
+		writer.NewProperty("ServerUseAdaptiveBitrate");
+		writer << m_ServerUseAdaptiveBitrate;
+		writer.NewProperty("ServerTargetBandwidth");
+		writer << m_ServerTargetBandwidth;
+		writer.NewProperty("ServerTargetLatency");
+		writer << m_ServerTargetLatency;
+		writer.NewProperty("ServerSendInputOverlays");
+		writer << m_ServerSendInputOverlays;
 		writer.NewProperty("ServerUseHighCompression");
 		writer << m_ServerUseHighCompression;
 		writer.NewProperty("ServerUseFastCompression");
@@ -314,6 +314,48 @@ namespace RTE {
 		/// <returns>The height of the transmitted block.</returns>
 		unsigned short GetServerBoxHeight() const { return m_ServerBoxHeight; }
 
+		/// <summary>
+		/// Gets whether the server skips unchanged blocks and sends changed ones as deltas when transmitting frames as blocks.
+		/// </summary>
+		/// <returns>Whether the server uses delta compression for transmitted blocks or not.</returns>
+		bool GetServerUseDeltaCompression() const { return m_ServerUseDeltaCompression; }
+
+		/// <summary>
+		/// Gets how many frames pass between full refreshes of all blocks when delta compression is used.
+		/// </summary>
+		/// <returns>The number of frames between full refreshes.</returns>
+		unsigned short GetServerKeyFrameInterval() const { return m_ServerKeyFrameInterval; }
+
+		/// <summary>
+		/// Gets whether the server replicates entity states for clients to draw locally instead of streaming the rendered scene.
+		/// </summary>
+		/// <returns>Whether the server replicates entity states or not.</returns>
+		bool GetServerReplicateEntities() const { return m_ServerReplicateEntities; }
+
+		/// <summary>
+		/// Gets whether the server continuously adjusts each client's frame rate, interlacing, compression and block size to hit the target bandwidth and latency.
+		/// </summary>
+		/// <returns>Whether the server adapts each client's stream settings or not.</returns>
+		bool GetServerUseAdaptiveBitrate() const { return m_ServerUseAdaptiveBitrate; }
+
+		/// <summary>
+		/// Gets the bandwidth the server aims to stay under for each client when adapting stream settings.
+		/// </summary>
+		/// <returns>The target bandwidth in kbit per second.</returns>
+		int GetServerTargetBandwidth() const { return m_ServerTargetBandwidth; }
+
+		/// <summary>
+		/// Gets the latency the server aims to stay under for each client when adapting stream settings.
+		/// </summary>
+		/// <returns>The target latency in milliseconds.</returns>
+		int GetServerTargetLatency() const { return m_ServerTargetLatency; }
+
+		/// <summary>
+		/// Gets whether the server lets clients draw their aim reticle and pie menu cursor themselves from their own input, instead of streaming them with the rest of the GUI layer.
+		/// </summary>
+		/// <returns>Whether the server sends input overlay state to clients or not.</returns>
+		bool GetServerSendInputOverlays() const { return m_ServerSendInputOverlays; }
+
 		/// <summary>
 		/// Gets whether a NAT service is used for punch-through.
 		/// </summary>
@@ -450,6 +492,24 @@ namespace RTE {
 		/// <returns>How accurately the reader progress report tells what line it's reading during module loading.</returns>
 		unsigned short LoadingScreenReportPrecision() const { return m_LoadingScreenReportPrecision; }
 
+		/// <summary>
+		/// Gets whether DataModules are loaded from and saved to binary preset caches, so unchanged ones don't have their .ini files parsed again on every launch.
+		/// </summary>
+		/// <returns>Whether preset caches are used.</returns>
+		bool UsePresetCache() const { return m_UsePresetCache; }
+
+		/// <summary>
+		/// Gets whether the sounds of presets are only loaded into FMOD the first time they're played, instead of all of them being loaded along with the DataModules.
+		/// </summary>
+		/// <returns>Whether sounds are loaded on demand.</returns>
+		bool LoadSoundsOnDemand() const { return m_LoadSoundsOnDemand; }
+
+		/// <summary>
+		/// Gets whether loading the DataModules is profiled, writing a report of where the loading time went once it's done.
+		/// </summary>
+		/// <returns>Whether loading is profiled.</returns>
+		bool ProfileLoading() const { return m_ProfileLoading; }
+
 		/// <summary>
 		/// Gets the multiplier value for the transition durations between different menus.
 		/// </summary>
@@ -526,6 +586,13 @@ namespace RTE {
 		bool m_ServerTransmitAsBoxes;
 		unsigned short m_ServerBoxWidth; //!< Width of the transmitted CPU block. Different values may improve bandwidth usage.
 		unsigned short m_ServerBoxHeight; //!< Height of the transmitted CPU block. Different values may improve bandwidth usage.
+		bool m_ServerUseDeltaCompression; //!< Skip blocks that didn't change since they were last sent and send changed blocks as deltas against what the client already has.
+		unsigned short m_ServerKeyFrameInterval; //!< Number of frames between full refreshes of all blocks, which correct blocks left stale by lost packets when delta compression is used.
+		bool m_ServerReplicateEntities; //!< Send the states of objects in each client's view for the client to draw from its own loaded data instead of streaming the rendered scene. The GUI layer is still streamed.
+		bool m_ServerUseAdaptiveBitrate; //!< Continuously adjust each client's frame rate, interlacing, compression and block size to its connection instead of freezing frames when the connection can't keep up.
+		int m_ServerTargetBandwidth; //!< Bandwidth in kbit per second the server aims to stay under for each client when adapting stream settings.
+		int m_ServerTargetLatency; //!< Latency in milliseconds the server aims to stay under for each client when adapting stream settings.
+		bool m_ServerSendInputOverlays; //!< Send the state of input-driven overlays so clients can draw their aim reticle and pie menu cursor from their own input without waiting for a round trip.
 
 		bool m_AllowSavingToBase; //!< Whether editors will allow to select Base.rte as a module to save in.
 		bool m_ShowMetaScenes; //!< Show MetaScenes in editors and activities.
@@ -539,6 +606,9 @@ namespace RTE {
 		bool m_ToolTips; //!< Whether ToolTips are enabled or not.
 		bool m_DisableLoadingScreen; //!< Whether to display the reader progress report during module loading or not. Greatly increases loading speeds when disabled.
 		unsigned short m_LoadingScreenReportPrecision; //!< How accurately the reader progress report tells what line it's reading during module loading. Lower values equal more precision at the cost of loading speed.
+		bool m_UsePresetCache; //!< Whether DataModules are loaded from and saved to binary preset caches.
+		bool m_LoadSoundsOnDemand; //!< Whether the sounds of presets are only loaded the first time they're played.
+		bool m_ProfileLoading; //!< Whether loading the DataModules is profiled.
 		float m_MenuTransitionDurationMultiplier; //!< Multiplier value for the transition durations between different menus. Lower values equal faster transitions.
 		bool m_PrintDebugInfo; //!< Print some debug info in console.
 
@@ -110,7 +110,8 @@ namespace RTE {
 		if (Serializable::Create() < 0) {
 			return -1;
 		}
-		if (install_keyboard() != 0) { RTEAbort("Failed to initialize keyboard!"); }
+		// Without a window there may be no keyboard to hook into, which is fine when nobody is playing locally
+		if (install_keyboard() != 0 && !g_FrameMan.IsHeadless()) { RTEAbort("Failed to initialize keyboard!"); }
 		if (install_joystick(JOY_TYPE_AUTODETECT) != 0) { RTEAbort("Failed to initialize joysticks!"); }
 
 		poll_joystick();
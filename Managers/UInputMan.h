@@ -661,6 +661,26 @@ namespace RTE {
 		/// <param name="input">The new position of the mouse.</param>
 		void SetNetworkMouseMovement(short player, Vector input) { m_NetworkAccumulatedRawMouseMovement[player] = input; }
 
+		/// <summary>
+		/// Gets the mouse movement accumulated for a player during network multiplayer, without resetting it like GetNetworkAccumulatedRawMouseMovement does.
+		/// </summary>
+		/// <param name="player">The player to get for.</param>
+		/// <returns>The mouse movement accumulated since it was last taken.</returns>
+		const Vector & PeekNetworkAccumulatedRawMouseMovement(short player) const { return m_NetworkAccumulatedRawMouseMovement[player]; }
+
+		/// <summary>
+		/// Gets the analog mouse emulation data of a player during network multiplayer, i.e. the trapped mouse position that aiming and the pie menu are driven by.
+		/// </summary>
+		/// <param name="player">The player to get for.</param>
+		/// <returns>The analog mouse data, within the mouse trap radius.</returns>
+		const Vector & GetNetworkAnalogMoveData(short player) const { return m_NetworkAnalogMoveData[player]; }
+
+		/// <summary>
+		/// Gets the radius of the circle trapping the mouse for analog mouse data.
+		/// </summary>
+		/// <returns>The mouse trap radius in pixels.</returns>
+		float GetMouseTrapRadius() const { return m_MouseTrapRadius; }
+
 		/// <summary>
 		/// Sets whether an input element is held by a player during network multiplayer.
 		/// </summary>
@@ -136,6 +136,8 @@ int BuyMenuGUI::Create(Controller *pController)
         RTEAbort("Failed to create GUI Control Manager and load it from Base.rte/GUIs/Skins/Base");
     m_pGUIController->Load("Base.rte/GUIs/BuyMenuGUI.ini");
     m_pGUIController->EnableMouse(pController->IsMouseControlled());
+    // Large item lists make redrawing every control each frame expensive, so only recomposite what changed
+    m_pGUIController->EnableCompositing();
 
     if (!s_pCursor)
     {
@@ -2,6 +2,7 @@
 #include "System.h"
 #include "Writer.h"
 #include "DataModule.h"
+#include "LoadProfiler.h"
 #include "SceneLayer.h"
 #include "SettingsMan.h"
 #include "PresetMan.h"
@@ -141,10 +142,13 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	bool LoadingGUI::LoadDataModules() {
+		if (g_SettingsMan.ProfileLoading() && !LoadProfiler::IsProfiling()) { LoadProfiler::Start(); }
 		g_PresetMan.Destroy();
 		g_PresetMan.Create();
 		ExtractZippedModules();
 		g_PresetMan.LoadAllDataModules();
+		LoadingSplashProgressReport(ContentFile::GetBitmapSharingReport(), true);
+		if (LoadProfiler::IsProfiling()) { LoadingSplashProgressReport(LoadProfiler::Finish(), true); }
 
 		return true;
 	}
@@ -107,6 +107,8 @@ int ObjectPickerGUI::Create(Controller *pController, int whichModuleSpace, strin
         RTEAbort("Failed to create GUI Control Manager and load it from Base.rte/GUIs/Skins/Base");
     m_pGUIController->Load("Base.rte/GUIs/ObjectPickerGUI.ini");
     m_pGUIController->EnableMouse(pController->IsMouseControlled());
+    // Large item lists make redrawing every control each frame expensive, so only recomposite what changed
+    m_pGUIController->EnableCompositing();
 
     if (!s_pCursor)
     {
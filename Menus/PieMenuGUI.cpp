@@ -17,6 +17,7 @@
 #include "PresetMan.h"
 #include "ActivityMan.h"
 #include "UInputMan.h"
+#include "NetworkServer.h"
 
 #include "Controller.h"
 #include "SceneObject.h"
@@ -1357,8 +1358,8 @@ void PieMenuGUI::Draw(BITMAP *pTargetBitmap, const Vector &targetPos) const
             }
         }
 
-        // Draw the cursor arrow
-        if (m_EnoughInput)
+        // Draw the cursor arrow, unless a network client is drawing it itself so it follows the mouse without waiting for the server
+        if (m_EnoughInput && !(g_FrameMan.IsInMultiplayerMode() && g_NetworkServer.IsInputOverlayDrawnByClient(m_pController->GetPlayer())))
         {
             Vector cursorPos(m_InnerRadius/* - s_pCursor->w*/, 0);
             cursorPos.RadRotate(m_CursorAng);
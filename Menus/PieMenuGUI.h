@@ -434,6 +434,58 @@ public:
     bool IsVisible() const { return m_PieEnabled != DISABLED; }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          IsFullyEnabled
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Reports whether the menu is done animating in, so its slices and
+//                  cursor are drawn.
+// Arguments:       None.
+// Return value:    Whether the menu is fully enabled.
+
+    bool IsFullyEnabled() const { return m_PieEnabled == ENABLED; }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          IsCursorPointing
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Reports whether there was enough input to point the cursor in a
+//                  direction on the last update, i.e. whether the cursor is drawn.
+// Arguments:       None.
+// Return value:    Whether the cursor is pointing.
+
+    bool IsCursorPointing() const { return m_EnoughInput; }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetCursorAngle
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the angle the cursor is pointing at.
+// Arguments:       None.
+// Return value:    The cursor angle in radians, between 0 and 2 PI.
+
+    float GetCursorAngle() const { return m_CursorAng; }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetInnerRadius
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the radius of the inner edge of the slice ring.
+// Arguments:       None.
+// Return value:    The inner radius in pixels.
+
+    int GetInnerRadius() const { return m_InnerRadius; }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Method:          GetThickness
+//////////////////////////////////////////////////////////////////////////////////////////
+// Description:     Gets the thickness of the slice ring.
+// Arguments:       None.
+// Return value:    The thickness in pixels.
+
+    int GetThickness() const { return m_Thickness; }
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // Method:          GetPos
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,535 @@
+/// <summary>
+/// Headless load test client for the multiplayer server.
+/// Connects a number of simulated players to a running server, feeds them scripted input and decodes the frames they're sent the same way the game client does, without creating a window or touching Allegro.
+/// Reports per-client frame rate, decode time, bandwidth and frame delivery time, so changes to frame encoding and compression settings can be benchmarked on a single machine.
+/// </summary>
+
+#include "Constants.h"
+#include "NetworkMessages.h"
+#include "NetworkFrameDecoding.h"
+
+#include "RakPeerInterface.h"
+#include "RakSleep.h"
+
+#include <chrono>
+#include <memory>
+
+namespace RTE {
+
+	typedef std::chrono::steady_clock LoadTestClock;
+
+	/// <summary>
+	/// The names input elements go by in input scripts, in InputElements order.
+	/// </summary>
+	static const std::array<const char *, INPUT_COUNT> c_InputElementNames = {
+		"L_UP", "L_DOWN", "L_LEFT", "L_RIGHT", "R_UP", "R_DOWN", "R_LEFT", "R_RIGHT",
+		"FIRE", "AIM", "AIM_UP", "AIM_DOWN", "AIM_LEFT", "AIM_RIGHT", "PIEMENU", "JUMP", "CROUCH",
+		"NEXT", "PREV", "START", "BACK", "WEAPON_CHANGE_NEXT", "WEAPON_CHANGE_PREV", "WEAPON_PICKUP", "WEAPON_DROP", "WEAPON_RELOAD"
+	};
+
+	/// <summary>
+	/// A step of an input script. The input is held for the duration of the step.
+	/// </summary>
+	struct InputScriptStep {
+		int Duration = 0; //!< How long the step lasts, in ms.
+		unsigned int InputElementHeld = 0; //!< Bit flags of the input elements held during the step.
+		bool MouseButtonHeld[MAX_MOUSE_BUTTONS] = { false, false, false }; //!< The mouse buttons held during the step.
+		int MouseX = 0; //!< Horizontal mouse movement sent with each input message during the step.
+		int MouseY = 0; //!< Vertical mouse movement sent with each input message during the step.
+	};
+
+	/// <summary>
+	/// Running measurements of a simulated client, reset every time they're reported.
+	/// </summary>
+	struct LoadTestStats {
+		int Frames = 0; //!< Number of frames completed.
+		long long BytesReceived = 0; //!< Number of bytes of messages received.
+		double DecodeMsec = 0; //!< Time spent decoding frame lines and boxes, in ms.
+		double FrameDeliveryMsec = 0; //!< Time between receiving each completed frame's setup and its last line or box, in ms.
+		int DroppedBoxes = 0; //!< Number of boxes dropped because a newer version of them arrived first, or the content they were made against as a delta never arrived.
+	};
+
+	/// <summary>
+	/// A simulated player connected to the server, speaking the same protocol as NetworkClient but decoding frames into plain pixel buffers.
+	/// </summary>
+	class LoadTestClient {
+
+	public:
+
+		/// <summary>
+		/// Constructor method used to instantiate a LoadTestClient object in system memory.
+		/// </summary>
+		/// <param name="index">The index of this client among the simulated ones.</param>
+		/// <param name="resX">The horizontal resolution to register with.</param>
+		/// <param name="resY">The vertical resolution to register with.</param>
+		/// <param name="inputScript">The input script to send. It's looped for as long as the client is connected.</param>
+		LoadTestClient(int index, int resX, int resY, const std::vector<InputScriptStep> &inputScript) : m_Index(index), m_ResX(resX), m_ResY(resY), m_InputScript(inputScript) {
+			for (int layer = 0; layer < 2; layer++) {
+				m_FrameBuffer[layer].resize(resX * resY, g_MaskColor);
+				m_FrameLines[layer].resize(resY);
+				for (int line = 0; line < resY; line++) {
+					m_FrameLines[layer][line] = m_FrameBuffer[layer].data() + line * resX;
+				}
+			}
+			m_Peer = RakNet::RakPeerInterface::GetInstance();
+		}
+
+		/// <summary>
+		/// Destructor method used to clean up a LoadTestClient object before deletion from system memory.
+		/// </summary>
+		~LoadTestClient() {
+			if (m_IsRegistered) { SendIdOnlyMsg(ID_CLT_DISCONNECT); }
+			m_Peer->Shutdown(300);
+			RakNet::RakPeerInterface::DestroyInstance(m_Peer);
+		}
+
+		/// <summary>
+		/// Starts connecting to the server.
+		/// </summary>
+		/// <param name="serverName">The address of the server.</param>
+		/// <param name="serverPort">The port of the server.</param>
+		/// <returns>Whether the connection attempt was started.</returns>
+		bool Connect(const std::string &serverName, unsigned short serverPort) {
+			RakNet::SocketDescriptor socketDescriptor;
+			socketDescriptor.socketFamily = AF_INET;
+			m_Peer->Startup(8, &socketDescriptor, 1);
+			m_Peer->SetOccasionalPing(true);
+			return m_Peer->Connect(serverName.c_str(), serverPort, nullptr, 0) == RakNet::CONNECTION_ATTEMPT_STARTED;
+		}
+
+		/// <summary>
+		/// Handles all received messages and sends input when it's due.
+		/// </summary>
+		/// <param name="inputFps">How many input messages to send per second.</param>
+		void Update(int inputFps) {
+			for (RakNet::Packet *packet = m_Peer->Receive(); packet; m_Peer->DeallocatePacket(packet), packet = m_Peer->Receive()) {
+				HandlePacket(packet);
+			}
+
+			LoadTestClock::time_point now = LoadTestClock::now();
+			if (m_IsRegistered && now - m_LastInputSentTime >= std::chrono::microseconds(1000000 / std::max(inputFps, 1))) {
+				m_LastInputSentTime = now;
+				SendInputMsg(now);
+			}
+		}
+
+		/// <summary>
+		/// Gets the measurements made since they were last taken and resets them.
+		/// </summary>
+		/// <returns>The measurements made since they were last taken.</returns>
+		LoadTestStats TakeStats() {
+			LoadTestStats stats = m_Stats;
+			m_Stats = LoadTestStats();
+			return stats;
+		}
+
+		/// <summary>
+		/// Gets the last measured round trip time to the server.
+		/// </summary>
+		/// <returns>The round trip time in ms, or -1 if not connected.</returns>
+		int GetPing() const { return m_IsConnected ? m_Peer->GetLastPing(m_ServerGUID) : -1; }
+
+		/// <summary>
+		/// Gets whether this client was accepted by the server.
+		/// </summary>
+		/// <returns>Whether this client was accepted by the server.</returns>
+		bool IsRegistered() const { return m_IsRegistered; }
+
+		/// <summary>
+		/// Gets whether the server is currently sending this client a scene instead of frames.
+		/// </summary>
+		/// <returns>Whether a scene is being received.</returns>
+		bool IsReceivingScene() const { return m_IsReceivingScene; }
+
+	private:
+
+		int m_Index; //!< The index of this client among the simulated ones.
+		int m_ResX; //!< The horizontal resolution this client registers with.
+		int m_ResY; //!< The vertical resolution this client registers with.
+		std::vector<InputScriptStep> m_InputScript; //!< The input script this client sends.
+
+		RakNet::RakPeerInterface *m_Peer = nullptr; //!< The connection to the server.
+		RakNet::RakNetGUID m_ServerGUID; //!< The GUID of the server connection.
+		bool m_IsConnected = false; //!< Whether the connection to the server is established.
+		bool m_IsRegistered = false; //!< Whether the server accepted this client.
+		bool m_IsReceivingScene = false; //!< Whether the server is sending a scene.
+
+		std::vector<unsigned char> m_FrameBuffer[2]; //!< The pixels of the scene and GUI layers frames are decoded into.
+		std::vector<unsigned char *> m_FrameLines[2]; //!< Pointers to the start of each line of the frame buffers.
+		ReceivedBoxFrameNumbers m_ReceivedBoxFrameNumbers[2]; //!< The frame number of the content each received box of each layer currently holds, keyed by box position.
+
+		bool m_FrameSetupReceived = false; //!< Whether a frame is being received.
+		LoadTestClock::time_point m_FrameSetupTime; //!< When the setup of the frame being received arrived.
+		LoadTestClock::time_point m_LastFrameDataTime; //!< When the last line or box of the frame being received arrived.
+
+		LoadTestClock::time_point m_StartTime = LoadTestClock::now(); //!< When this client was created. The input script is played relative to it.
+		LoadTestClock::time_point m_LastInputSentTime; //!< When input was last sent.
+		unsigned int m_InputSequence = 0; //!< The sequence number of the last sent input message.
+		unsigned int m_PreviousInputElementHeld = 0; //!< The input elements held in the last sent input message, to derive presses and releases from.
+		bool m_PreviousMouseButtonHeld[MAX_MOUSE_BUTTONS] = { false, false, false }; //!< The mouse buttons held in the last sent input message.
+
+		LoadTestStats m_Stats; //!< The measurements made since they were last taken.
+
+		/// <summary>
+		/// Handles a received message.
+		/// </summary>
+		/// <param name="packet">The received message.</param>
+		void HandlePacket(RakNet::Packet *packet) {
+			m_Stats.BytesReceived += packet->length;
+
+			unsigned char packetId = packet->data[0];
+			if (packetId == ID_TIMESTAMP && packet->length > sizeof(RakNet::MessageID) + sizeof(RakNet::Time)) { packetId = packet->data[sizeof(RakNet::MessageID) + sizeof(RakNet::Time)]; }
+
+			switch (packetId) {
+				case ID_CONNECTION_REQUEST_ACCEPTED: {
+					m_ServerGUID = packet->guid;
+					m_IsConnected = true;
+					// The server is the only connection, so set the timeout for all of them. A default constructed SystemAddress is UNASSIGNED_SYSTEM_ADDRESS, and unlike a copy doesn't trip -Wdeprecated-copy
+					m_Peer->SetTimeoutTime(5000, RakNet::SystemAddress());
+
+					MsgRegister msg;
+					msg.Id = ID_CLT_REGISTER;
+					msg.ResolutionX = m_ResX;
+					msg.ResolutionY = m_ResY;
+					std::snprintf(msg.Name, sizeof(msg.Name), "LoadTest %d", m_Index + 1);
+					m_Peer->Send((const char *)&msg, sizeof(msg), HIGH_PRIORITY, RELIABLE_ORDERED, 0, m_ServerGUID, false);
+					break;
+				}
+				case ID_CONNECTION_ATTEMPT_FAILED:
+				case ID_NO_FREE_INCOMING_CONNECTIONS:
+				case ID_DISCONNECTION_NOTIFICATION:
+				case ID_CONNECTION_LOST:
+					std::printf("Client %d: Connection closed or refused (message %d)\n", m_Index + 1, packetId);
+					m_IsConnected = false;
+					m_IsRegistered = false;
+					break;
+				case ID_SRV_ACCEPTED:
+					m_IsRegistered = true;
+					break;
+				case ID_SRV_SCENE_SETUP:
+					m_IsReceivingScene = true;
+					m_FrameSetupReceived = false;
+					for (int layer = 0; layer < 2; layer++) {
+						m_ReceivedBoxFrameNumbers[layer].clear();
+					}
+					SendIdOnlyMsg(ID_CLT_SCENE_SETUP_ACCEPTED);
+					break;
+				case ID_SRV_SCENE_END:
+					m_IsReceivingScene = false;
+					SendIdOnlyMsg(ID_CLT_SCENE_ACCEPTED);
+					break;
+				case ID_SRV_FRAME_SETUP:
+					// A new frame starting means everything of the previous one arrived
+					if (m_FrameSetupReceived) {
+						m_Stats.Frames++;
+						m_Stats.FrameDeliveryMsec += std::chrono::duration<double, std::milli>(m_LastFrameDataTime - m_FrameSetupTime).count();
+					}
+					m_FrameSetupReceived = true;
+					m_FrameSetupTime = LoadTestClock::now();
+					m_LastFrameDataTime = m_FrameSetupTime;
+					break;
+				case ID_SRV_FRAME_LINE:
+					ReceiveFrameLineMsg(packet);
+					break;
+				case ID_SRV_FRAME_BOX:
+					ReceiveFrameBoxMsg(packet);
+					break;
+				default:
+					// Scene, terrain, post effect, sound and entity messages only count towards the received bytes
+					break;
+			}
+		}
+
+		/// <summary>
+		/// Validates and decodes a frame line message.
+		/// </summary>
+		/// <param name="packet">The frame line message.</param>
+		void ReceiveFrameLineMsg(const RakNet::Packet *packet) {
+			const MsgFrameLine *frameData = (MsgFrameLine *)packet->data;
+			if (!IsFrameLineValid(frameData, packet->length, m_ResY)) {
+				return;
+			}
+			LoadTestClock::time_point decodeStart = LoadTestClock::now();
+			DecodeFrameLine(frameData, m_FrameLines[frameData->Layer].data(), m_ResX, m_ResY);
+			m_LastFrameDataTime = LoadTestClock::now();
+			m_Stats.DecodeMsec += std::chrono::duration<double, std::milli>(m_LastFrameDataTime - decodeStart).count();
+		}
+
+		/// <summary>
+		/// Validates and decodes a frame box message.
+		/// </summary>
+		/// <param name="packet">The frame box message.</param>
+		void ReceiveFrameBoxMsg(const RakNet::Packet *packet) {
+			const MsgFrameBox *frameData = (MsgFrameBox *)packet->data;
+			FrameBoxValidation validation = ValidateFrameBox(frameData, packet->length, m_ResX, m_ResY, m_ReceivedBoxFrameNumbers);
+			if (validation != FrameBoxValidation::Accepted) {
+				if (validation != FrameBoxValidation::Malformed) { m_Stats.DroppedBoxes++; }
+				return;
+			}
+
+			LoadTestClock::time_point decodeStart = LoadTestClock::now();
+			DecodeFrameBox(frameData, m_FrameLines[frameData->Layer].data());
+			m_LastFrameDataTime = LoadTestClock::now();
+			m_Stats.DecodeMsec += std::chrono::duration<double, std::milli>(m_LastFrameDataTime - decodeStart).count();
+		}
+
+		/// <summary>
+		/// Sends the input of the current input script step.
+		/// </summary>
+		/// <param name="now">The current time.</param>
+		void SendInputMsg(LoadTestClock::time_point now) {
+			MsgInput msg;
+			msg.Id = ID_CLT_INPUT;
+			msg.InputSequence = ++m_InputSequence;
+
+			const InputScriptStep &step = GetInputScriptStep(now);
+			msg.MouseX = step.MouseX;
+			msg.MouseY = step.MouseY;
+			msg.MouseWheelMoved = 0;
+			msg.ResetActivityVote = false;
+
+			for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) {
+				msg.MouseButtonHeld[i] = step.MouseButtonHeld[i];
+				msg.MouseButtonPressed[i] = step.MouseButtonHeld[i] && !m_PreviousMouseButtonHeld[i];
+				msg.MouseButtonReleased[i] = !step.MouseButtonHeld[i] && m_PreviousMouseButtonHeld[i];
+				m_PreviousMouseButtonHeld[i] = step.MouseButtonHeld[i];
+			}
+
+			msg.InputElementHeld = step.InputElementHeld;
+			msg.InputElementPressed = step.InputElementHeld & ~m_PreviousInputElementHeld;
+			msg.InputElementReleased = ~step.InputElementHeld & m_PreviousInputElementHeld;
+			m_PreviousInputElementHeld = step.InputElementHeld;
+
+			m_Peer->Send((const char *)&msg, sizeof(msg), IMMEDIATE_PRIORITY, RELIABLE_ORDERED, 0, m_ServerGUID, false);
+		}
+
+		/// <summary>
+		/// Finds the input script step to play at the specified time. Each client starts at a different point of the script so they don't all act in lockstep.
+		/// </summary>
+		/// <param name="now">The time to find the step for.</param>
+		/// <returns>The input script step to play.</returns>
+		const InputScriptStep & GetInputScriptStep(LoadTestClock::time_point now) const {
+			long long scriptDuration = 0;
+			for (const InputScriptStep &step : m_InputScript) {
+				scriptDuration += step.Duration;
+			}
+			long long scriptTime = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_StartTime).count() + m_Index * 700;
+			if (scriptDuration > 0) { scriptTime %= scriptDuration; }
+
+			for (const InputScriptStep &step : m_InputScript) {
+				if (scriptTime < step.Duration) {
+					return step;
+				}
+				scriptTime -= step.Duration;
+			}
+			return m_InputScript.back();
+		}
+
+		/// <summary>
+		/// Sends a message that has nothing but its ID to the server.
+		/// </summary>
+		/// <param name="messageId">The ID of the message to send.</param>
+		void SendIdOnlyMsg(unsigned char messageId) {
+			// The game client sends these as register sized messages, so do the same
+			MsgRegister msg;
+			msg.Id = messageId;
+			m_Peer->Send((const char *)&msg, sizeof(msg), HIGH_PRIORITY, RELIABLE_ORDERED, 0, m_ServerGUID, false);
+		}
+
+		// Disallow the use of some implicit methods.
+		LoadTestClient(const LoadTestClient &reference) = delete;
+		LoadTestClient & operator=(const LoadTestClient &rhs) = delete;
+	};
+
+	/// <summary>
+	/// Reads an input script. Each line is a step: its duration in ms followed by the names of the input elements held during it, MOUSE_LEFT, MOUSE_RIGHT or MOUSE_MIDDLE for held mouse buttons and MOVE x y for mouse movement. Lines starting with // are ignored.
+	/// </summary>
+	/// <param name="scriptPath">The path of the script to read.</param>
+	/// <param name="inputScript">The vector to fill with the read steps.</param>
+	/// <returns>Whether the script was read successfully.</returns>
+	static bool ReadInputScript(const std::string &scriptPath, std::vector<InputScriptStep> &inputScript) {
+		std::ifstream scriptFile(scriptPath);
+		if (!scriptFile.good()) {
+			std::printf("Couldn't open input script %s\n", scriptPath.c_str());
+			return false;
+		}
+
+		std::string line;
+		int lineNumber = 0;
+		while (std::getline(scriptFile, line)) {
+			lineNumber++;
+			std::istringstream lineStream(line);
+			std::string token;
+			if (!(lineStream >> token) || token.compare(0, 2, "//") == 0) {
+				continue;
+			}
+
+			InputScriptStep step;
+			step.Duration = std::atoi(token.c_str());
+			while (lineStream >> token) {
+				if (token == "MOVE") {
+					lineStream >> step.MouseX >> step.MouseY;
+				} else if (token == "MOUSE_LEFT") {
+					step.MouseButtonHeld[MOUSE_LEFT] = true;
+				} else if (token == "MOUSE_RIGHT") {
+					step.MouseButtonHeld[MOUSE_RIGHT] = true;
+				} else if (token == "MOUSE_MIDDLE") {
+					step.MouseButtonHeld[MOUSE_MIDDLE] = true;
+				} else {
+					std::array<const char *, INPUT_COUNT>::const_iterator elementName = std::find_if(c_InputElementNames.begin(), c_InputElementNames.end(), [&token](const char *name) { return token == name; });
+					if (elementName == c_InputElementNames.end()) {
+						std::printf("Unknown input %s on line %d of input script %s\n", token.c_str(), lineNumber, scriptPath.c_str());
+						return false;
+					}
+					step.InputElementHeld |= 1U << (elementName - c_InputElementNames.begin());
+				}
+			}
+			if (step.Duration <= 0) {
+				std::printf("Invalid duration on line %d of input script %s\n", lineNumber, scriptPath.c_str());
+				return false;
+			}
+			inputScript.push_back(step);
+		}
+		return !inputScript.empty();
+	}
+
+	/// <summary>
+	/// Makes the input script used when none is specified: walking, jumping, shooting, aiming with the mouse and opening the pie menu.
+	/// </summary>
+	/// <param name="inputScript">The vector to fill with the steps.</param>
+	static void MakeDefaultInputScript(std::vector<InputScriptStep> &inputScript) {
+		auto addStep = [&inputScript](int duration, std::initializer_list<InputElements> elements, int mouseX = 0, int mouseY = 0) {
+			InputScriptStep step;
+			step.Duration = duration;
+			for (InputElements element : elements) {
+				step.InputElementHeld |= 1U << element;
+			}
+			step.MouseX = mouseX;
+			step.MouseY = mouseY;
+			inputScript.push_back(step);
+		};
+		addStep(2000, { INPUT_L_RIGHT });
+		addStep(500, { INPUT_L_RIGHT, INPUT_JUMP });
+		addStep(1500, { INPUT_AIM_UP, INPUT_FIRE });
+		addStep(2000, { INPUT_L_LEFT, INPUT_FIRE });
+		addStep(1000, {}, 4, -2);
+		addStep(1000, { INPUT_PIEMENU });
+		addStep(1000, {});
+	}
+}
+
+using namespace RTE;
+
+/// <summary>
+/// Implementation of the main function.
+/// </summary>
+int main(int argc, char **argv) {
+	std::string serverName = "127.0.0.1";
+	unsigned short serverPort = 8000;
+	int clientCount = c_MaxClients;
+	int duration = 60;
+	int resX = 960;
+	int resY = 540;
+	int inputFps = 30;
+	std::string scriptPath;
+
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+
+		if (arg == "-server" && hasValue) {
+			std::string address = argv[++i];
+			size_t portSeparator = address.rfind(':');
+			serverName = address.substr(0, portSeparator);
+			if (portSeparator != std::string::npos) { serverPort = static_cast<unsigned short>(std::atoi(address.c_str() + portSeparator + 1)); }
+		} else if (arg == "-clients" && hasValue) {
+			clientCount = std::clamp(std::atoi(argv[++i]), 1, static_cast<int>(c_MaxClients));
+		} else if (arg == "-duration" && hasValue) {
+			duration = std::max(std::atoi(argv[++i]), 1);
+		} else if (arg == "-resolution" && hasValue) {
+			if (std::sscanf(argv[++i], "%dx%d", &resX, &resY) != 2 || resX <= 0 || resY <= 0) {
+				std::printf("Invalid resolution %s\n", argv[i]);
+				return 1;
+			}
+		} else if (arg == "-inputfps" && hasValue) {
+			inputFps = std::max(std::atoi(argv[++i]), 1);
+		} else if (arg == "-script" && hasValue) {
+			scriptPath = argv[++i];
+		} else {
+			std::printf("Usage: %s [-server address:port] [-clients count] [-duration seconds] [-resolution WxH] [-inputfps rate] [-script path]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	std::vector<InputScriptStep> inputScript;
+	if (scriptPath.empty()) {
+		MakeDefaultInputScript(inputScript);
+	} else if (!ReadInputScript(scriptPath, inputScript)) {
+		return 1;
+	}
+
+	std::vector<std::unique_ptr<LoadTestClient>> clients;
+	for (int i = 0; i < clientCount; i++) {
+		clients.push_back(std::make_unique<LoadTestClient>(i, resX, resY, inputScript));
+		if (!clients.back()->Connect(serverName, serverPort)) {
+			std::printf("Client %d: Unable to connect to %s:%d\n", i + 1, serverName.c_str(), serverPort);
+			return 1;
+		}
+	}
+	std::printf("Connecting %d clients to %s:%d at %dx%d for %d seconds\n", clientCount, serverName.c_str(), serverPort, resX, resY, duration);
+
+	std::vector<LoadTestStats> totals(clientCount);
+	std::vector<int> secondsMeasured(clientCount, 0);
+	LoadTestClock::time_point startTime = LoadTestClock::now();
+	LoadTestClock::time_point lastReportTime = startTime;
+
+	while (LoadTestClock::now() - startTime < std::chrono::seconds(duration)) {
+		for (const std::unique_ptr<LoadTestClient> &client : clients) {
+			client->Update(inputFps);
+		}
+
+		LoadTestClock::time_point now = LoadTestClock::now();
+		double secsSinceReport = std::chrono::duration<double>(now - lastReportTime).count();
+		if (secsSinceReport >= 1.0) {
+			lastReportTime = now;
+			for (int i = 0; i < clientCount; i++) {
+				LoadTestStats stats = clients[i]->TakeStats();
+				const char *state = !clients[i]->IsRegistered() ? "connecting" : (clients[i]->IsReceivingScene() ? "scene" : "frames");
+				std::printf("Client %d [%s]: %5.1f fps  %8.1f kbit/s  decode %5.2f ms/frame  delivery %6.2f ms  ping %4d ms  dropped %d\n",
+					i + 1, state,
+					static_cast<double>(stats.Frames) / secsSinceReport,
+					static_cast<double>(stats.BytesReceived) * 8.0 / 1000.0 / secsSinceReport,
+					(stats.Frames > 0) ? stats.DecodeMsec / stats.Frames : 0,
+					(stats.Frames > 0) ? stats.FrameDeliveryMsec / stats.Frames : 0,
+					clients[i]->GetPing(),
+					stats.DroppedBoxes);
+
+				// Only seconds spent receiving frames count towards the summary, joining and scene transfers would skew it
+				if (stats.Frames > 0) {
+					totals[i].Frames += stats.Frames;
+					totals[i].BytesReceived += stats.BytesReceived;
+					totals[i].DecodeMsec += stats.DecodeMsec;
+					totals[i].FrameDeliveryMsec += stats.FrameDeliveryMsec;
+					totals[i].DroppedBoxes += stats.DroppedBoxes;
+					secondsMeasured[i]++;
+				}
+			}
+		}
+		RakSleep(1);
+	}
+
+	std::printf("\nSummary over the seconds frames were received:\n");
+	for (int i = 0; i < clientCount; i++) {
+		const LoadTestStats &stats = totals[i];
+		double seconds = static_cast<double>(std::max(secondsMeasured[i], 1));
+		std::printf("Client %d: %5.1f fps  %8.1f kbit/s  decode %5.2f ms/frame  delivery %6.2f ms  dropped %d  over %d s\n",
+			i + 1,
+			static_cast<double>(stats.Frames) / seconds,
+			static_cast<double>(stats.BytesReceived) * 8.0 / 1000.0 / seconds,
+			(stats.Frames > 0) ? stats.DecodeMsec / stats.Frames : 0,
+			(stats.Frames > 0) ? stats.FrameDeliveryMsec / stats.Frames : 0,
+			stats.DroppedBoxes,
+			secondsMeasured[i]);
+	}
+	return 0;
+}
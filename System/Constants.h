@@ -15,6 +15,7 @@ namespace RTE {
 
 #pragma region Filesystem Constants
 	static constexpr char *c_ScreenshotDirectory = { "_Screenshots" };
+	static constexpr char *c_PresetCacheDirectory = { "_PresetCache" };
 #pragma endregion
 
 #pragma region Physics Constants
@@ -90,6 +91,11 @@ namespace RTE {
 	static constexpr unsigned short c_FramesToRemember = 3;
 	static constexpr unsigned short c_MaxLayersStoredForNetwork = 10;
 	static constexpr unsigned short c_MaxPixelLineBufferSize = 8192;
+	static constexpr unsigned short c_MaxUnacknowledgedInputs = 256; //!< The maximum number of sent input messages a client keeps the mouse movement of while waiting for the server to acknowledge them.
+	static constexpr unsigned short c_MaxPieSlicesForNetwork = 16; //!< The maximum number of pie menu slices sent to clients so they can predict which slice is hovered.
+	static constexpr int c_TerrainTileSize = 32; //!< Width and height of the tiles terrain changes are coalesced into for sending to clients.
+	static constexpr int c_MaxTerrainChangePayloadSize = 65536; //!< The most run-length encoded tile data gathered into a single terrain change message before it's compressed.
+	static constexpr unsigned short c_PixelEntityPresetID = 0xFFFF; //!< The network preset ID used for replicated entities that are drawn as a single pixel and have no sprite preset.
 #pragma endregion
 
 #pragma region Input Constants
@@ -1,15 +1,25 @@
 #include "ContentFile.h"
 #include "AudioMan.h"
+#include "LoadProfiler.h"
 #include "PresetMan.h"
 #include "ConsoleMan.h"
 
+#include "png.h"
+
 namespace RTE {
 
 	const std::string ContentFile::c_ClassName = "ContentFile";
 
 	std::array<std::unordered_map<std::string, BITMAP *>, ContentFile::BitDepths::BitDepthCount> ContentFile::s_LoadedBitmaps;
+	std::array<std::unordered_multimap<size_t, BITMAP *>, ContentFile::BitDepths::BitDepthCount> ContentFile::s_LoadedBitmapsByContent;
+	std::array<ContentFile::BitmapAtlas, ContentFile::BitDepths::BitDepthCount> ContentFile::s_BitmapAtlases;
+	int ContentFile::s_SharedBitmapCount = 0;
+	size_t ContentFile::s_SharedBitmapBytes = 0;
+	int ContentFile::s_AtlasedBitmapCount = 0;
 	std::unordered_map<std::string, FMOD::Sound *> ContentFile::s_LoadedSamples;
 	std::unordered_map<size_t, std::string> ContentFile::s_PathHashes;
+	std::unique_ptr<ThreadPool> ContentFile::s_BitmapPreloadThreads;
+	std::unordered_map<std::string, std::shared_ptr<ContentFile::PreloadedBitmap>> ContentFile::s_PreloadedBitmaps;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -46,10 +56,20 @@ namespace RTE {
 
 	void ContentFile::FreeAllLoaded() {
 		for (int depth = BitDepths::Eight; depth < BitDepths::BitDepthCount; ++depth) {
-			for (const std::pair<std::string, BITMAP *> &bitmap : s_LoadedBitmaps.at(depth)) {
+			// Identical bitmaps are stored under several paths but only once by their contents, so destroy them from there. Sub-bitmaps have to go before the atlas pages they're part of.
+			for (const std::pair<const size_t, BITMAP *> &bitmap : s_LoadedBitmapsByContent.at(depth)) {
 				destroy_bitmap(bitmap.second);
 			}
+			for (BITMAP *atlasPage : s_BitmapAtlases.at(depth).Pages) {
+				destroy_bitmap(atlasPage);
+			}
+			s_LoadedBitmaps.at(depth).clear();
+			s_LoadedBitmapsByContent.at(depth).clear();
+			s_BitmapAtlases.at(depth) = BitmapAtlas();
 		}
+		s_SharedBitmapCount = 0;
+		s_SharedBitmapBytes = 0;
+		s_AtlasedBitmapCount = 0;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -116,6 +136,12 @@ namespace RTE {
 		std::unordered_map<std::string, BITMAP *>::iterator foundBitmap = s_LoadedBitmaps.at(bitDepth).find(dataPathToLoad);
 		if (foundBitmap != s_LoadedBitmaps.at(bitDepth).end()) {
 			returnBitmap = (*foundBitmap).second;
+			// Stored bitmaps may be shared with others or be part of an atlas page, so callers that take ownership get a copy of their own
+			if (!storeBitmap) {
+				BITMAP *storedBitmap = returnBitmap;
+				returnBitmap = create_bitmap_ex(bitmap_color_depth(storedBitmap), storedBitmap->w, storedBitmap->h);
+				blit(storedBitmap, returnBitmap, 0, 0, 0, 0, storedBitmap->w, storedBitmap->h);
+			}
 		} else {
 			if (!std::filesystem::exists(dataPathToLoad)) {
 				const std::string dataPathWithoutExtension = dataPathToLoad.substr(0, dataPathToLoad.length() - m_DataPathExtension.length());
@@ -129,10 +155,23 @@ namespace RTE {
 					RTEAbort("Failed to find image file with following path and name:\n\n" + m_DataPath + " or " + altFileExtension + "\n" + m_FormattedReaderPosition);
 				}
 			}
-			returnBitmap = LoadAndReleaseBitmap(conversionMode, dataPathToLoad); // NOTE: This takes ownership of the bitmap file
+			int profilerSection = LoadProfiler::BeginSection(LoadProfiler::ImageSection, dataPathToLoad);
+			// Bitmaps decoded ahead are always 8bpp, so they can't be used when they're to be converted to a higher color depth
+			if (!((conversionMode == 0 ? COLORCONV_MOST : conversionMode) & COLORCONV_EXPAND_256)) { returnBitmap = TakePreloadedBitmap(dataPathToLoad); }
+			if (!returnBitmap) { returnBitmap = LoadAndReleaseBitmap(conversionMode, dataPathToLoad); } // NOTE: This takes ownership of the bitmap file
+			if (LoadProfiler::IsProfiling()) {
+				std::error_code errorCode;
+				uintmax_t fileSize = std::filesystem::file_size(dataPathToLoad, errorCode);
+				if (!errorCode) { LoadProfiler::AddBytesRead(static_cast<size_t>(fileSize)); }
+				LoadProfiler::AddImageDecoded();
+			}
+			LoadProfiler::EndSection(profilerSection);
 
 			// Insert the bitmap into the map, PASSING OVER OWNERSHIP OF THE LOADED DATAFILE
-			if (storeBitmap) { s_LoadedBitmaps.at(bitDepth).insert({ dataPathToLoad, returnBitmap }); }
+			if (storeBitmap) {
+				returnBitmap = AddLoadedBitmap(returnBitmap, bitDepth);
+				s_LoadedBitmaps.at(bitDepth).insert({ dataPathToLoad, returnBitmap });
+			}
 		}
 		return returnBitmap;
 	}
@@ -192,6 +231,213 @@ namespace RTE {
 		return returnBitmap;
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	BITMAP * ContentFile::AddLoadedBitmap(BITMAP *bitmap, int bitDepth) {
+		const int bytesPerLine = bitmap->w * ((bitmap_color_depth(bitmap) + 7) / 8);
+		const size_t contentHash = GetBitmapContentHash(bitmap);
+
+		auto [sameHashItr, sameHashEnd] = s_LoadedBitmapsByContent.at(bitDepth).equal_range(contentHash);
+		for (; sameHashItr != sameHashEnd; ++sameHashItr) {
+			BITMAP *loadedBitmap = sameHashItr->second;
+			if (loadedBitmap->w != bitmap->w || loadedBitmap->h != bitmap->h || bitmap_color_depth(loadedBitmap) != bitmap_color_depth(bitmap)) {
+				continue;
+			}
+			bool sameContents = true;
+			for (int y = 0; y < bitmap->h && sameContents; ++y) {
+				sameContents = memcmp(loadedBitmap->line[y], bitmap->line[y], bytesPerLine) == 0;
+			}
+			if (sameContents) {
+				s_SharedBitmapCount++;
+				s_SharedBitmapBytes += static_cast<size_t>(bytesPerLine) * bitmap->h;
+				destroy_bitmap(bitmap);
+				return loadedBitmap;
+			}
+		}
+		if (bitmap->w <= c_MaxAtlasedBitmapSize && bitmap->h <= c_MaxAtlasedBitmapSize && (bitmap_color_depth(bitmap) == 8 || bitmap_color_depth(bitmap) == 32)) { bitmap = PackIntoAtlas(bitmap); }
+
+		s_LoadedBitmapsByContent.at(bitDepth).insert({ contentHash, bitmap });
+		return bitmap;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	BITMAP * ContentFile::PackIntoAtlas(BITMAP *bitmap) {
+		const int colorDepth = bitmap_color_depth(bitmap);
+		BitmapAtlas &atlas = s_BitmapAtlases.at((colorDepth == 8) ? BitDepths::Eight : BitDepths::ThirtyTwo);
+
+		if (!atlas.Pages.empty() && atlas.ShelfX + bitmap->w > c_AtlasPageSize) {
+			atlas.ShelfX = 0;
+			atlas.ShelfY += atlas.ShelfHeight;
+			atlas.ShelfHeight = 0;
+		}
+		if (atlas.Pages.empty() || atlas.ShelfY + bitmap->h > c_AtlasPageSize) {
+			BITMAP *atlasPage = create_bitmap_ex(colorDepth, c_AtlasPageSize, c_AtlasPageSize);
+			clear_to_color(atlasPage, bitmap_mask_color(atlasPage));
+			atlas.Pages.emplace_back(atlasPage);
+			atlas.ShelfX = 0;
+			atlas.ShelfY = 0;
+			atlas.ShelfHeight = 0;
+		}
+		blit(bitmap, atlas.Pages.back(), 0, 0, atlas.ShelfX, atlas.ShelfY, bitmap->w, bitmap->h);
+		BITMAP *packedBitmap = create_sub_bitmap(atlas.Pages.back(), atlas.ShelfX, atlas.ShelfY, bitmap->w, bitmap->h);
+
+		atlas.ShelfX += bitmap->w;
+		atlas.ShelfHeight = std::max(atlas.ShelfHeight, bitmap->h);
+		s_AtlasedBitmapCount++;
+
+		destroy_bitmap(bitmap);
+		return packedBitmap;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	size_t ContentFile::GetBitmapContentHash(BITMAP *bitmap) {
+		const size_t bytesPerLine = static_cast<size_t>(bitmap->w) * ((bitmap_color_depth(bitmap) + 7) / 8);
+		size_t contentHash = std::hash<int>()(bitmap->w) ^ (std::hash<int>()(bitmap->h) << 1) ^ (std::hash<int>()(bitmap_color_depth(bitmap)) << 2);
+		for (int y = 0; y < bitmap->h; ++y) {
+			contentHash = (contentHash * 31) + std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char *>(bitmap->line[y]), bytesPerLine));
+		}
+		return contentHash;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	std::string ContentFile::GetBitmapSharingReport() {
+		size_t atlasPageCount = 0;
+		for (const BitmapAtlas &atlas : s_BitmapAtlases) {
+			atlasPageCount += atlas.Pages.size();
+		}
+		char report[512];
+		std::snprintf(report, sizeof(report), "%i bitmaps identical to others share their memory, saving %zu KB. %i small bitmaps are packed into %zu atlas pages.", s_SharedBitmapCount, s_SharedBitmapBytes / 1024, s_AtlasedBitmapCount, atlasPageCount);
+		return report;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ContentFile::PreloadBitmaps(const std::string &directory) {
+		ClearPreloadedBitmaps();
+		if (!std::filesystem::is_directory(directory)) {
+			return;
+		}
+		s_BitmapPreloadThreads = std::make_unique<ThreadPool>(0);
+		// With a single hardware thread there are no workers, and decoding everything up front on the main thread would only waste time on files that are never used
+		if (s_BitmapPreloadThreads->GetThreadCount() == 0) {
+			s_BitmapPreloadThreads.reset();
+			return;
+		}
+
+		std::error_code errorCode;
+		for (std::filesystem::recursive_directory_iterator fileItr(directory, errorCode), endItr; !errorCode && fileItr != endItr; fileItr.increment(errorCode)) {
+			std::string extension = fileItr->path().extension().string();
+			std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+			if (extension != ".png" || !fileItr->is_regular_file(errorCode) || fileItr->file_size(errorCode) > c_MaxPreloadedFileSize) {
+				continue;
+			}
+			std::string filePath = fileItr->path().generic_string();
+			std::shared_ptr<PreloadedBitmap> preloadedBitmap = std::make_shared<PreloadedBitmap>();
+			s_PreloadedBitmaps.try_emplace(filePath, preloadedBitmap);
+
+			// The job only holds a weak reference, otherwise the PreloadedBitmap would keep itself alive through its own DecodeJob
+			preloadedBitmap->DecodeJob = s_BitmapPreloadThreads->AddJob([filePath, weakPreloadedBitmap = std::weak_ptr<PreloadedBitmap>(preloadedBitmap)]() {
+				std::shared_ptr<PreloadedBitmap> preloadedBitmap = weakPreloadedBitmap.lock();
+				if (preloadedBitmap && !preloadedBitmap->Claimed.exchange(true)) { DecodePalettedPNG(filePath, *preloadedBitmap); }
+			});
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ContentFile::ClearPreloadedBitmaps() {
+		// Claim everything that's still queued so the workers skip it instead of decoding it for nothing
+		for (const auto &[filePath, preloadedBitmap] : s_PreloadedBitmaps) {
+			preloadedBitmap->Claimed = true;
+		}
+		// Destroying the ThreadPool runs out the rest of the queue before the workers stop
+		s_BitmapPreloadThreads.reset();
+		s_PreloadedBitmaps.clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	BITMAP * ContentFile::TakePreloadedBitmap(const std::string &dataPathToLoad) {
+		std::unordered_map<std::string, std::shared_ptr<PreloadedBitmap>>::iterator foundBitmap = s_PreloadedBitmaps.find(dataPathToLoad);
+		if (foundBitmap == s_PreloadedBitmaps.end()) {
+			return nullptr;
+		}
+		std::shared_ptr<PreloadedBitmap> preloadedBitmap = std::move(foundBitmap->second);
+		s_PreloadedBitmaps.erase(foundBitmap);
+
+		// If no worker got to it yet it's quicker to load it the usual way than to wait for its turn in the queue. The worker will skip it once it does get to it.
+		if (!preloadedBitmap->Claimed.exchange(true)) {
+			return nullptr;
+		}
+		preloadedBitmap->DecodeJob.wait();
+
+		if (preloadedBitmap->Pixels.empty()) {
+			return nullptr;
+		}
+		BITMAP *returnBitmap = create_bitmap_ex(8, preloadedBitmap->Width, preloadedBitmap->Height);
+		for (int y = 0; y < preloadedBitmap->Height; ++y) {
+			std::memcpy(returnBitmap->line[y], preloadedBitmap->Pixels.data() + (y * preloadedBitmap->Width), preloadedBitmap->Width);
+		}
+		return returnBitmap;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ContentFile::DecodePalettedPNG(const std::string &filePath, PreloadedBitmap &preloadedBitmap) {
+		std::ifstream fileStream(filePath, std::ios::binary);
+		std::vector<unsigned char> fileData((std::istreambuf_iterator<char>(fileStream)), std::istreambuf_iterator<char>());
+		if (fileData.size() < 8 || png_sig_cmp(fileData.data(), 0, 8) != 0) {
+			return false;
+		}
+		png_structp pngStruct = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+		png_infop pngInfo = pngStruct ? png_create_info_struct(pngStruct) : nullptr;
+		if (!pngInfo) {
+			png_destroy_read_struct(&pngStruct, nullptr, nullptr);
+			return false;
+		}
+		// libpng reports errors by jumping back here. Everything with a destructor lives outside of the part it can jump out of.
+		std::pair<const unsigned char *, size_t> readPosition(fileData.data(), fileData.size());
+		std::vector<png_bytep> rows;
+		if (setjmp(png_jmpbuf(pngStruct))) {
+			png_destroy_read_struct(&pngStruct, &pngInfo, nullptr);
+			preloadedBitmap.Pixels.clear();
+			return false;
+		}
+		png_set_read_fn(pngStruct, &readPosition, [](png_structp readStruct, png_bytep outData, png_size_t length) {
+			std::pair<const unsigned char *, size_t> *position = static_cast<std::pair<const unsigned char *, size_t> *>(png_get_io_ptr(readStruct));
+			if (length > position->second) { png_error(readStruct, "Read past the end of the file."); }
+			std::memcpy(outData, position->first, length);
+			position->first += length;
+			position->second -= length;
+		});
+		png_read_info(pngStruct, pngInfo);
+
+		// Transparency information would make Allegro's loader expand the image to 32bpp, so leave those to it
+		if (png_get_color_type(pngStruct, pngInfo) != PNG_COLOR_TYPE_PALETTE || png_get_valid(pngStruct, pngInfo, PNG_INFO_tRNS)) {
+			png_destroy_read_struct(&pngStruct, &pngInfo, nullptr);
+			return false;
+		}
+		png_set_packing(pngStruct);
+		png_set_interlace_handling(pngStruct);
+		png_read_update_info(pngStruct, pngInfo);
+
+		preloadedBitmap.Width = static_cast<int>(png_get_image_width(pngStruct, pngInfo));
+		preloadedBitmap.Height = static_cast<int>(png_get_image_height(pngStruct, pngInfo));
+		preloadedBitmap.Pixels.resize(static_cast<size_t>(preloadedBitmap.Width) * preloadedBitmap.Height);
+		rows.resize(preloadedBitmap.Height);
+		for (int y = 0; y < preloadedBitmap.Height; ++y) {
+			rows[y] = preloadedBitmap.Pixels.data() + (static_cast<size_t>(y) * preloadedBitmap.Width);
+		}
+		png_read_image(pngStruct, rows.data());
+		png_read_end(pngStruct, nullptr);
+		png_destroy_read_struct(&pngStruct, &pngInfo, nullptr);
+
+		return true;
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	FMOD::Sound * ContentFile::GetAsSound(bool abortGameForInvalidSound, bool asyncLoading) {
@@ -214,11 +460,10 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	FMOD::Sound * ContentFile::LoadAndReleaseSound(bool abortGameForInvalidSound, bool asyncLoading) {
-		if (m_DataPath.empty() || !g_AudioMan.IsAudioEnabled()) {
-			return nullptr;
+	bool ContentFile::CheckSoundFile(bool abortGameForInvalidSound) {
+		if (m_DataPath.empty()) {
+			return false;
 		}
-
 		if (!std::filesystem::exists(m_DataPath)) {
 			bool foundAltExtension = false;
 			for (const std::string &altFileExtension : c_SupportedAudioFormats) {
@@ -233,13 +478,22 @@ namespace RTE {
 				std::string errorMessage = "Failed to find audio file with following path and name:\n\n" + m_DataPath + " or any alternative supported file type";
 				RTEAssert(!abortGameForInvalidSound, errorMessage + "\n" + m_FormattedReaderPosition);
 				g_ConsoleMan.PrintString(errorMessage + ". The file was not loaded!");
-				return nullptr;
+				return false;
 			}
 		}
 		if (std::filesystem::file_size(m_DataPath) == 0) {
 			const std::string errorMessage = "Failed to create sound because because the file was empty. The path and name were: ";
 			RTEAssert(!abortGameForInvalidSound, errorMessage + "\n\n" + m_DataPathAndReaderPosition);
 			g_ConsoleMan.PrintString("ERROR: " + errorMessage + m_DataPath);
+			return false;
+		}
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	FMOD::Sound * ContentFile::LoadAndReleaseSound(bool abortGameForInvalidSound, bool asyncLoading) {
+		if (m_DataPath.empty() || !g_AudioMan.IsAudioEnabled() || !CheckSoundFile(abortGameForInvalidSound)) {
 			return nullptr;
 		}
 		FMOD::Sound *returnSample = nullptr;
@@ -2,10 +2,13 @@
 #define _RTECONTENTFILE_
 
 #include "Serializable.h"
+#include "ThreadPool.h"
 
 #include "fmod/fmod.hpp"
 #include "fmod/fmod_errors.h"
 
+#include <atomic>
+
 struct BITMAP;
 
 namespace RTE {
@@ -119,7 +122,7 @@ namespace RTE {
 		/// Gets the data represented by this ContentFile object as an Allegro BITMAP, loading it into the static maps if it's not already loaded. Note that ownership of the BITMAP is NOT transferred!
 		/// </summary>
 		/// <param name="conversionMode">The Allegro color conversion mode to use when loading this bitmap.</param>
-		/// <param name="storeBitmap">Whether to store the BITMAP in the relevant static map after loading it or not.</param>
+		/// <param name="storeBitmap">Whether to store the BITMAP in the relevant static map after loading it or not. If not, ownership of the BITMAP IS transferred, and it's never one shared with the static maps.</param>
 		/// <param name="dataPathToSpecificFrame">Path to a specific frame when loading an animation to avoid overwriting the original preset DataPath when loading each frame.</param>
 		/// <returns>Pointer to the BITMAP loaded from disk.</returns>
 		BITMAP * GetAsBitmap(int conversionMode = 0, bool storeBitmap = true, const std::string &dataPathToSpecificFrame = "");
@@ -140,6 +143,32 @@ namespace RTE {
 		/// <param name="asyncLoading">Whether to enable FMOD asynchronous loading or not. Should be disabled for loading audio files with Lua AddSound.
 		/// <returns>Pointer to the FSOUND_SAMPLE loaded from disk.</returns>
 		FMOD::Sound * GetAsSound(bool abortGameForInvalidSound = true, bool asyncLoading = true);
+
+		/// <summary>
+		/// Checks that the audio file represented by this ContentFile exists and isn't empty without loading it, so sounds loaded on demand still have their files checked while DataModules are loaded.
+		/// If the file isn't found but one with the same name and another supported extension is, this is changed to point to that one instead.
+		/// </summary>
+		/// <param name="abortGameForInvalidSound">Whether to abort the game if the file is missing or empty, or just show a console error. Default true.</param>
+		/// <returns>Whether the audio file can be loaded.</returns>
+		bool CheckSoundFile(bool abortGameForInvalidSound = true);
+
+		/// <summary>
+		/// Starts decoding the PNG files in a directory and all its subdirectories on worker threads, so GetAsBitmap can take them ready-made instead of decoding them itself while a DataModule's .ini files are being read.
+		/// Only paletted PNGs are decoded ahead, anything else is loaded by GetAsBitmap the usual way.
+		/// </summary>
+		/// <param name="directory">The directory to decode the PNG files of, e.g. a DataModule's folder.</param>
+		static void PreloadBitmaps(const std::string &directory);
+
+		/// <summary>
+		/// Stops decoding ahead, waits for the worker threads and frees all preloaded bitmap data GetAsBitmap didn't take.
+		/// </summary>
+		static void ClearPreloadedBitmaps();
+
+		/// <summary>
+		/// Gets a report of how many of the loaded bitmaps share memory, either because they're identical to another one loaded from a different path, or because they're small enough to be packed into an atlas page.
+		/// </summary>
+		/// <returns>A string with the report, for the loading log.</returns>
+		static std::string GetBitmapSharingReport();
 #pragma endregion
 
 #pragma region Class Info
@@ -159,9 +188,41 @@ namespace RTE {
 		/// </summary>
 		enum BitDepths { Eight = 0, ThirtyTwo, BitDepthCount };
 
+		/// <summary>
+		/// The pixels of a bitmap decoded ahead by a worker thread.
+		/// </summary>
+		struct PreloadedBitmap {
+			std::atomic<bool> Claimed = false; //!< Whether a worker thread or GetAsBitmap already took this bitmap over, so it's decoded only once.
+			std::future<void> DecodeJob; //!< The job decoding this bitmap.
+			int Width = 0; //!< The width of the decoded bitmap.
+			int Height = 0; //!< The height of the decoded bitmap.
+			std::vector<unsigned char> Pixels; //!< The palette indices of the decoded bitmap, row by row. Empty if the file couldn't be decoded ahead.
+		};
+
+		/// <summary>
+		/// Pages of bitmap memory that small bitmaps are packed into, filled left to right in shelves as tall as the tallest bitmap on them.
+		/// </summary>
+		struct BitmapAtlas {
+			std::vector<BITMAP *> Pages; //!< The pages of this atlas. The last one is the one being filled.
+			int ShelfX = 0; //!< Where the next bitmap goes on the current shelf.
+			int ShelfY = 0; //!< Where the current shelf is on the last page.
+			int ShelfHeight = 0; //!< The height of the tallest bitmap on the current shelf.
+		};
+
+		static constexpr int c_AtlasPageSize = 512; //!< The width and height of atlas pages.
+		static constexpr int c_MaxAtlasedBitmapSize = 32; //!< The largest width and height of the bitmaps packed into atlas pages. Gibs, icons and the like are smaller than this, anything bigger keeps its own memory.
+		static constexpr std::uintmax_t c_MaxPreloadedFileSize = 512 * 1024; //!< The maximum size of the files decoded ahead, so large Scene layers that are only loaded once a Scene is played aren't decoded for nothing.
+
 		static std::unordered_map<size_t, std::string> s_PathHashes; //!< Static map containing the hash values of paths of all loaded data files.
 		static std::array<std::unordered_map<std::string, BITMAP *>, BitDepthCount> s_LoadedBitmaps; //!< Static map containing all the already loaded BITMAPs and their paths for each bit depth.
+		static std::array<std::unordered_multimap<size_t, BITMAP *>, BitDepthCount> s_LoadedBitmapsByContent; //!< Static map containing every distinct loaded BITMAP by the hash of its contents for each bit depth, so identical images loaded from different paths share one BITMAP.
+		static std::array<BitmapAtlas, BitDepthCount> s_BitmapAtlases; //!< The atlases small BITMAPs are packed into, for 8 and 32 bit BITMAPs respectively.
+		static int s_SharedBitmapCount; //!< How many loaded BITMAPs were identical to one already loaded and share its memory instead.
+		static size_t s_SharedBitmapBytes; //!< How many bytes of pixel data sharing identical BITMAPs saved.
+		static int s_AtlasedBitmapCount; //!< How many loaded BITMAPs are packed into atlas pages.
 		static std::unordered_map<std::string, FMOD::Sound *> s_LoadedSamples; //!< Static map containing all the already loaded FSOUND_SAMPLEs and their paths.
+		static std::unique_ptr<ThreadPool> s_BitmapPreloadThreads; //!< The worker threads decoding bitmaps ahead. Only exists while bitmaps are being preloaded.
+		static std::unordered_map<std::string, std::shared_ptr<PreloadedBitmap>> s_PreloadedBitmaps; //!< Static map containing the bitmaps being decoded ahead and their paths. Only touched by the main thread, the workers only touch the entries they were handed.
 
 		std::string m_DataPath; //!< The path to this ContentFile's data file. In the case of an animation, this filename/name will be appended with 000, 001, 002 etc.
 		std::string m_DataPathExtension; //!< The extension of the data file of this ContentFile's path.
@@ -191,6 +252,44 @@ namespace RTE {
 		/// <param name="asyncLoading">Whether to enable FMOD asynchronous loading or not. Should be disabled for loading audio files with Lua AddSound.
 		/// <returns>Pointer to the FSOUND_SAMPLE loaded from disk.</returns>
 		FMOD::Sound * LoadAndReleaseSound(bool abortGameForInvalidSound = true, bool asyncLoading = true);
+
+		/// <summary>
+		/// Takes a bitmap decoded ahead by the worker threads, waiting for its decoding to finish if it's underway. Ownership of the BITMAP IS transferred!
+		/// </summary>
+		/// <param name="dataPathToLoad">The path of the bitmap to take.</param>
+		/// <returns>Pointer to the BITMAP created from the decoded pixels, or nullptr if the bitmap wasn't decoded ahead and has to be loaded the usual way.</returns>
+		static BITMAP * TakePreloadedBitmap(const std::string &dataPathToLoad);
+
+		/// <summary>
+		/// Finds an already loaded BITMAP with the same contents to use instead of a newly loaded one, or otherwise packs the new one into an atlas page if it's small enough. Ownership of the passed in BITMAP IS transferred!
+		/// </summary>
+		/// <param name="bitmap">The newly loaded BITMAP.</param>
+		/// <param name="bitDepth">Which of the static maps the BITMAP is going into.</param>
+		/// <returns>The BITMAP to store in the static maps. Either the passed in one, an identical one loaded before, or a sub-bitmap of an atlas page with the same contents.</returns>
+		static BITMAP * AddLoadedBitmap(BITMAP *bitmap, int bitDepth);
+
+		/// <summary>
+		/// Copies a small BITMAP into an atlas page and destroys it. Ownership of the passed in BITMAP IS transferred!
+		/// </summary>
+		/// <param name="bitmap">The BITMAP to pack. Has to be 8 or 32 bit and no larger than c_MaxAtlasedBitmapSize.</param>
+		/// <returns>A sub-bitmap of an atlas page with the same contents as the passed in BITMAP.</returns>
+		static BITMAP * PackIntoAtlas(BITMAP *bitmap);
+
+		/// <summary>
+		/// Creates a hash value out of the size, color depth and pixels of a BITMAP.
+		/// </summary>
+		/// <param name="bitmap">The BITMAP to hash.</param>
+		/// <returns>Hash value of the contents of the BITMAP.</returns>
+		static size_t GetBitmapContentHash(BITMAP *bitmap);
+
+		/// <summary>
+		/// Decodes a paletted PNG file into palette indices. Safe to call from worker threads since it doesn't touch any of Allegro's state.
+		/// The indices are what Allegro's PNG loader produces for such files when not converting to a higher color depth, palette or gamma settings notwithstanding.
+		/// </summary>
+		/// <param name="filePath">The path of the PNG file to decode.</param>
+		/// <param name="preloadedBitmap">The PreloadedBitmap to decode into.</param>
+		/// <returns>Whether the file was a paletted PNG without transparency and was decoded successfully.</returns>
+		static bool DecodePalettedPNG(const std::string &filePath, PreloadedBitmap &preloadedBitmap);
 #pragma endregion
 
 		/// <summary>
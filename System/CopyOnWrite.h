@@ -0,0 +1,78 @@
+#ifndef _RTECOPYONWRITE_
+#define _RTECOPYONWRITE_
+
+#include <memory>
+
+namespace RTE {
+
+	/// <summary>
+	/// Holds data that is shared between copies until one of them changes it, at which point that copy gets its own.
+	/// Meant for the parts of presets that clones read but almost never change, so cloning a preset doesn't have to copy them.
+	/// </summary>
+	template <typename Type> class CopyOnWrite {
+
+	public:
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate an empty CopyOnWrite object in system memory.
+		/// </summary>
+		CopyOnWrite() = default;
+
+		/// <summary>
+		/// Copy constructor method used to instantiate a CopyOnWrite object sharing the data of another one.
+		/// </summary>
+		/// <param name="reference">A reference to the CopyOnWrite to share the data of.</param>
+		CopyOnWrite(const CopyOnWrite &reference) = default;
+
+		/// <summary>
+		/// An assignment operator for making this CopyOnWrite share the data of another one.
+		/// </summary>
+		/// <param name="rhs">A CopyOnWrite reference.</param>
+		/// <returns>A reference to the changed CopyOnWrite.</returns>
+		CopyOnWrite & operator=(const CopyOnWrite &rhs) = default;
+#pragma endregion
+
+#pragma region Getters
+		/// <summary>
+		/// Gets the data for reading only. Never copies it.
+		/// </summary>
+		/// <returns>A const reference to the data, or to an empty instance if there is no data.</returns>
+		const Type & Get() const { return m_Data ? *m_Data : s_Empty; }
+
+		/// <summary>
+		/// Gets the data for changing it, first giving this CopyOnWrite its own copy if the data is shared with any others.
+		/// References previously gotten through Get() may no longer refer to the data of this CopyOnWrite afterwards.
+		/// </summary>
+		/// <returns>A reference to the data, owned only by this CopyOnWrite.</returns>
+		Type & GetForWriting() {
+			if (!m_Data) {
+				m_Data = std::make_shared<Type>();
+			} else if (m_Data.use_count() > 1) {
+				m_Data = std::make_shared<Type>(*m_Data);
+			}
+			return *m_Data;
+		}
+
+		/// <summary>
+		/// Gets whether the data is shared with any other CopyOnWrite.
+		/// </summary>
+		/// <returns>Whether the data is shared.</returns>
+		bool IsShared() const { return m_Data && m_Data.use_count() > 1; }
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Lets go of the data, leaving this CopyOnWrite empty. The data itself is only deleted once no other CopyOnWrite shares it.
+		/// </summary>
+		void Reset() { m_Data.reset(); }
+#pragma endregion
+
+	private:
+
+		static inline const Type s_Empty = Type(); //!< What empty CopyOnWrites read as, so reading never has to allocate.
+
+		std::shared_ptr<Type> m_Data; //!< The data, shared with every other CopyOnWrite copied from this one that hasn't changed it since. Null when empty.
+	};
+}
+#endif
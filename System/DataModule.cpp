@@ -1,7 +1,9 @@
 #include "DataModule.h"
 #include "PresetMan.h"
+#include "LoadProfiler.h"
 #include "SceneMan.h"
 #include "LuaMan.h"
+#include "SceneObject.h"
 
 namespace RTE {
 
@@ -19,8 +21,10 @@ namespace RTE {
 		m_IconFile.Reset();
 		m_Icon = 0;
 		m_PresetList.clear();
+		m_PresetIndex.clear();
 		m_EntityList.clear();
 		m_TypeMap.clear();
+		m_GroupIndex.clear();
 		std::fill_n(m_MaterialMappings, c_PaletteEntriesNumber, 0);
 		m_ScanFolderContents = false;
 		m_IgnoreMissingItems = false;
@@ -49,7 +53,15 @@ namespace RTE {
 		// NOTE: This looks for the MergedIndex.ini generated by the index merger tool. The tool is mostly superseded by disabling loading visuals, but still provides some benefit.
 		if (std::filesystem::exists(mergedIndexPath.c_str())) { indexPath = mergedIndexPath; }
 
-		if (std::filesystem::exists(indexPath.c_str()) && reader.Create(indexPath.c_str(), true, progressCallback) >= 0) {
+		// Replay what was read the last time the module was loaded if none of its files changed since, otherwise record it for the next time
+		PresetCache presetCache;
+		presetCache.Create(m_FileName);
+		PresetCache *activePresetCache = (presetCache.IsReplaying() || presetCache.IsRecording()) ? &presetCache : nullptr;
+
+		if (std::filesystem::exists(indexPath.c_str()) && reader.Create(indexPath.c_str(), true, progressCallback, false, activePresetCache) >= 0) {
+			// Decode the module's images on worker threads while its .ini files are being read, instead of one by one as the presets using them are created
+			ContentFile::PreloadBitmaps(m_FileName);
+
 			int result = Serializable::Create(reader);
 
 			// Print an empty line to separate the end of a module from the beginning of the next one in the loading progress log.
@@ -67,7 +79,7 @@ namespace RTE {
 					// Make sure we're not adding Index.ini again
 					if (std::strlen(fileInfo.name) > 0 && std::string(fileInfo.name) != "Index.ini") {
 						std::string iniPath(m_FileName + "/" + fileInfo.name);
-						if (std::filesystem::exists(iniPath.c_str()) && iniReader.Create(iniPath.c_str(), false, progressCallback) >= 0) {
+						if (std::filesystem::exists(iniPath.c_str()) && iniReader.Create(iniPath.c_str(), false, progressCallback, false, activePresetCache) >= 0) {
 							result = Serializable::Create(iniReader, false, true);
 
 							// Report loading result
@@ -78,6 +90,9 @@ namespace RTE {
 				// Close the file search to avoid memory leaks
 				al_findclose(&fileInfo);
 			}
+			ContentFile::ClearPreloadedBitmaps();
+
+			if (result >= 0 && presetCache.IsRecording()) { presetCache.Save(); }
 			return result;
 		}
 		return -1;
@@ -188,38 +203,19 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	std::string DataModule::GetEntityDataLocation(std::string exactType, std::string instance) {
-		const Entity *foundEntity = GetEntityPreset(exactType, instance);
-		if (foundEntity == NULL) {
-			return 0;
-		}
-
-		// Search for entity in instanceList
-		for (std::list<PresetEntry>::iterator itr = m_PresetList.begin(); itr != m_PresetList.end(); ++itr) {
-			if ((*itr).m_EntityPreset == foundEntity) {
-				return (*itr).m_FileReadFrom;
-			}
+		if (exactType.empty() || instance == "None" || instance.empty()) {
+			return "";
 		}
-		RTEAbort("Tried to find allegedly existing Entity Preset Entry: " + foundEntity->GetPresetName() + ", but couldn't!");
-		return 0;
+		std::list<PresetEntry>::iterator presetEntry = GetEntityIfExactType(PresetKey(std::move(exactType), std::move(instance)));
+		return (presetEntry != m_PresetList.end()) ? presetEntry->m_FileReadFrom : "";
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	const Entity * DataModule::GetEntityPreset(std::string exactType, std::string instance) {
-		if (exactType.empty() || instance == "None" || instance.empty()) {
-			return 0;
-		}
-
-		std::map<std::string, std::list<std::pair<std::string, Entity *>>>::iterator classItr = m_TypeMap.find(exactType);
-		if (classItr != m_TypeMap.end()) {
-			// Find an instance of that EXACT type and name; derived types are not matched
-			for (std::list<std::pair<std::string, Entity *>>::iterator instItr = (*classItr).second.begin(); instItr != (*classItr).second.end(); ++instItr) {
-				if ((*instItr).first == instance && (*instItr).second->GetClassName() == exactType) {
-					return (*instItr).second;
-				}
-			}
-		}
-		return 0;
+	const Entity * DataModule::GetEntityPreset(const PresetKey &presetKey) const {
+		// Only an instance of that EXACT type and name is indexed under the key; derived types are not matched
+		std::unordered_map<PresetKey, std::list<PresetEntry>::iterator, PresetKeyHash>::const_iterator indexItr = m_PresetIndex.find(presetKey);
+		return (indexItr != m_PresetIndex.end()) ? indexItr->second->m_EntityPreset : 0;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,9 +227,11 @@ namespace RTE {
 			return false;
 		}
 		bool entityAdded = false;
-		Entity *existingEntity = GetEntityIfExactType(entityToAdd->GetClassName(), entityToAdd->GetPresetName());
+		PresetKey presetKey(entityToAdd->GetClassName(), entityToAdd->GetPresetName());
+		std::list<PresetEntry>::iterator existingEntry = GetEntityIfExactType(presetKey);
 
-		if (existingEntity) {
+		if (existingEntry != m_PresetList.end()) {
+			Entity *existingEntity = existingEntry->m_EntityPreset;
 			// If we're commanded to overwrite any collisions, then do so by cloning over the existing instance in the list
 			// This way we're not invalidating any instance references that would have been taken out and held by clients
 			if (overwriteSame) {
@@ -242,17 +240,9 @@ namespace RTE {
 				// Make sure the existing one is still marked as the Original Preset
 				existingEntity->m_IsOriginalPreset = true;
 				// Alter the instance entry to reflect the data file location of the new definition
-				if (readFromFile != "Same") {
-					std::list<PresetEntry>::iterator itr = m_PresetList.begin();
-					for (; itr != m_PresetList.end(); ++itr) {
-						// When we find the correct entry, alter its data file location
-						if ((*itr).m_EntityPreset == existingEntity) {
-							(*itr).m_FileReadFrom = readFromFile;
-							break;
-						}
-					}
-					RTEAssert(itr != m_PresetList.end(), "Tried to alter allegedly existing Entity Preset Entry: " + entityToAdd->GetPresetName() + ", but couldn't find it in the list!");
-				}
+				if (readFromFile != "Same") { existingEntry->m_FileReadFrom = readFromFile; }
+				m_GroupIndex.clear();
+				LoadProfiler::AddPresetCreated();
 				return true;
 			} else {
 				return false;
@@ -268,9 +258,12 @@ namespace RTE {
 			}
 
 			m_PresetList.push_back(PresetEntry(entityClone, readFromFile != "Same" ? readFromFile : m_PresetList.back().m_FileReadFrom));
+			m_PresetIndex.emplace(std::move(presetKey), std::prev(m_PresetList.end()));
 			m_EntityList.push_back(entityClone);
 			entityAdded = AddToTypeMap(entityClone);
+			m_GroupIndex.clear();
 			RTEAssert(entityAdded, "Unexpected problem while adding Entity instance \"" + entityToAdd->GetPresetName() + "\" to the type map of data module: " + m_FileName);
+			LoadProfiler::AddPresetCreated();
 		}
 		return entityAdded;
 	}
@@ -287,18 +280,10 @@ namespace RTE {
 				// But I suppose no actual finding is done. Investigate this and see where it's called, maybe this should be changed
 			}
 		} else {
-			std::map<std::string, std::list<std::pair<std::string, Entity *>>>::iterator classItr = m_TypeMap.find(withType);
-			if (classItr != m_TypeMap.end()) {
-				const std::list<std::string> *groupListPtr = 0;
-				// Go through all the entities of that type, adding the groups they belong to
-				for (std::list<std::pair<std::string, Entity *>>::iterator instItr = classItr->second.begin(); instItr != classItr->second.end(); ++instItr) {
-					groupListPtr = instItr->second->GetGroupList();
-					
-					for (std::list<std::string>::const_iterator gItr = groupListPtr->begin(); gItr != groupListPtr->end(); ++gItr) {
-						groupList.push_back(*gItr); // Get the grouped entities, without transferring ownership
-						foundAny = true;
-					}
-				}
+			if (const GroupIndex *groupIndex = GetGroupIndex(withType)) {
+				// The groups all the entities of that type belong to were already gathered when the index was built
+				groupList.insert(groupList.end(), groupIndex->Groups.begin(), groupIndex->Groups.end());
+				foundAny = !groupIndex->Groups.empty();
 
 				// Make sure there are no dupe groups in the list
 				groupList.sort();
@@ -315,21 +300,28 @@ namespace RTE {
 			return false;
 		}
 
-		bool foundAny = false;
+		const GroupMembers *groupMembers = GetGroupMembers(group, type);
+		if (!groupMembers) {
+			return false;
+		}
+		// Get the grouped entities, without transferring ownership
+		entityList.insert(entityList.end(), groupMembers->All.begin(), groupMembers->All.end());
+		return true;
+	}
 
-		// Find either the Entity typelist that contains all entities in this DataModule, or the specific class' typelist (which will get all derived classes too)
-		std::map<std::string, std::list<std::pair<std::string, Entity *>>>::iterator classItr = m_TypeMap.find((type.empty() || type == "All") ? "Entity" : type);
-		
-		if (classItr != m_TypeMap.end()) {
-			RTEAssert(!classItr->second.empty(), "DataModule has class entry without instances in its map!?");
-			for (std::list<std::pair<std::string, Entity *>>::iterator instItr = classItr->second.begin(); instItr != classItr->second.end(); ++instItr) {
-				if (instItr->second->IsInGroup(group)) {
-					entityList.push_back(instItr->second); // Get the grouped entities, without transferring ownership
-					foundAny = true;
-				}
-			}
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const DataModule::GroupMembers * DataModule::GetGroupMembers(const std::string &group, const std::string &type) {
+		// Either the Entity typelist that contains all entities in this DataModule, or the specific class' typelist (which will get all derived classes too)
+		const GroupIndex *groupIndex = GetGroupIndex((type.empty() || type == "All") ? "Entity" : type);
+		// Same as Entity::IsInGroup, everything is in the "Any" and "All" groups and nothing is in the "None" group
+		if (!groupIndex || group == "None") {
+			return nullptr;
+		} else if (group == "Any" || group == "All") {
+			return &groupIndex->AllMembers;
 		}
-		return foundAny;
+		std::unordered_map<std::string, GroupMembers>::const_iterator membersItr = groupIndex->Members.find(group);
+		return (membersItr != groupIndex->Members.end()) ? &membersItr->second : nullptr;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,21 +374,9 @@ namespace RTE {
 	// TODO: This method is almost identical to GetEntityPreset, except it doesn't return a const Entity *. 
 	// Investigate if the latter needs to return const (based on what's using it) and if not, get rid of this and replace its uses. At the very least, consider renaming this
 	// See https://github.com/cortex-command-community/Cortex-Command-Community-Project-Source/issues/87
-	Entity * DataModule::GetEntityIfExactType(const std::string &exactType, const std::string &presetName) {
-		if (exactType.empty() || presetName == "None" || presetName.empty()) {
-			return 0;
-		}
-
-		std::map<std::string, std::list<std::pair<std::string, Entity *>>>::iterator classItr = m_TypeMap.find(exactType);
-		if (classItr != m_TypeMap.end()) {
-			// Find an instance of that EXACT type and name; derived types are not matched
-			for (std::list<std::pair<std::string, Entity *>>::iterator instItr = (*classItr).second.begin(); instItr != (*classItr).second.end(); ++instItr) {
-				if ((*instItr).first == presetName && (*instItr).second->GetClassName() == exactType) {
-					return (*instItr).second;
-				}
-			}
-		}
-		return 0;
+	std::list<DataModule::PresetEntry>::iterator DataModule::GetEntityIfExactType(const PresetKey &presetKey) {
+		std::unordered_map<PresetKey, std::list<PresetEntry>::iterator, PresetKeyHash>::iterator indexItr = m_PresetIndex.find(presetKey);
+		return (indexItr != m_PresetIndex.end()) ? indexItr->second : m_PresetList.end();
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -420,4 +400,39 @@ namespace RTE {
 		}
 		return true;
 	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const DataModule::GroupIndex * DataModule::GetGroupIndex(const std::string &type) {
+		std::unordered_map<std::string, GroupIndex>::iterator indexItr = m_GroupIndex.find(type);
+		if (indexItr != m_GroupIndex.end()) {
+			return &indexItr->second;
+		}
+		std::map<std::string, std::list<std::pair<std::string, Entity *>>>::iterator classItr = m_TypeMap.find(type);
+		if (classItr == m_TypeMap.end()) {
+			return nullptr;
+		}
+		RTEAssert(!classItr->second.empty(), "DataModule has class entry without instances in its map!?");
+
+		// Go through all the entities of that type once, adding each to the members of every group it belongs to
+		GroupIndex &groupIndex = m_GroupIndex[type];
+		for (const std::pair<std::string, Entity *> &instance : classItr->second) {
+			const SceneObject *sceneObject = dynamic_cast<const SceneObject *>(instance.second);
+			bool buyable = sceneObject && sceneObject->IsBuyable() && !instance.second->IsInGroup("Brains");
+
+			groupIndex.AllMembers.All.push_back(instance.second);
+			if (buyable) { groupIndex.AllMembers.Buyable.push_back(instance.second); }
+
+			for (const std::string &group : *instance.second->GetGroupList()) {
+				GroupMembers &groupMembers = groupIndex.Members[group];
+				groupMembers.All.push_back(instance.second);
+				if (buyable) { groupMembers.Buyable.push_back(instance.second); }
+			}
+		}
+		for (const std::pair<const std::string, GroupMembers> &groupMembers : groupIndex.Members) {
+			groupIndex.Groups.push_back(groupMembers.first);
+		}
+		groupIndex.Groups.sort();
+		return &groupIndex;
+	}
 }
\ No newline at end of file
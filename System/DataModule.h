@@ -28,6 +28,34 @@ namespace RTE {
 
 	public:
 
+		/// <summary>
+		/// Identifies a preset by its exact class name and PresetName. The hash of both is computed once when the key is made, so looking it up in several maps doesn't hash the strings again.
+		/// </summary>
+		struct PresetKey {
+			std::string ClassName; //!< The exact class name of the preset.
+			std::string PresetName; //!< The PresetName of the preset.
+			size_t Hash; //!< The combined hash of the class name and PresetName.
+
+			PresetKey(std::string className, std::string presetName) : ClassName(std::move(className)), PresetName(std::move(presetName)) {
+				Hash = std::hash<std::string>()(ClassName);
+				Hash ^= std::hash<std::string>()(PresetName) + 0x9E3779B9 + (Hash << 6) + (Hash >> 2);
+			}
+			bool operator==(const PresetKey &rhs) const { return Hash == rhs.Hash && PresetName == rhs.PresetName && ClassName == rhs.ClassName; }
+		};
+
+		/// <summary>
+		/// Hashes a PresetKey for unordered containers by returning its precomputed hash.
+		/// </summary>
+		struct PresetKeyHash { size_t operator()(const PresetKey &presetKey) const { return presetKey.Hash; } };
+
+		/// <summary>
+		/// The presets of this of some type that are in a group, in the order they were added to this.
+		/// </summary>
+		struct GroupMembers {
+			std::vector<Entity *> All; //!< All the presets of the type in the group. Not owned.
+			std::vector<Entity *> Buyable; //!< The presets of the type in the group that are buyable SceneObjects and not in the "Brains" group. Not owned.
+		};
+
 		SerializableOverrideMethods
 
 #pragma region Creation
@@ -146,7 +174,14 @@ namespace RTE {
 		/// <param name="exactType">The exact type name of the derived Entity instance to get.</param>
 		/// <param name="instance">The instance name of the derived Entity instance.</param>
 		/// <returns>A pointer to the requested Entity instance. 0 if no Entity with that derived type or instance name was found. Ownership is NOT transferred!</returns>
-		const Entity * GetEntityPreset(std::string exactType, std::string instance);
+		const Entity * GetEntityPreset(std::string exactType, std::string instance) { return (exactType.empty() || instance == "None" || instance.empty()) ? nullptr : GetEntityPreset(PresetKey(std::move(exactType), std::move(instance))); }
+
+		/// <summary>
+		/// Gets a previously read in (defined) Entity, by its exact type and instance name. Ownership is NOT transferred!
+		/// </summary>
+		/// <param name="presetKey">The exact type name and instance name of the derived Entity instance to get.</param>
+		/// <returns>A pointer to the requested Entity instance. 0 if no Entity with that derived type or instance name was found. Ownership is NOT transferred!</returns>
+		const Entity * GetEntityPreset(const PresetKey &presetKey) const;
 
 		/// <summary>
 		/// Adds an Entity instance's pointer and name associations to the internal list of already read in Entities. Ownership is NOT transferred!
@@ -177,7 +212,7 @@ namespace RTE {
 		/// Registers the existence of an Entity group in this module.
 		/// </summary>
 		/// <param name="newGroup">The group to register.</param>
-		void RegisterGroup(std::string newGroup) { m_GroupRegister.push_back(newGroup); m_GroupRegister.sort(); m_GroupRegister.unique(); }
+		void RegisterGroup(std::string newGroup) { m_GroupRegister.push_back(newGroup); m_GroupRegister.sort(); m_GroupRegister.unique(); m_GroupIndex.clear(); }
 
 		/// <summary>
 		/// Fills out a list with all groups registered with this that contain any objects of a specific type and it derivatives.
@@ -203,6 +238,15 @@ namespace RTE {
 		/// <param name="type">The name of the least common denominator type of the Entities you want. "All" will look at all types.</param>
 		/// <returns>Whether any Entities were found and added to the list.</returns>
 		bool GetAllOfType(std::list<Entity *> &objectList, std::string type);
+
+		/// <summary>
+		/// Gets the presets of this of a type and its derivatives that are in a group, without copying them anywhere.
+		/// The group index of a type is built the first time it's asked for, and rebuilt after presets or groups are added to this.
+		/// </summary>
+		/// <param name="group">The group to look for.</param>
+		/// <param name="type">The name of the least common denominator type of the Entities you want. "All" will look at all types.</param>
+		/// <returns>The presets of the type in the group, or nullptr if there are none. Only valid until presets or groups are added to this. Ownership is NOT transferred!</returns>
+		const GroupMembers * GetGroupMembers(const std::string &group, const std::string &type);
 #pragma endregion
 
 #pragma region Material Mapping
@@ -282,6 +326,11 @@ namespace RTE {
 		/// </summary>
 		std::list<PresetEntry> m_PresetList;
 
+		/// <summary>
+		/// Map of the exact class name and PresetName of every Entity instance in m_PresetList to its entry there, so a preset can be found without going through the lists of m_TypeMap.
+		/// </summary>
+		std::unordered_map<PresetKey, std::list<PresetEntry>::iterator, PresetKeyHash> m_PresetIndex;
+
 		/// <summary>
 		/// Map of class names and map of instance template names and actual Entity instances that were read for this DataModule.
 		/// An Entity instance of a derived type will be placed in EACH of EVERY of its parent class' maps here.
@@ -290,6 +339,21 @@ namespace RTE {
 		/// </summary>
 		std::map<std::string, std::list<std::pair<std::string, Entity *>>> m_TypeMap;
 
+		/// <summary>
+		/// The presets of some type in each group they're in, and the groups themselves.
+		/// </summary>
+		struct GroupIndex {
+			std::unordered_map<std::string, GroupMembers> Members; //!< The presets of the type in each group.
+			GroupMembers AllMembers; //!< All the presets of the type, which is what looking for the "Any" or "All" groups gets.
+			std::list<std::string> Groups; //!< All the groups the presets of the type are in, sorted.
+		};
+
+		/// <summary>
+		/// The group index of each type asked for so far.
+		/// Cleared whenever presets or groups are added to this, or presets are overwritten, since either can change who's in which group.
+		/// </summary>
+		std::unordered_map<std::string, GroupIndex> m_GroupIndex;
+
 	private:
 
 #pragma region Entity Mapping
@@ -297,10 +361,9 @@ namespace RTE {
 		/// Checks if the type map has an instance added of a specific name and exact type.
 		/// Does not check if any parent types with that name has been added. If found, that instance is returned, otherwise 0.
 		/// </summary>
-		/// <param name="exactType">The exact type name to look for.</param>
-		/// <param name="presetName">The exact PresetName to look for.</param>
-		/// <returns>The found Entity Preset of the exact type and name, if found.</returns>
-		Entity * GetEntityIfExactType(const std::string &exactType, const std::string &presetName);
+		/// <param name="presetKey">The exact type name and PresetName to look for.</param>
+		/// <returns>The entry of the found Entity Preset of the exact type and name in m_PresetList, or the end of m_PresetList if not found.</returns>
+		std::list<PresetEntry>::iterator GetEntityIfExactType(const PresetKey &presetKey);
 
 		/// <summary>
 		/// Adds a newly added preset instance to the type map, where it will end up in every type-list of every class it derived from as well.
@@ -311,6 +374,13 @@ namespace RTE {
 		/// <param name="entityToAdd">The new object instance to add. OWNERSHIP IS NOT TRANSFERRED!</param>
 		/// <returns>Whether the Entity was added successfully or not.</returns>
 		bool AddToTypeMap(Entity *entityToAdd);
+
+		/// <summary>
+		/// Gets the group index of a type, building it from the type map first if it wasn't asked for since it was last cleared.
+		/// </summary>
+		/// <param name="type">The exact name of the type to get the group index of.</param>
+		/// <returns>The group index of the type, or nullptr if this has no presets of the type.</returns>
+		const GroupIndex * GetGroupIndex(const std::string &type);
 #pragma endregion
 
 		/// <summary>
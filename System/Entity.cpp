@@ -14,6 +14,7 @@ namespace RTE {
 	void Entity::Clear() {
 		m_PresetName = "None";
 		m_IsOriginalPreset = false;
+		m_OriginalPreset = nullptr;
 		m_DefinedInModule = -1;
 		m_PresetDescription.clear();
 		m_Groups.clear();
@@ -34,6 +35,7 @@ namespace RTE {
 	int Entity::Create(const Entity &reference) {
 		m_PresetName = reference.m_PresetName;
 		// Note how m_IsOriginalPreset is NOT assigned, automatically indicating that the copy is not an original Preset!
+		m_OriginalPreset = reference.GetOriginalPreset();
 		m_DefinedInModule = reference.m_DefinedInModule;
 		m_PresetDescription = reference.m_PresetDescription;
 
@@ -47,63 +49,65 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	int Entity::ReadProperty(std::string propName, Reader &reader) {
-		if (propName == "CopyOf") {
-			std::string refName = reader.ReadPropValue();
-			std::string className = GetClassName();
-			const Entity *preset = g_PresetMan.GetEntityPreset(className, refName, reader.GetReadModuleID());
-			if (preset) {
-				preset->Clone(this);
-			} else {
-				if (className == "AtomGroup" || className == "Attachable" || className == "AEmitter") {
-					reader.ReportError("The PresetName to be copied was not found in data modules.");
+		static const PropertyReaderMap<Entity> propertyReaders = {
+			{ { "CopyOf" }, [](Entity &entity, Reader &reader) {
+				std::string refName = reader.ReadPropValue();
+				std::string className = entity.GetClassName();
+				const Entity *preset = g_PresetMan.GetEntityPreset(className, refName, reader.GetReadModuleID());
+				if (preset) {
+					preset->Clone(&entity);
+				} else {
+					if (className == "AtomGroup" || className == "Attachable" || className == "AEmitter") {
+						reader.ReportError("The PresetName to be copied was not found in data modules.");
+					}
+					// If we couldn't find the preset to copy from, read it as an original but report the problem in the console
+					g_ConsoleMan.PrintString("ERROR: Couldn't find the preset '" + refName + "' accessed in " + reader.GetCurrentFilePath() + " at line " + reader.GetCurrentFileLineString());
+					// Preset name might have "[ModuleName]/" preceding it, detect it here and select proper module!
+					int slashPos = refName.find_first_of('/');
+					entity.m_PresetName = (slashPos != std::string::npos) ? refName.substr(slashPos + 1) : refName;
+					// Mark this so that the derived class knows it should be added to the PresetMan when it's done reading all properties.
+					entity.m_IsOriginalPreset = true;
+					// Indicate where this was read from
+					entity.m_DefinedInModule = reader.GetReadModuleID();
 				}
-				// If we couldn't find the preset to copy from, read it as an original but report the problem in the console
-				g_ConsoleMan.PrintString("ERROR: Couldn't find the preset '" + refName + "' accessed in " + reader.GetCurrentFilePath() + " at line " + reader.GetCurrentFileLineString());
+			} },
+			{ { "PresetName", "InstanceName" }, [](Entity &entity, Reader &reader) {
+				entity.SetPresetName(reader.ReadPropValue());
 				// Preset name might have "[ModuleName]/" preceding it, detect it here and select proper module!
-				int slashPos = refName.find_first_of('/');
-				m_PresetName = (slashPos != std::string::npos) ? refName.substr(slashPos + 1) : refName;
+				int slashPos = entity.m_PresetName.find_first_of('/');
+				if (slashPos != std::string::npos) { entity.m_PresetName = entity.m_PresetName.substr(slashPos + 1); }
 				// Mark this so that the derived class knows it should be added to the PresetMan when it's done reading all properties.
-				m_IsOriginalPreset = true;
+				entity.m_IsOriginalPreset = true;
 				// Indicate where this was read from
-				m_DefinedInModule = reader.GetReadModuleID();
-			}
-		} else if (propName == "PresetName" || propName == "InstanceName") {
-			SetPresetName(reader.ReadPropValue());
-			// Preset name might have "[ModuleName]/" preceding it, detect it here and select proper module!
-			int slashPos = m_PresetName.find_first_of('/');
-			if (slashPos != std::string::npos) { m_PresetName = m_PresetName.substr(slashPos + 1); }
-			// Mark this so that the derived class knows it should be added to the PresetMan when it's done reading all properties.
-			m_IsOriginalPreset = true;
-			// Indicate where this was read from
-			m_DefinedInModule = reader.GetReadModuleID();
-		} else if (propName == "Description") {
-			std::string descriptionValue = reader.ReadPropValue();
-			if (descriptionValue == "MultiLineText") {
-				m_PresetDescription.clear();
-				while (reader.NextProperty() && reader.ReadPropName() == "AddLine") {
-					m_PresetDescription += reader.ReadPropValue() + "\n\n";
-				}
-				if (!m_PresetDescription.empty()) {
-					m_PresetDescription.resize(m_PresetDescription.size() - 2);
+				entity.m_DefinedInModule = reader.GetReadModuleID();
+			} },
+			{ { "Description" }, [](Entity &entity, Reader &reader) {
+				std::string descriptionValue = reader.ReadPropValue();
+				if (descriptionValue == "MultiLineText") {
+					entity.m_PresetDescription.clear();
+					while (reader.NextProperty() && reader.ReadPropName() == "AddLine") {
+						entity.m_PresetDescription += reader.ReadPropValue() + "\n\n";
+					}
+					if (!entity.m_PresetDescription.empty()) {
+						entity.m_PresetDescription.resize(entity.m_PresetDescription.size() - 2);
+					}
+				} else {
+					entity.m_PresetDescription = descriptionValue;
 				}
-			} else {
-				m_PresetDescription = descriptionValue;
-			}
-		} else if (propName == "RandomWeight") {
-			reader >> m_RandomWeight;
-			m_RandomWeight = Limit(m_RandomWeight, 100, 0);
-		} else if (propName == "AddToGroup") {
-			std::string newGroup;
-			reader >> newGroup;
-			AddToGroup(newGroup);
-			// Do this in AddToGroup instead?
-			g_PresetMan.RegisterGroup(newGroup, reader.GetReadModuleID());
-		} else {
-			// Search for a property name match failed!
-			// TODO: write this out to some log file
-			return Serializable::ReadProperty(propName, reader);
-		}
-		return 0;
+			} },
+			{ { "RandomWeight" }, [](Entity &entity, Reader &reader) {
+				reader >> entity.m_RandomWeight;
+				entity.m_RandomWeight = Limit(entity.m_RandomWeight, 100, 0);
+			} },
+			{ { "AddToGroup" }, [](Entity &entity, Reader &reader) {
+				std::string newGroup;
+				reader >> newGroup;
+				entity.AddToGroup(newGroup);
+				// Do this in AddToGroup instead?
+				g_PresetMan.RegisterGroup(newGroup, reader.GetReadModuleID());
+			} }
+		};
+		return propertyReaders.Read(*this, propName, reader) ? 0 : Serializable::ReadProperty(propName, reader);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -312,6 +312,12 @@ namespace RTE {
 		/// <returns>Whether this Entity was given a new Preset Name upon creation.</returns>
 		bool IsOriginalPreset() const { return m_IsOriginalPreset; }
 
+		/// <summary>
+		/// Gets the original Preset this Entity was created from, without looking it up by name.
+		/// </summary>
+		/// <returns>This if it is an original Preset itself, otherwise the original Preset it was copied from, if any. Ownership is NOT transferred!</returns>
+		const Entity * GetOriginalPreset() const { return m_IsOriginalPreset ? this : m_OriginalPreset; }
+
 		/// <summary>
 		/// Sets IsOriginalPreset flag to indicate that the object should be saved as CopyOf.
 		/// </summary>
@@ -411,6 +417,7 @@ namespace RTE {
 		std::string m_PresetDescription; //!< The description of the preset in user friendly plain text that will show up in menus etc.
 
 		bool m_IsOriginalPreset; //!< Whether this is to be added to the PresetMan as an original preset instance.  
+		const Entity *m_OriginalPreset; //!< The original Preset this was copied from, if any. Not owned.
 		int m_DefinedInModule; //!< The DataModule ID that this was successfully added to at some point. -1 if not added to anything yet.
 
 		//TODO Consider replacing this with an unordered_set. See https://github.com/cortex-command-community/Cortex-Command-Community-Project-Source/issues/88
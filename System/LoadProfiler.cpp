@@ -0,0 +1,214 @@
+#include "LoadProfiler.h"
+
+namespace RTE {
+
+	bool LoadProfiler::s_Profiling = false;
+	std::chrono::steady_clock::time_point LoadProfiler::s_StartTime;
+	std::vector<LoadProfiler::Section> LoadProfiler::s_Sections;
+	std::vector<int> LoadProfiler::s_OpenSections;
+	size_t LoadProfiler::s_TotalBytesRead = 0;
+	unsigned int LoadProfiler::s_TotalPresetsCreated = 0;
+	unsigned int LoadProfiler::s_TotalImagesDecoded = 0;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void LoadProfiler::Start() {
+		s_Sections.clear();
+		s_OpenSections.clear();
+		s_TotalBytesRead = 0;
+		s_TotalPresetsCreated = 0;
+		s_TotalImagesDecoded = 0;
+		s_StartTime = std::chrono::steady_clock::now();
+		s_Profiling = true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	std::string LoadProfiler::Finish() {
+		if (!s_Profiling) {
+			return std::string();
+		}
+		// Anything still open is cut off here, so it at least shows up with the time it took so far
+		while (!s_OpenSections.empty()) {
+			EndSection(s_OpenSections.back());
+		}
+		long long totalTime = GetElapsedTime();
+		s_Profiling = false;
+
+		bool filesWritten = WriteReport(totalTime) && WriteTrace();
+
+		char summary[512];
+		std::snprintf(summary, sizeof(summary), "Loading took %.2f s, read %.1f MB, created %u presets and decoded %u images.", static_cast<double>(totalTime) / 1000000.0, static_cast<double>(s_TotalBytesRead) / (1024.0 * 1024.0), s_TotalPresetsCreated, s_TotalImagesDecoded);
+
+		s_Sections.clear();
+		s_OpenSections.clear();
+		return std::string(summary) + (filesWritten ? " Profile written to " + std::string(c_ReportFilePath) + " and " + c_TraceFilePath + "." : " Failed to write the profile!");
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int LoadProfiler::BeginSection(SectionType sectionType, const std::string &sectionName) {
+		if (!s_Profiling) {
+			return -1;
+		}
+		Section &section = s_Sections.emplace_back();
+		section.Type = sectionType;
+		section.Name = sectionName;
+		section.Parent = s_OpenSections.empty() ? -1 : s_OpenSections.back();
+		section.StartTime = GetElapsedTime();
+		section.Duration = 0;
+		section.ChildDuration = 0;
+		section.BytesRead = 0;
+		section.PresetsCreated = 0;
+		section.ImagesDecoded = 0;
+		section.Open = true;
+
+		int sectionIndex = static_cast<int>(s_Sections.size() - 1);
+		s_OpenSections.push_back(sectionIndex);
+		return sectionIndex;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void LoadProfiler::EndSection(int sectionIndex) {
+		if (!s_Profiling || sectionIndex < 0 || sectionIndex >= static_cast<int>(s_Sections.size()) || !s_Sections[sectionIndex].Open) {
+			return;
+		}
+		Section &section = s_Sections[sectionIndex];
+		section.Duration = GetElapsedTime() - section.StartTime;
+		section.Open = false;
+		if (section.Parent >= 0) { s_Sections[section.Parent].ChildDuration += section.Duration; }
+
+		s_OpenSections.erase(std::find(s_OpenSections.begin(), s_OpenSections.end(), sectionIndex));
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void LoadProfiler::AddToOpenSections(size_t byteCount, unsigned int presetCount, unsigned int imageCount) {
+		for (int sectionIndex : s_OpenSections) {
+			Section &section = s_Sections[sectionIndex];
+			section.BytesRead += byteCount;
+			section.PresetsCreated += presetCount;
+			section.ImagesDecoded += imageCount;
+		}
+		s_TotalBytesRead += byteCount;
+		s_TotalPresetsCreated += presetCount;
+		s_TotalImagesDecoded += imageCount;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool LoadProfiler::WriteReport(long long totalTime) {
+		struct ReportEntry {
+			std::string Name;
+			unsigned int Count = 0;
+			long long Duration = 0;
+			long long SelfDuration = 0;
+			size_t BytesRead = 0;
+			unsigned int PresetsCreated = 0;
+			unsigned int ImagesDecoded = 0;
+		};
+
+		std::ofstream reportFile(c_ReportFilePath, std::ios::trunc);
+		if (!reportFile.good()) {
+			return false;
+		}
+		char line[1024];
+		std::snprintf(line, sizeof(line), "Loading took %.3f s, read %zu bytes, created %u presets and decoded %u images.\n", static_cast<double>(totalTime) / 1000000.0, s_TotalBytesRead, s_TotalPresetsCreated, s_TotalImagesDecoded);
+		reportFile << line;
+		reportFile << "Total times and counts include everything done in the sections started during them, like the data files read while loading a data module. Self times leave those sections out.\n";
+
+		for (int type = 0; type < SectionTypeCount; ++type) {
+			// Sections of the same name are summed up, since the same file can be read or run more than once
+			std::unordered_map<std::string, ReportEntry> entriesByName;
+			long long typeSelfDuration = 0;
+			for (const Section &section : s_Sections) {
+				if (section.Type != type) {
+					continue;
+				}
+				ReportEntry &entry = entriesByName[section.Name];
+				entry.Name = section.Name;
+				entry.Count++;
+				entry.Duration += section.Duration;
+				entry.SelfDuration += section.Duration - section.ChildDuration;
+				entry.BytesRead += section.BytesRead;
+				entry.PresetsCreated += section.PresetsCreated;
+				entry.ImagesDecoded += section.ImagesDecoded;
+				typeSelfDuration += section.Duration - section.ChildDuration;
+			}
+			std::vector<ReportEntry> entries;
+			entries.reserve(entriesByName.size());
+			for (const auto &[entryName, entry] : entriesByName) {
+				entries.emplace_back(entry);
+			}
+			std::sort(entries.begin(), entries.end(), [](const ReportEntry &lhs, const ReportEntry &rhs) { return lhs.Duration > rhs.Duration || (lhs.Duration == rhs.Duration && lhs.Name < rhs.Name); });
+
+			std::snprintf(line, sizeof(line), "\n%s: %zu, %.3f s of self time, slowest first\n", GetSectionTypeName(static_cast<SectionType>(type)), entries.size(), static_cast<double>(typeSelfDuration) / 1000000.0);
+			reportFile << line;
+			std::snprintf(line, sizeof(line), "%12s %12s %6s %12s %8s %8s  %s\n", "Total ms", "Self ms", "Count", "Bytes", "Presets", "Images", "Name");
+			reportFile << line;
+			for (const ReportEntry &entry : entries) {
+				std::snprintf(line, sizeof(line), "%12.3f %12.3f %6u %12zu %8u %8u  ", static_cast<double>(entry.Duration) / 1000.0, static_cast<double>(entry.SelfDuration) / 1000.0, entry.Count, entry.BytesRead, entry.PresetsCreated, entry.ImagesDecoded);
+				reportFile << line << entry.Name << "\n";
+			}
+		}
+		reportFile.close();
+		return !reportFile.fail();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool LoadProfiler::WriteTrace() {
+		std::ofstream traceFile(c_TraceFilePath, std::ios::trunc);
+		if (!traceFile.good()) {
+			return false;
+		}
+		traceFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		for (size_t i = 0; i < s_Sections.size(); ++i) {
+			const Section &section = s_Sections[i];
+			// Complete events on a single thread, which the trace viewers stack by their start times and durations
+			traceFile << (i == 0 ? "\n" : ",\n") << "{\"name\":\"" << EscapeJSONString(section.Name) << "\",\"cat\":\"" << GetSectionTypeName(section.Type) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << section.StartTime << ",\"dur\":" << section.Duration;
+			traceFile << ",\"args\":{\"bytes\":" << section.BytesRead << ",\"presets\":" << section.PresetsCreated << ",\"images\":" << section.ImagesDecoded << "}}";
+		}
+		traceFile << "\n]}\n";
+		traceFile.close();
+		return !traceFile.fail();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	const char * LoadProfiler::GetSectionTypeName(SectionType sectionType) {
+		switch (sectionType) {
+			case DataModuleSection:
+				return "Data Modules";
+			case DataFileSection:
+				return "Data Files";
+			case ImageSection:
+				return "Images";
+			case LuaScriptSection:
+				return "Lua Scripts";
+			default:
+				return "Other";
+		}
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	std::string LoadProfiler::EscapeJSONString(const std::string &stringToEscape) {
+		std::string escapedString;
+		escapedString.reserve(stringToEscape.size());
+		for (char character : stringToEscape) {
+			if (character == '"' || character == '\\') {
+				escapedString += '\\';
+				escapedString += character;
+			} else if (static_cast<unsigned char>(character) < 0x20) {
+				char escapedCharacter[8];
+				std::snprintf(escapedCharacter, sizeof(escapedCharacter), "\\u%04x", static_cast<unsigned int>(character));
+				escapedString += escapedCharacter;
+			} else {
+				escapedString += character;
+			}
+		}
+		return escapedString;
+	}
+}
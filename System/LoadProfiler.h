@@ -0,0 +1,145 @@
+#ifndef _RTELOADPROFILER_
+#define _RTELOADPROFILER_
+
+#include <chrono>
+
+namespace RTE {
+
+	/// <summary>
+	/// Measures where the time goes while the DataModules are loaded, by timing sections of the loading (modules, data files, images, Lua scripts) and counting what each of them read and created.
+	/// Writes a report sorted by time and a trace that can be opened in Chrome's tracing tools once loading is done. Everything is a no-op unless profiling was started.
+	/// </summary>
+	class LoadProfiler {
+
+	public:
+
+		/// <summary>
+		/// The kinds of loading sections that are timed.
+		/// </summary>
+		enum SectionType { DataModuleSection, DataFileSection, ImageSection, LuaScriptSection, SectionTypeCount };
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Starts profiling, discarding anything profiled before.
+		/// </summary>
+		static void Start();
+
+		/// <summary>
+		/// Stops profiling and writes the report and the trace of everything profiled since it was started.
+		/// </summary>
+		/// <returns>A one line summary of the profile, for the loading progress report.</returns>
+		static std::string Finish();
+
+		/// <summary>
+		/// Gets whether loading is being profiled.
+		/// </summary>
+		/// <returns>Whether loading is being profiled.</returns>
+		static bool IsProfiling() { return s_Profiling; }
+#pragma endregion
+
+#pragma region Sections
+		/// <summary>
+		/// Starts timing a section of the loading. Sections started while this one is open are counted as part of it.
+		/// </summary>
+		/// <param name="sectionType">The kind of section.</param>
+		/// <param name="sectionName">The name of the section, usually the path of what's being loaded.</param>
+		/// <returns>The index of the section to end it with, or -1 if loading isn't being profiled.</returns>
+		static int BeginSection(SectionType sectionType, const std::string &sectionName);
+
+		/// <summary>
+		/// Stops timing a section of the loading. Sections don't have to be ended in the reverse order they were started.
+		/// </summary>
+		/// <param name="sectionIndex">The index of the section, as returned by BeginSection. Nothing is done if it's -1.</param>
+		static void EndSection(int sectionIndex);
+#pragma endregion
+
+#pragma region Counters
+		/// <summary>
+		/// Counts bytes read from disk towards every open section.
+		/// </summary>
+		/// <param name="byteCount">The number of bytes read.</param>
+		static void AddBytesRead(size_t byteCount) { if (s_Profiling) { AddToOpenSections(byteCount, 0, 0); } }
+
+		/// <summary>
+		/// Counts a preset added to a DataModule towards every open section.
+		/// </summary>
+		static void AddPresetCreated() { if (s_Profiling) { AddToOpenSections(0, 1, 0); } }
+
+		/// <summary>
+		/// Counts a decoded image towards every open section.
+		/// </summary>
+		static void AddImageDecoded() { if (s_Profiling) { AddToOpenSections(0, 0, 1); } }
+#pragma endregion
+
+	private:
+
+		/// <summary>
+		/// A timed section of the loading, along with what was read and created during it.
+		/// </summary>
+		struct Section {
+			SectionType Type; //!< The kind of section.
+			std::string Name; //!< The name of the section.
+			int Parent; //!< The index of the section that was the innermost open one when this started, or -1 if there was none.
+			long long StartTime; //!< When the section started, in microseconds since profiling started.
+			long long Duration; //!< How long the section took in microseconds.
+			long long ChildDuration; //!< How much of the duration was spent in sections started while this one was the innermost open one.
+			size_t BytesRead; //!< The number of bytes read from disk during the section.
+			unsigned int PresetsCreated; //!< The number of presets added to DataModules during the section.
+			unsigned int ImagesDecoded; //!< The number of images decoded during the section.
+			bool Open; //!< Whether the section hasn't ended yet.
+		};
+
+		static constexpr const char *c_ReportFilePath = "LogLoadingProfile.txt"; //!< The path of the report file written when profiling finishes.
+		static constexpr const char *c_TraceFilePath = "LogLoadingProfile.json"; //!< The path of the trace file written when profiling finishes.
+
+		static bool s_Profiling; //!< Whether loading is being profiled.
+		static std::chrono::steady_clock::time_point s_StartTime; //!< When profiling started.
+		static std::vector<Section> s_Sections; //!< Every section profiled since profiling started, in the order they started.
+		static std::vector<int> s_OpenSections; //!< The indices of the sections that haven't ended yet, innermost last.
+		static size_t s_TotalBytesRead; //!< The number of bytes read from disk since profiling started, including outside of any section.
+		static unsigned int s_TotalPresetsCreated; //!< The number of presets added to DataModules since profiling started, including outside of any section.
+		static unsigned int s_TotalImagesDecoded; //!< The number of images decoded since profiling started, including outside of any section.
+
+		/// <summary>
+		/// Gets the time since profiling started.
+		/// </summary>
+		/// <returns>The time since profiling started in microseconds.</returns>
+		static long long GetElapsedTime() { return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_StartTime).count(); }
+
+		/// <summary>
+		/// Adds to the counters of every open section and to the totals.
+		/// </summary>
+		/// <param name="byteCount">The number of bytes read.</param>
+		/// <param name="presetCount">The number of presets created.</param>
+		/// <param name="imageCount">The number of images decoded.</param>
+		static void AddToOpenSections(size_t byteCount, unsigned int presetCount, unsigned int imageCount);
+
+		/// <summary>
+		/// Writes the report of the profiled sections, with the sections of each kind summed up by name and sorted by time, slowest first.
+		/// </summary>
+		/// <param name="totalTime">The time from when profiling started until it finished, in microseconds.</param>
+		/// <returns>Whether the report file was written.</returns>
+		static bool WriteReport(long long totalTime);
+
+		/// <summary>
+		/// Writes every profiled section to a trace file in the Chrome trace event format.
+		/// </summary>
+		/// <returns>Whether the trace file was written.</returns>
+		static bool WriteTrace();
+
+		/// <summary>
+		/// Gets the name of a kind of section, as shown in the report and the trace.
+		/// </summary>
+		/// <param name="sectionType">The kind of section.</param>
+		/// <returns>The name of the kind of section.</returns>
+		static const char * GetSectionTypeName(SectionType sectionType);
+
+		/// <summary>
+		/// Escapes a string so it can be written inside a JSON string.
+		/// </summary>
+		/// <param name="stringToEscape">The string to escape.</param>
+		/// <returns>The escaped string.</returns>
+		static std::string EscapeJSONString(const std::string &stringToEscape);
+	};
+}
+#endif
@@ -0,0 +1,89 @@
+#include "MappedFile.h"
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace RTE {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void MappedFile::Clear() {
+		m_Data = nullptr;
+		m_Size = 0;
+		m_Open = false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int MappedFile::Create(const std::string &filePath) {
+#ifdef _WIN32
+		HANDLE fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE) {
+			return -1;
+		}
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize)) {
+			CloseHandle(fileHandle);
+			return -1;
+		}
+		m_Size = static_cast<size_t>(fileSize.QuadPart);
+		if (m_Size > 0) {
+			// The view keeps the mapping and the file open by itself, so the handles can be closed right away
+			HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mappingHandle) {
+				m_Data = static_cast<const char *>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+				CloseHandle(mappingHandle);
+			}
+		}
+		CloseHandle(fileHandle);
+#else
+		int fileDescriptor = open(filePath.c_str(), O_RDONLY);
+		if (fileDescriptor == -1) {
+			return -1;
+		}
+		struct stat fileStatus;
+		if (fstat(fileDescriptor, &fileStatus) == -1 || !S_ISREG(fileStatus.st_mode)) {
+			close(fileDescriptor);
+			return -1;
+		}
+		m_Size = static_cast<size_t>(fileStatus.st_size);
+		if (m_Size > 0) {
+			// The mapping keeps the file open by itself, so the descriptor can be closed right away
+			void *mappedData = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (mappedData != MAP_FAILED) {
+				madvise(mappedData, m_Size, MADV_SEQUENTIAL);
+				m_Data = static_cast<const char *>(mappedData);
+			}
+		}
+		close(fileDescriptor);
+#endif
+		if (m_Size == 0) {
+			m_Data = "";
+		} else if (!m_Data) {
+			Clear();
+			return -1;
+		}
+		m_Open = true;
+		return 0;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void MappedFile::Destroy() {
+		if (m_Open && m_Size > 0) {
+#ifdef _WIN32
+			UnmapViewOfFile(m_Data);
+#else
+			munmap(const_cast<char *>(m_Data), m_Size);
+#endif
+		}
+		Clear();
+	}
+}
@@ -0,0 +1,81 @@
+#ifndef _RTEMAPPEDFILE_
+#define _RTEMAPPEDFILE_
+
+namespace RTE {
+
+	/// <summary>
+	/// A read-only view of a whole file mapped into memory, so its contents can be read in place without copying them through a stream.
+	/// </summary>
+	class MappedFile {
+
+	public:
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate a MappedFile object in system memory. Create() should be called before using the object.
+		/// </summary>
+		MappedFile() { Clear(); }
+
+		/// <summary>
+		/// Constructor method used to instantiate a MappedFile object in system memory and make it ready for use.
+		/// </summary>
+		/// <param name="filePath">The path of the file to map.</param>
+		explicit MappedFile(const std::string &filePath) { Clear(); Create(filePath); }
+
+		/// <summary>
+		/// Makes the MappedFile object ready for use by mapping the file into memory.
+		/// </summary>
+		/// <param name="filePath">The path of the file to map.</param>
+		/// <returns>An error return value signaling success or any particular failure. Anything below 0 is an error signal.</returns>
+		int Create(const std::string &filePath);
+#pragma endregion
+
+#pragma region Destruction
+		/// <summary>
+		/// Destructor method used to clean up a MappedFile object before deletion from system memory.
+		/// </summary>
+		~MappedFile() { Destroy(); }
+
+		/// <summary>
+		/// Unmaps the file and resets (through Clear()) the MappedFile object.
+		/// </summary>
+		void Destroy();
+#pragma endregion
+
+#pragma region Getters
+		/// <summary>
+		/// Gets whether the file was opened and mapped successfully.
+		/// </summary>
+		/// <returns>Whether the file is mapped.</returns>
+		bool IsOpen() const { return m_Open; }
+
+		/// <summary>
+		/// Gets the contents of the file. Stays valid until this MappedFile is destroyed.
+		/// </summary>
+		/// <returns>A pointer to the first byte of the file, which is not null-terminated. Null if the file isn't mapped.</returns>
+		const char * GetData() const { return m_Data; }
+
+		/// <summary>
+		/// Gets the size of the file.
+		/// </summary>
+		/// <returns>The size of the file in bytes.</returns>
+		size_t GetSize() const { return m_Size; }
+#pragma endregion
+
+	private:
+
+		const char *m_Data; //!< The mapped contents of the file, or an empty string if the file is empty, since empty files can't be mapped.
+		size_t m_Size; //!< The size of the file in bytes.
+		bool m_Open; //!< Whether the file was opened and mapped successfully.
+
+		/// <summary>
+		/// Clears all the member variables of this MappedFile, effectively resetting the members of this abstraction level only.
+		/// </summary>
+		void Clear();
+
+		// Disallow the use of some implicit methods.
+		MappedFile(const MappedFile &reference) = delete;
+		MappedFile & operator=(const MappedFile &rhs) = delete;
+	};
+}
+#endif
@@ -0,0 +1,143 @@
+#ifndef _RTENETWORKFRAMEDECODING_
+#define _RTENETWORKFRAMEDECODING_
+
+#include "Constants.h"
+#include "NetworkMessages.h"
+
+#include <lz4.h>
+#include <unordered_map>
+
+namespace RTE {
+
+	/// <summary>
+	/// The frame number of the content each received box of a layer currently holds, keyed by box position.
+	/// </summary>
+	typedef std::unordered_map<unsigned int, unsigned short> ReceivedBoxFrameNumbers;
+
+	/// <summary>
+	/// The outcomes of validating a received frame box message.
+	/// </summary>
+	enum class FrameBoxValidation { Accepted, Malformed, Stale, MissingReference };
+
+	/// <summary>
+	/// Checks that a received frame line message is complete and fits a pixel buffer, so it can be decoded with DecodeFrameLine.
+	/// </summary>
+	/// <param name="frameData">The frame line message, followed by its pixel data.</param>
+	/// <param name="messageSize">The size of the whole received message, in bytes.</param>
+	/// <param name="height">The height of the pixel buffer the line would be decoded into.</param>
+	/// <returns>Whether the message can be decoded.</returns>
+	inline bool IsFrameLineValid(const MsgFrameLine *frameData, size_t messageSize, int height) {
+		return messageSize >= sizeof(MsgFrameLine) && frameData->Layer <= 1 && frameData->LineNumber < height && frameData->DataSize <= messageSize - sizeof(MsgFrameLine);
+	}
+
+	/// <summary>
+	/// Checks that a received frame box message is complete, lies within a pixel buffer and can be applied to what was received of the box so far.
+	/// Accepted boxes are recorded as the box's current content, so this has to be called in the order the boxes were received, before they're handed to any decoder.
+	/// </summary>
+	/// <param name="frameData">The frame box message, followed by its pixel data.</param>
+	/// <param name="messageSize">The size of the whole received message, in bytes.</param>
+	/// <param name="width">The width of the pixel buffers of both layers.</param>
+	/// <param name="height">The height of the pixel buffers of both layers.</param>
+	/// <param name="receivedBoxFrameNumbers">The frame numbers of the boxes received so far, for each of the two layers.</param>
+	/// <returns>Whether the box was accepted, or why it has to be dropped.</returns>
+	inline FrameBoxValidation ValidateFrameBox(const MsgFrameBox *frameData, size_t messageSize, int width, int height, ReceivedBoxFrameNumbers (&receivedBoxFrameNumbers)[2]) {
+		if (messageSize < sizeof(MsgFrameBox) || frameData->Layer > 1 || frameData->DataSize > messageSize - sizeof(MsgFrameBox)) {
+			return FrameBoxValidation::Malformed;
+		}
+		int bpx = frameData->BoxX;
+		int bpy = frameData->BoxY;
+		if (bpx + frameData->BoxWidth > width || bpy + frameData->BoxHeight > height || frameData->UncompressedSize > c_MaxPixelLineBufferSize || (frameData->DataSize > 0 && frameData->UncompressedSize != frameData->BoxWidth * frameData->BoxHeight)) {
+			return FrameBoxValidation::Malformed;
+		}
+		unsigned short &boxFrameNumber = receivedBoxFrameNumbers[frameData->Layer][(static_cast<unsigned int>(bpy) << 16) | static_cast<unsigned int>(bpx)];
+
+		// Boxes aren't sequenced when delta compressed, so one that was overtaken by a newer version of itself would put back stale content
+		if (boxFrameNumber != 0 && static_cast<short>(frameData->BoxFrameNumber - boxFrameNumber) <= 0) {
+			return FrameBoxValidation::Stale;
+		}
+		// A delta made against content we never received (e.g. because the packet was lost) would corrupt the box. The server sends lost boxes again in full
+		if (frameData->ReferenceFrameNumber != 0 && boxFrameNumber != frameData->ReferenceFrameNumber) {
+			return FrameBoxValidation::MissingReference;
+		}
+		boxFrameNumber = frameData->BoxFrameNumber;
+		return FrameBoxValidation::Accepted;
+	}
+
+	/// <summary>
+	/// Unpacks a frame line message into an 8bpp pixel buffer. Kept free of any drawing so the game client and the headless load test client decode frames the same way. The line has to pass IsFrameLineValid beforehand.
+	/// </summary>
+	/// <param name="frameData">The frame line message, followed by its pixel data.</param>
+	/// <param name="lines">Pointers to the start of each line of the pixel buffer, e.g. the line array of an Allegro bitmap.</param>
+	/// <param name="width">The width of the pixel buffer.</param>
+	/// <param name="height">The height of the pixel buffer.</param>
+	inline void DecodeFrameLine(const MsgFrameLine *frameData, unsigned char **lines, int width, int height) {
+		int lineNumber = frameData->LineNumber;
+		if (lineNumber >= height) {
+			return;
+		}
+		const unsigned char *lineData = reinterpret_cast<const unsigned char *>(frameData) + sizeof(MsgFrameLine);
+
+		if (frameData->DataSize == 0) {
+			memset(lines[lineNumber], g_MaskColor, width);
+		} else if (frameData->DataSize == frameData->UncompressedSize) {
+			int pixels = std::min(width, static_cast<int>(frameData->DataSize));
+#ifdef _WIN32
+			memcpy_s(lines[lineNumber], width, lineData, pixels);
+#else
+			//Fallback to non safe memcpy
+			memcpy(lines[lineNumber], lineData, pixels);
+#endif
+		} else {
+			LZ4_decompress_safe((const char *)lineData, (char *)lines[lineNumber], frameData->DataSize, width);
+		}
+	}
+
+	/// <summary>
+	/// Unpacks a frame box message into an 8bpp pixel buffer, either replacing the box's content or applying a delta on top of it. The box has to be accepted by ValidateFrameBox beforehand.
+	/// </summary>
+	/// <param name="frameData">The frame box message, followed by its pixel data.</param>
+	/// <param name="lines">Pointers to the start of each line of the pixel buffer, e.g. the line array of an Allegro bitmap.</param>
+	inline void DecodeFrameBox(const MsgFrameBox *frameData, unsigned char **lines) {
+		int bpx = frameData->BoxX;
+		int bpy = frameData->BoxY;
+		int maxWidth = frameData->BoxWidth;
+		int maxHeight = frameData->BoxHeight;
+
+		if (frameData->DataSize == 0) {
+			for (int y = 0; y < maxHeight; y++) {
+				memset(lines[bpy + y] + bpx, g_MaskColor, maxWidth);
+			}
+			return;
+		}
+
+		// Each decoder needs its own buffer
+		unsigned char boxBuffer[c_MaxPixelLineBufferSize];
+		const unsigned char *boxData = reinterpret_cast<const unsigned char *>(frameData) + sizeof(MsgFrameBox);
+
+		if (frameData->DataSize == frameData->UncompressedSize) {
+			memcpy(boxBuffer, boxData, frameData->DataSize);
+		} else {
+			LZ4_decompress_safe((const char *)boxData, (char *)boxBuffer, frameData->DataSize, frameData->UncompressedSize);
+		}
+
+		// Copy box to the buffer line by line, or apply it on top of the existing content if it's a delta
+		bool isDelta = frameData->ReferenceFrameNumber != 0;
+		const unsigned char *lineAddr = boxBuffer;
+		for (int y = 0; y < maxHeight; y++) {
+			if (isDelta) {
+				unsigned char *dest = lines[bpy + y] + bpx;
+				for (int x = 0; x < maxWidth; x++) {
+					dest[x] ^= lineAddr[x];
+				}
+			} else {
+#ifdef _WIN32
+				memcpy_s(lines[bpy + y] + bpx, maxWidth, lineAddr, maxWidth);
+#else
+				memcpy(lines[bpy + y] + bpx, lineAddr, maxWidth);
+#endif
+			}
+			lineAddr += maxWidth;
+		}
+	}
+}
+#endif
@@ -30,7 +30,10 @@ namespace RTE {
 		ID_SRV_TERRAIN,
 		ID_SRV_POST_EFFECTS,
 		ID_SRV_SOUND_EVENTS,
-		ID_SRV_MUSIC_EVENTS
+		ID_SRV_MUSIC_EVENTS,
+		ID_SRV_ENTITY_PRESET,
+		ID_SRV_ENTITY_STATES,
+		ID_SRV_INPUT_OVERLAY
 	};
 
 // Pack the structs so 1 byte members are exactly 1 byte in memory instead of being aligned by 4 bytes (padding) so the correct representation is sent over the network without empty bytes consumed by alignment.
@@ -135,6 +138,9 @@ namespace RTE {
 		unsigned char BoxHeight;
 		unsigned short int DataSize;
 		unsigned short int UncompressedSize;
+
+		unsigned short int BoxFrameNumber;
+		unsigned short int ReferenceFrameNumber;
 	};
 
 	/// <summary>
@@ -188,6 +194,7 @@ namespace RTE {
 		short int Width;
 		short int Height;
 		bool SceneWrapsX;
+		bool ReplicateEntities;
 
 		short int BackgroundLayerCount;
 		LightweightSceneLayer BackgroundLayers[c_MaxLayersStoredForNetwork];
@@ -222,20 +229,26 @@ namespace RTE {
 	};
 
 	/// <summary>
-	/// 
+	/// The terrain changes of a frame, as run-length encoded tiles compressed together. Followed by TileCount TerrainTileNetworkData records.
 	/// </summary>
 	struct MsgTerrainChange {
 		unsigned char Id;
+		unsigned char SceneId;
+		unsigned short int TileCount;
+		unsigned int DataSize;
+		unsigned int UncompressedSize;
+	};
 
+	/// <summary>
+	/// A changed terrain tile. Followed by RunCount runs of a length byte and a color byte, covering the tile row by row. Runs don't cross rows.
+	/// </summary>
+	struct TerrainTileNetworkData {
 		unsigned short int X;
 		unsigned short int Y;
-		unsigned short int W;
-		unsigned short int H;
+		unsigned char Width;
+		unsigned char Height;
 		bool Back;
-		unsigned char Color;
-		unsigned char SceneId;
-		unsigned short int DataSize;
-		unsigned short int UncompressedSize;
+		unsigned short int RunCount;
 	};
 
 	/// <summary>
@@ -276,12 +289,101 @@ namespace RTE {
 		int MusicEventsCount;
 	};
 
+	/// <summary>
+	/// Maps a network preset ID to the preset replicated entities are drawn with, so the client can look it up in its own loaded data modules.
+	/// </summary>
+	struct MsgEntityPreset {
+		unsigned char Id;
+
+		unsigned short int PresetID;
+		int ModuleID;
+		char ClassName[64];
+		char PresetName[128];
+	};
+
+	/// <summary>
+	/// The state of a single replicated entity. RotAngle is in Allegro angle units and Scale is in 64ths. For pixel entities the PresetID is c_PixelEntityPresetID and Frame holds the color index.
+	/// </summary>
+	struct EntityStateNetworkData {
+		unsigned int UniqueID;
+		unsigned short int PresetID;
+		short int PosX;
+		short int PosY;
+		unsigned char RotAngle;
+		unsigned char Scale;
+		unsigned short int Frame;
+		bool HFlipped;
+	};
+
+	/// <summary>
+	/// Header of a chunk of a frame's replicated entity states. The EntityStateNetworkData entries follow it.
+	/// </summary>
+	struct MsgEntityStates {
+		unsigned char Id;
+		unsigned char FrameNumber;
+		unsigned short int StateFrameNumber;
+		unsigned short int TotalEntityCount;
+		unsigned short int EntityCount;
+	};
+
+	/// <summary>
+	/// A slice of a player's open pie menu, so the client can tell which slice its own cursor input points at. Angles are in radians.
+	/// </summary>
+	struct PieSliceNetworkData {
+		float AreaStart;
+		float AreaArc;
+		bool Enabled;
+	};
+
+	/// <summary>
+	/// The state of the input-driven overlays of a player's view, sent beside each frame setup. Clients draw the aim reticle and the pie menu cursor themselves, from their own input on top of this state,
+	/// so they show no latency. InputSequence is the last input message whose mouse movement AnalogAim includes, anything the client sent after it is predicted on top.
+	/// Positions are in scene coordinates and angles in radians.
+	/// </summary>
+	struct MsgInputOverlay {
+		unsigned char Id;
+		unsigned char FrameNumber;
+
+		unsigned int InputSequence;
+		float AnalogAimX;
+		float AnalogAimY;
+		float MouseTrapRadius;
+
+		bool AimFlipped;
+		float AimAngle;
+		float AimRange;
+
+		bool AimReticleVisible;
+		short int AimDevicePosX;
+		short int AimDevicePosY;
+		float AimDeviceRotation;
+		float MuzzleOffsetX;
+		float MuzzleOffsetY;
+		float SharpLength;
+
+		bool ScrollLeadVisible;
+		float ScrollLeadLength;
+		float ScrollSpeed;
+
+		bool PieMenuVisible;
+		bool PieCursorPointing;
+		short int PieCenterX;
+		short int PieCenterY;
+		unsigned char PieInnerRadius;
+		unsigned char PieThickness;
+		float PieCursorAngle;
+		unsigned char PieSliceCount;
+		PieSliceNetworkData PieSlices[c_MaxPieSlicesForNetwork];
+	};
+
 	/// <summary>
 	/// 
 	/// </summary>
 	struct MsgInput {
 		unsigned char Id;
 
+		unsigned int InputSequence;
+
 		int MouseX;
 		int MouseY;
 		bool MouseButtonPressed[MAX_MOUSE_BUTTONS];
@@ -0,0 +1,219 @@
+#include "PresetCache.h"
+#include "Constants.h"
+#include "LoadProfiler.h"
+#include "SettingsMan.h"
+#include "System.h"
+
+namespace RTE {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PresetCache::Clear() {
+		m_ModuleName.clear();
+		m_CacheFilePath.clear();
+		m_ExecutableStamp.clear();
+		m_ModuleIniFiles.clear();
+		m_ContributingFiles.clear();
+		m_Data.clear();
+		m_ReplayPosition = 0;
+		m_LastRecordedFilePath.clear();
+		m_LastRecordedLine = 0;
+		m_Recording = false;
+		m_Replaying = false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int PresetCache::Create(const std::string &moduleName) {
+		if (!g_SettingsMan.UsePresetCache()) {
+			return 0;
+		}
+		// A different executable may read the same files differently, so without knowing which one made the recording it can't be trusted
+		ContributingFile executableStamp;
+		if (!GetFileStamp(g_System.GetExecutablePath(), executableStamp)) {
+			return 0;
+		}
+		m_ExecutableStamp = std::string(c_GameVersion) + "|" + std::to_string(executableStamp.FileSize) + "|" + std::to_string(executableStamp.WriteTime);
+
+		m_ModuleName = moduleName;
+		m_CacheFilePath = std::string(c_PresetCacheDirectory) + "/" + moduleName + ".bin";
+
+		std::error_code errorCode;
+		for (std::filesystem::directory_iterator fileItr(moduleName, errorCode), endItr; !errorCode && fileItr != endItr; fileItr.increment(errorCode)) {
+			if (fileItr->path().extension() == ".ini") { m_ModuleIniFiles.emplace_back(fileItr->path().filename().generic_string()); }
+		}
+		std::sort(m_ModuleIniFiles.begin(), m_ModuleIniFiles.end());
+
+		m_Replaying = Load();
+		m_Recording = !m_Replaying;
+		return 0;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool PresetCache::Load() {
+		std::ifstream cacheFile(m_CacheFilePath, std::ios::binary);
+		if (!cacheFile.good()) {
+			return false;
+		}
+		m_Data.assign(std::istreambuf_iterator<char>(cacheFile), std::istreambuf_iterator<char>());
+		m_ReplayPosition = 0;
+		LoadProfiler::AddBytesRead(m_Data.size());
+
+		unsigned int formatVersion = 0;
+		std::string executableStamp;
+		std::vector<std::string> moduleIniFiles;
+		unsigned int count = 0;
+
+		bool valid = ReadValue(formatVersion) && formatVersion == c_FormatVersion && ReadValue(executableStamp) && executableStamp == m_ExecutableStamp && ReadValue(count);
+		for (unsigned int i = 0; valid && i < count; ++i) {
+			valid = ReadValue(moduleIniFiles.emplace_back());
+		}
+		valid = valid && moduleIniFiles == m_ModuleIniFiles && ReadValue(count);
+
+		for (unsigned int i = 0; valid && i < count; ++i) {
+			ContributingFile recordedFile;
+			ContributingFile currentFile;
+			valid = ReadValue(recordedFile.FilePath) && ReadValue(recordedFile.FileSize) && ReadValue(recordedFile.WriteTime) && GetFileStamp(recordedFile.FilePath, currentFile) && currentFile.FileSize == recordedFile.FileSize && currentFile.WriteTime == recordedFile.WriteTime;
+			if (valid) { m_ContributingFiles.emplace_back(recordedFile); }
+		}
+		if (!valid) {
+			m_Data.clear();
+			m_ContributingFiles.clear();
+			m_ReplayPosition = 0;
+			return false;
+		}
+		// Everything past the header is the recording itself
+		m_Data.erase(m_Data.begin(), m_Data.begin() + m_ReplayPosition);
+		m_ReplayPosition = 0;
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int PresetCache::Save() const {
+		if (!m_Recording) {
+			return -1;
+		}
+		if (!std::filesystem::exists(c_PresetCacheDirectory)) { g_System.MakeDirectory(c_PresetCacheDirectory); }
+
+		std::vector<char> header;
+		WriteValue(header, c_FormatVersion);
+		WriteValue(header, m_ExecutableStamp);
+		WriteValue(header, static_cast<unsigned int>(m_ModuleIniFiles.size()));
+		for (const std::string &moduleIniFile : m_ModuleIniFiles) {
+			WriteValue(header, moduleIniFile);
+		}
+		WriteValue(header, static_cast<unsigned int>(m_ContributingFiles.size()));
+		for (const ContributingFile &contributingFile : m_ContributingFiles) {
+			WriteValue(header, contributingFile.FilePath);
+			WriteValue(header, contributingFile.FileSize);
+			WriteValue(header, contributingFile.WriteTime);
+		}
+
+		// Write to a temporary file first, so a cache file is either complete or not there at all
+		std::string tempFilePath = m_CacheFilePath + ".tmp";
+		std::ofstream cacheFile(tempFilePath, std::ios::binary | std::ios::trunc);
+		cacheFile.write(header.data(), header.size());
+		cacheFile.write(m_Data.data(), m_Data.size());
+		cacheFile.close();
+
+		std::error_code errorCode;
+		if (cacheFile.fail()) {
+			std::filesystem::remove(tempFilePath, errorCode);
+			return -1;
+		}
+		std::filesystem::rename(tempFilePath, m_CacheFilePath, errorCode);
+		return errorCode ? -1 : 0;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PresetCache::RecordFileStart(const std::string &filePath) {
+		AddContributingFile(filePath);
+
+		m_Data.push_back(static_cast<char>(EntryType::FileStart));
+		WriteValue(m_Data, filePath);
+
+		// A new Reader starts on the first line of its file
+		m_LastRecordedFilePath = filePath;
+		m_LastRecordedLine = 1;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PresetCache::AddContributingFile(const std::string &filePath) {
+		for (const ContributingFile &contributingFile : m_ContributingFiles) {
+			if (contributingFile.FilePath == filePath) {
+				return;
+			}
+		}
+		ContributingFile contributingFile;
+		contributingFile.FilePath = filePath;
+		// A file that can't be stamped can't be checked for changes, so don't leave behind a recording that depends on it
+		if (!GetFileStamp(filePath, contributingFile)) { m_Recording = false; }
+		m_ContributingFiles.emplace_back(contributingFile);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PresetCache::RecordPosition(const std::string &filePath, unsigned int line) {
+		if (filePath == m_LastRecordedFilePath && line == m_LastRecordedLine) {
+			return;
+		}
+		m_Data.push_back(static_cast<char>(EntryType::Position));
+		WriteValue(m_Data, line);
+		// Most position changes are only a new line in the same file, so the file path is only stored when it changes
+		WriteValue(m_Data, (filePath == m_LastRecordedFilePath) ? std::string() : filePath);
+
+		m_LastRecordedFilePath = filePath;
+		m_LastRecordedLine = line;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PresetCache::ReplayFileStart(const std::string &filePath) {
+		std::string recordedFilePath;
+		Replay(EntryType::FileStart, recordedFilePath);
+		if (recordedFilePath != filePath) { AbortReplay(); }
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool PresetCache::ReplayPosition(std::string &filePath, unsigned int &line) {
+		if (m_ReplayPosition >= m_Data.size() || static_cast<EntryType>(m_Data[m_ReplayPosition]) != EntryType::Position) {
+			return false;
+		}
+		m_ReplayPosition++;
+
+		unsigned int recordedLine = 0;
+		std::string recordedFilePath;
+		if (!ReadValue(recordedLine) || !ReadValue(recordedFilePath)) { AbortReplay(); }
+
+		line = recordedLine;
+		if (!recordedFilePath.empty()) { filePath = recordedFilePath; }
+		return true;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void PresetCache::AbortReplay() const {
+		std::remove(m_CacheFilePath.c_str());
+		RTEAbort("The preset cache of " + m_ModuleName + " doesn't match what is being loaded and was deleted.\nRestart the game to load the module from its .ini files again.");
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool PresetCache::GetFileStamp(const std::string &filePath, ContributingFile &contributingFile) {
+		std::error_code errorCode;
+		if (filePath.empty() || !std::filesystem::is_regular_file(filePath, errorCode)) {
+			return false;
+		}
+		contributingFile.FileSize = std::filesystem::file_size(filePath, errorCode);
+		if (errorCode) {
+			return false;
+		}
+		contributingFile.WriteTime = static_cast<long long>(std::filesystem::last_write_time(filePath, errorCode).time_since_epoch().count());
+		return !errorCode;
+	}
+}
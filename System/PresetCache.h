@@ -0,0 +1,219 @@
+#ifndef _RTEPRESETCACHE_
+#define _RTEPRESETCACHE_
+
+namespace RTE {
+
+	/// <summary>
+	/// A binary recording of everything the Readers of a DataModule read while it was loaded, so the next load can replay it instead of parsing the module's .ini files all over again.
+	/// A recording is only replayed as long as none of the files it was read from, nor the executable that made it, have changed since.
+	/// </summary>
+	class PresetCache {
+
+	public:
+
+		/// <summary>
+		/// The reading operations a recording is made of. Replaying checks it's being asked for the same operation that was recorded at each point.
+		/// </summary>
+		enum EntryType : unsigned char { FileStart, Position, NextProperty, DiscardEmptySpace, PropName, PropValue, Line, ReadTo, CString, Bool, Char, UnsignedChar, Short, UnsignedShort, Int, UnsignedInt, Long, UnsignedLong, Float, Double };
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate a PresetCache object in system memory. Create() should be called before using the object.
+		/// </summary>
+		PresetCache() { Clear(); }
+
+		/// <summary>
+		/// Makes the PresetCache object ready for use, either replaying the DataModule's cache file if it's still valid, or recording a new one otherwise.
+		/// </summary>
+		/// <param name="moduleName">The file name of the DataModule to cache, including the .rte extension.</param>
+		/// <returns>An error return value signaling success or any particular failure. Anything below 0 is an error signal.</returns>
+		int Create(const std::string &moduleName);
+#pragma endregion
+
+#pragma region Destruction
+		/// <summary>
+		/// Destructor method used to clean up a PresetCache object before deletion from system memory.
+		/// </summary>
+		~PresetCache() { Destroy(); }
+
+		/// <summary>
+		/// Destroys and resets (through Clear()) the PresetCache object.
+		/// </summary>
+		void Destroy() { Clear(); }
+#pragma endregion
+
+#pragma region Getters
+		/// <summary>
+		/// Gets whether this PresetCache is replaying a valid cache file.
+		/// </summary>
+		/// <returns>Whether this PresetCache is replaying.</returns>
+		bool IsReplaying() const { return m_Replaying; }
+
+		/// <summary>
+		/// Gets whether this PresetCache is recording a new cache file.
+		/// </summary>
+		/// <returns>Whether this PresetCache is recording.</returns>
+		bool IsRecording() const { return m_Recording; }
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Writes the recording to the DataModule's cache file. Should only be called once the whole DataModule was loaded successfully.
+		/// </summary>
+		/// <returns>An error return value signaling success or any particular failure. Anything below 0 is an error signal.</returns>
+		int Save() const;
+#pragma endregion
+
+#pragma region Recording
+		/// <summary>
+		/// Starts recording what a new Reader reads from a file.
+		/// </summary>
+		/// <param name="filePath">The path of the file the Reader reads.</param>
+		void RecordFileStart(const std::string &filePath);
+
+		/// <summary>
+		/// Adds a file to the files the recording depends on, so changing it invalidates the recording.
+		/// </summary>
+		/// <param name="filePath">The path of the file.</param>
+		void AddContributingFile(const std::string &filePath);
+
+		/// <summary>
+		/// Records the result of a reading operation.
+		/// </summary>
+		/// <param name="entryType">The reading operation.</param>
+		/// <param name="value">The result of the reading operation.</param>
+		template <typename Type> void Record(EntryType entryType, const Type &value) {
+			m_Data.push_back(static_cast<char>(entryType));
+			WriteValue(m_Data, value);
+		}
+
+		/// <summary>
+		/// Records the position the Reader is at after a reading operation, if it changed since the last one recorded.
+		/// </summary>
+		/// <param name="filePath">The path of the file the Reader is reading.</param>
+		/// <param name="line">The line the Reader is on.</param>
+		void RecordPosition(const std::string &filePath, unsigned int line);
+#pragma endregion
+
+#pragma region Replaying
+		/// <summary>
+		/// Starts replaying what a new Reader read from a file. Aborts if the next thing recorded isn't that file.
+		/// </summary>
+		/// <param name="filePath">The path of the file the Reader reads.</param>
+		void ReplayFileStart(const std::string &filePath);
+
+		/// <summary>
+		/// Replays the result of a reading operation. Aborts if the next thing recorded isn't that operation.
+		/// </summary>
+		/// <param name="entryType">The reading operation.</param>
+		/// <param name="value">Returns the result of the reading operation.</param>
+		template <typename Type> void Replay(EntryType entryType, Type &value) {
+			if (m_ReplayPosition >= m_Data.size() || static_cast<EntryType>(m_Data[m_ReplayPosition]) != entryType) { AbortReplay(); }
+			m_ReplayPosition++;
+			if (!ReadValue(value)) { AbortReplay(); }
+		}
+
+		/// <summary>
+		/// Replays the position the Reader was at after the last replayed reading operation, if it was recorded as having changed.
+		/// </summary>
+		/// <param name="filePath">Returns the path of the file the Reader was reading, if it changed.</param>
+		/// <param name="line">Returns the line the Reader was on, if it changed.</param>
+		/// <returns>Whether the position changed.</returns>
+		bool ReplayPosition(std::string &filePath, unsigned int &line);
+#pragma endregion
+
+	private:
+
+		/// <summary>
+		/// A file a recording depends on, along with what identified its contents when the recording was made.
+		/// </summary>
+		struct ContributingFile {
+			std::string FilePath; //!< The path of the file.
+			unsigned long long FileSize; //!< The size of the file.
+			long long WriteTime; //!< The last write time of the file.
+		};
+
+		static constexpr unsigned int c_FormatVersion = 1; //!< The version of the cache file format. Cache files of other versions are ignored.
+
+		std::string m_ModuleName; //!< The file name of the cached DataModule.
+		std::string m_CacheFilePath; //!< The path of the DataModule's cache file.
+		std::string m_ExecutableStamp; //!< Identifies the executable making or replaying the recording, since reading differently from the same files would make the recording useless.
+		std::vector<std::string> m_ModuleIniFiles; //!< The .ini files directly in the DataModule's folder, since adding one could change which ones are read.
+		std::vector<ContributingFile> m_ContributingFiles; //!< The files the recording depends on.
+
+		std::vector<char> m_Data; //!< The recorded reading operations and their results.
+		size_t m_ReplayPosition; //!< The position in the recording the next reading operation is replayed from.
+		std::string m_LastRecordedFilePath; //!< The file path of the last recorded position.
+		unsigned int m_LastRecordedLine; //!< The line of the last recorded position.
+
+		bool m_Recording; //!< Whether a new recording is being made.
+		bool m_Replaying; //!< Whether a valid recording is being replayed.
+
+		/// <summary>
+		/// Reads the DataModule's cache file and checks whether it's still valid.
+		/// </summary>
+		/// <returns>Whether the cache file was read and is valid.</returns>
+		bool Load();
+
+		/// <summary>
+		/// Deletes the cache file being replayed and aborts, since the recording no longer matches what's being read and there's no way to go back to reading the .ini files halfway through.
+		/// </summary>
+		void AbortReplay() const;
+
+		/// <summary>
+		/// Gets the size and last write time of a file, which together identify its contents well enough to tell whether it changed.
+		/// </summary>
+		/// <param name="filePath">The path of the file.</param>
+		/// <param name="contributingFile">Returns the size and last write time of the file.</param>
+		/// <returns>Whether the file exists and its size and last write time could be gotten.</returns>
+		static bool GetFileStamp(const std::string &filePath, ContributingFile &contributingFile);
+
+		/// <summary>
+		/// Appends a value to a buffer in the format of the cache file.
+		/// </summary>
+		/// <param name="buffer">The buffer to append to.</param>
+		/// <param name="value">The value to append.</param>
+		template <typename Type> static void WriteValue(std::vector<char> &buffer, const Type &value) {
+			if constexpr (std::is_same_v<Type, std::string>) {
+				WriteValue(buffer, static_cast<unsigned int>(value.size()));
+				buffer.insert(buffer.end(), value.begin(), value.end());
+			} else {
+				const char *valueBytes = reinterpret_cast<const char *>(&value);
+				buffer.insert(buffer.end(), valueBytes, valueBytes + sizeof(Type));
+			}
+		}
+
+		/// <summary>
+		/// Reads a value from the recording at the replay position and moves past it.
+		/// </summary>
+		/// <param name="value">Returns the value read.</param>
+		/// <returns>Whether there was enough left of the recording to read the value from.</returns>
+		template <typename Type> bool ReadValue(Type &value) {
+			if constexpr (std::is_same_v<Type, std::string>) {
+				unsigned int length = 0;
+				if (!ReadValue(length) || m_Data.size() - m_ReplayPosition < length) {
+					return false;
+				}
+				value.assign(m_Data.data() + m_ReplayPosition, length);
+				m_ReplayPosition += length;
+			} else {
+				if (m_Data.size() - m_ReplayPosition < sizeof(Type)) {
+					return false;
+				}
+				std::memcpy(&value, m_Data.data() + m_ReplayPosition, sizeof(Type));
+				m_ReplayPosition += sizeof(Type);
+			}
+			return true;
+		}
+
+		/// <summary>
+		/// Clears all the member variables of this PresetCache, effectively resetting the members of this abstraction level only.
+		/// </summary>
+		void Clear();
+
+		// Disallow the use of some implicit methods.
+		PresetCache(const PresetCache &reference) = delete;
+		PresetCache & operator=(const PresetCache &rhs) = delete;
+	};
+}
+#endif
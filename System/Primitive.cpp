@@ -8,6 +8,41 @@
 
 namespace RTE {
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	/// <summary>
+	/// Gets the smallest Box enclosing all the passed in points.
+	/// </summary>
+	/// <param name="points">The points to enclose.</param>
+	/// <returns>The enclosing Box.</returns>
+	static Box GetEnclosingBox(std::initializer_list<Vector> points) {
+		Vector topLeft = *points.begin();
+		Vector bottomRight = *points.begin();
+		for (const Vector &point : points) {
+			topLeft.SetXY(std::min(topLeft.GetX(), point.GetX()), std::min(topLeft.GetY(), point.GetY()));
+			bottomRight.SetXY(std::max(bottomRight.GetX(), point.GetX()), std::max(bottomRight.GetY(), point.GetY()));
+		}
+		return Box(topLeft, bottomRight);
+	}
+
+	/// <summary>
+	/// Draws a line, going through the cheaper horizontal and vertical line rasterisers when the line is axis aligned.
+	/// </summary>
+	static void DrawLineFast(BITMAP *drawScreen, const Vector &drawStart, const Vector &drawEnd, int color) {
+		int startX = drawStart.GetFloorIntX();
+		int startY = drawStart.GetFloorIntY();
+		int endX = drawEnd.GetFloorIntX();
+		int endY = drawEnd.GetFloorIntY();
+
+		if (startY == endY) {
+			hline(drawScreen, startX, startY, endX, color);
+		} else if (startX == endX) {
+			vline(drawScreen, startX, startY, endY, color);
+		} else {
+			line(drawScreen, startX, startY, endX, endY, color);
+		}
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void GraphicalPrimitive::TranslateCoordinates(Vector targetPos, Vector scenePos, Vector & drawLeftPos, Vector & drawRightPos) const {
@@ -52,6 +87,36 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void LinePrimitive::DrawBatch(BITMAP *drawScreen, const Vector &targetPos, const std::vector<GraphicalPrimitive *> &batch) {
+		bool sceneWraps = g_SceneMan.SceneWrapsX() || g_SceneMan.SceneWrapsY();
+		Vector drawStartLeft;
+		Vector drawEndLeft;
+		Vector drawStartRight;
+		Vector drawEndRight;
+
+		acquire_bitmap(drawScreen);
+		for (const GraphicalPrimitive *primitive : batch) {
+			if (!sceneWraps) {
+				DrawLineFast(drawScreen, primitive->m_StartPos - targetPos, primitive->m_EndPos - targetPos, primitive->m_Color);
+			} else {
+				primitive->TranslateCoordinates(targetPos, primitive->m_StartPos, drawStartLeft, drawStartRight);
+				primitive->TranslateCoordinates(targetPos, primitive->m_EndPos, drawEndLeft, drawEndRight);
+				DrawLineFast(drawScreen, drawStartLeft, drawEndLeft, primitive->m_Color);
+				DrawLineFast(drawScreen, drawStartRight, drawEndRight, primitive->m_Color);
+			}
+		}
+		release_bitmap(drawScreen);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box ArcPrimitive::GetBoundingBox() const {
+		float extent = static_cast<float>(m_Radius + m_Thickness);
+		return Box(m_StartPos - Vector(extent, extent), m_StartPos + Vector(extent, extent));
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void ArcPrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -82,6 +147,13 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box SplinePrimitive::GetBoundingBox() const {
+		// A Bezier spline never leaves the hull of its start, end and guide points
+		return GetEnclosingBox({ m_StartPos, m_GuidePointAPos, m_GuidePointBPos, m_EndPos });
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void SplinePrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -137,6 +209,31 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void BoxPrimitive::DrawBatch(BITMAP *drawScreen, const Vector &targetPos, const std::vector<GraphicalPrimitive *> &batch) {
+		bool sceneWraps = g_SceneMan.SceneWrapsX() || g_SceneMan.SceneWrapsY();
+		Vector drawStartLeft;
+		Vector drawEndLeft;
+		Vector drawStartRight;
+		Vector drawEndRight;
+
+		acquire_bitmap(drawScreen);
+		for (const GraphicalPrimitive *primitive : batch) {
+			if (!sceneWraps) {
+				Vector drawStart = primitive->m_StartPos - targetPos;
+				Vector drawEnd = primitive->m_EndPos - targetPos;
+				rect(drawScreen, drawStart.GetFloorIntX(), drawStart.GetFloorIntY(), drawEnd.GetFloorIntX(), drawEnd.GetFloorIntY(), primitive->m_Color);
+			} else {
+				primitive->TranslateCoordinates(targetPos, primitive->m_StartPos, drawStartLeft, drawStartRight);
+				primitive->TranslateCoordinates(targetPos, primitive->m_EndPos, drawEndLeft, drawEndRight);
+				rect(drawScreen, drawStartLeft.GetFloorIntX(), drawStartLeft.GetFloorIntY(), drawEndLeft.GetFloorIntX(), drawEndLeft.GetFloorIntY(), primitive->m_Color);
+				rect(drawScreen, drawStartRight.GetFloorIntX(), drawStartRight.GetFloorIntY(), drawEndRight.GetFloorIntX(), drawEndRight.GetFloorIntY(), primitive->m_Color);
+			}
+		}
+		release_bitmap(drawScreen);
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void BoxFillPrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -158,6 +255,39 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void BoxFillPrimitive::DrawBatch(BITMAP *drawScreen, const Vector &targetPos, const std::vector<GraphicalPrimitive *> &batch) {
+		bool sceneWraps = g_SceneMan.SceneWrapsX() || g_SceneMan.SceneWrapsY();
+		Vector drawStartLeft;
+		Vector drawEndLeft;
+		Vector drawStartRight;
+		Vector drawEndRight;
+
+		acquire_bitmap(drawScreen);
+		for (const GraphicalPrimitive *primitive : batch) {
+			if (!sceneWraps) {
+				Vector drawStart = primitive->m_StartPos - targetPos;
+				Vector drawEnd = primitive->m_EndPos - targetPos;
+				rectfill(drawScreen, drawStart.GetFloorIntX(), drawStart.GetFloorIntY(), drawEnd.GetFloorIntX(), drawEnd.GetFloorIntY(), primitive->m_Color);
+			} else {
+				primitive->TranslateCoordinates(targetPos, primitive->m_StartPos, drawStartLeft, drawStartRight);
+				primitive->TranslateCoordinates(targetPos, primitive->m_EndPos, drawEndLeft, drawEndRight);
+				rectfill(drawScreen, drawStartLeft.GetFloorIntX(), drawStartLeft.GetFloorIntY(), drawEndLeft.GetFloorIntX(), drawEndLeft.GetFloorIntY(), primitive->m_Color);
+				rectfill(drawScreen, drawStartRight.GetFloorIntX(), drawStartRight.GetFloorIntY(), drawEndRight.GetFloorIntX(), drawEndRight.GetFloorIntY(), primitive->m_Color);
+			}
+		}
+		release_bitmap(drawScreen);
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box RoundedBoxPrimitive::GetBoundingBox() const {
+		// The corner arcs are drawn outside the box's vertical span
+		Box boundingBox(m_StartPos, m_EndPos);
+		return Box(boundingBox.GetCorner() - Vector(m_CornerRadius, m_CornerRadius), boundingBox.GetWidth() + static_cast<float>(m_CornerRadius * 2), boundingBox.GetHeight() + static_cast<float>(m_CornerRadius * 2));
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void RoundedBoxPrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -205,6 +335,14 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box RoundedBoxFillPrimitive::GetBoundingBox() const {
+		// The corner arcs are drawn outside the box's vertical span
+		Box boundingBox(m_StartPos, m_EndPos);
+		return Box(boundingBox.GetCorner() - Vector(m_CornerRadius, m_CornerRadius), boundingBox.GetWidth() + static_cast<float>(m_CornerRadius * 2), boundingBox.GetHeight() + static_cast<float>(m_CornerRadius * 2));
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void RoundedBoxFillPrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -245,6 +383,12 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box CirclePrimitive::GetBoundingBox() const {
+		return Box(m_StartPos - Vector(m_Radius, m_Radius), m_StartPos + Vector(m_Radius, m_Radius));
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void CirclePrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -262,6 +406,12 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box CircleFillPrimitive::GetBoundingBox() const {
+		return Box(m_StartPos - Vector(m_Radius, m_Radius), m_StartPos + Vector(m_Radius, m_Radius));
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void CircleFillPrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -279,6 +429,12 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box EllipsePrimitive::GetBoundingBox() const {
+		return Box(m_StartPos - Vector(m_HorizRadius, m_VertRadius), m_StartPos + Vector(m_HorizRadius, m_VertRadius));
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void EllipsePrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -296,6 +452,12 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box EllipseFillPrimitive::GetBoundingBox() const {
+		return Box(m_StartPos - Vector(m_HorizRadius, m_VertRadius), m_StartPos + Vector(m_HorizRadius, m_VertRadius));
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void EllipseFillPrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -313,6 +475,12 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box TrianglePrimitive::GetBoundingBox() const {
+		return GetEnclosingBox({ m_PointAPos, m_PointBPos, m_PointCPos });
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void TrianglePrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -344,6 +512,12 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box TriangleFillPrimitive::GetBoundingBox() const {
+		return GetEnclosingBox({ m_PointAPos, m_PointBPos, m_PointCPos });
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void TriangleFillPrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -369,6 +543,17 @@ namespace RTE {
 		}
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	Box TextPrimitive::GetBoundingBox() const {
+		GUIFont *font = m_IsSmall ? g_FrameMan.GetSmallFont() : g_FrameMan.GetLargeFont();
+		float textWidth = static_cast<float>(font->CalculateWidth(m_Text));
+		float textHeight = static_cast<float>(font->CalculateHeight(m_Text));
+
+		// Wide enough to cover the text whichever way it is aligned
+		return Box(m_StartPos - Vector(textWidth, 0), m_StartPos + Vector(textWidth, textHeight));
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void TextPrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
@@ -400,47 +585,48 @@ namespace RTE {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	void BitmapPrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
+	Box BitmapPrimitive::GetBoundingBox() const {
 		if (!m_Bitmap) {
-			return;
+			return Box(m_StartPos, m_StartPos);
 		}
+		// Half the diagonal covers the bitmap at any rotation around its center
+		float halfDiagonal = std::sqrt(static_cast<float>(m_Bitmap->w * m_Bitmap->w + m_Bitmap->h * m_Bitmap->h)) / 2.0F;
+		return Box(m_StartPos - Vector(halfDiagonal, halfDiagonal), m_StartPos + Vector(halfDiagonal, halfDiagonal));
+	}
 
-		BITMAP *bitmapToDraw = create_bitmap_ex(8, m_Bitmap->w, m_Bitmap->h);
-		clear_to_color(bitmapToDraw, 0);
-		draw_sprite(bitmapToDraw, m_Bitmap, 0, 0);
-
-		if (m_HFlipped || m_VFlipped) {
-			BITMAP *flipBitmap = create_bitmap_ex(8, bitmapToDraw->w, bitmapToDraw->h);
-			clear_to_color(flipBitmap, 0);
-
-			if (m_HFlipped && !m_VFlipped) {
-				draw_sprite_h_flip(flipBitmap, bitmapToDraw, 0, 0);
-			} else if (!m_HFlipped && m_VFlipped) {
-				draw_sprite_v_flip(flipBitmap, bitmapToDraw, 0, 0);
-			} else if (m_HFlipped && m_VFlipped) {
-				draw_sprite_vh_flip(flipBitmap, bitmapToDraw, 0, 0);
-			}
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-			blit(flipBitmap, bitmapToDraw, 0, 0, 0, 0, bitmapToDraw->w, bitmapToDraw->h);
-			destroy_bitmap(flipBitmap);
+	void BitmapPrimitive::Draw(BITMAP *drawScreen, Vector targetPos) {
+		if (!m_Bitmap) {
+			return;
 		}
 
-		Matrix rotation = Matrix(m_RotAngle);
+		// Flipping is folded into the rotation instead of going through temporary flipped copies of the bitmap. A horizontal flip is a vertical flip turned half way around, and flipping both ways is just the half turn.
+		fixed allegroAngle = ftofix(Matrix(m_RotAngle).GetAllegroAngle() + (m_HFlipped ? 128.0F : 0.0F));
+		bool drawVFlipped = m_HFlipped != m_VFlipped;
+		int pivotX = m_Bitmap->w / 2;
+		int pivotY = m_Bitmap->h / 2;
 
 		if (!g_SceneMan.SceneWrapsX() && !g_SceneMan.SceneWrapsY()) {
 			Vector drawStart = m_StartPos - targetPos;
-			pivot_scaled_sprite(drawScreen, bitmapToDraw, drawStart.GetFloorIntX(), drawStart.GetFloorIntY(), bitmapToDraw->w / 2, bitmapToDraw->h / 2, ftofix(rotation.GetAllegroAngle()), ftofix(1.0));
+			if (drawVFlipped) {
+				pivot_scaled_sprite_v_flip(drawScreen, m_Bitmap, drawStart.GetFloorIntX(), drawStart.GetFloorIntY(), pivotX, pivotY, allegroAngle, ftofix(1.0));
+			} else {
+				pivot_scaled_sprite(drawScreen, m_Bitmap, drawStart.GetFloorIntX(), drawStart.GetFloorIntY(), pivotX, pivotY, allegroAngle, ftofix(1.0));
+			}
 		} else {
 			Vector drawStartLeft;
 			Vector drawStartRight;
 
 			TranslateCoordinates(targetPos, m_StartPos, drawStartLeft, drawStartRight);
 
-			// Take into account the h-flipped pivot point
-			pivot_scaled_sprite(drawScreen, bitmapToDraw, drawStartLeft.GetFloorIntX(), drawStartLeft.GetFloorIntY(), bitmapToDraw->w / 2, bitmapToDraw->h / 2, ftofix(rotation.GetAllegroAngle()), ftofix(1.0));
-			pivot_scaled_sprite(drawScreen, bitmapToDraw, drawStartRight.GetFloorIntX(), drawStartRight.GetFloorIntY(), bitmapToDraw->w / 2, bitmapToDraw->h / 2, ftofix(rotation.GetAllegroAngle()), ftofix(1.0));
+			if (drawVFlipped) {
+				pivot_scaled_sprite_v_flip(drawScreen, m_Bitmap, drawStartLeft.GetFloorIntX(), drawStartLeft.GetFloorIntY(), pivotX, pivotY, allegroAngle, ftofix(1.0));
+				pivot_scaled_sprite_v_flip(drawScreen, m_Bitmap, drawStartRight.GetFloorIntX(), drawStartRight.GetFloorIntY(), pivotX, pivotY, allegroAngle, ftofix(1.0));
+			} else {
+				pivot_scaled_sprite(drawScreen, m_Bitmap, drawStartLeft.GetFloorIntX(), drawStartLeft.GetFloorIntY(), pivotX, pivotY, allegroAngle, ftofix(1.0));
+				pivot_scaled_sprite(drawScreen, m_Bitmap, drawStartRight.GetFloorIntX(), drawStartRight.GetFloorIntY(), pivotX, pivotY, allegroAngle, ftofix(1.0));
+			}
 		}
-
-		destroy_bitmap(bitmapToDraw);
 	}
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #ifndef _RTEPRIMITIVE_
 #define _RTEPRIMITIVE_
 
-#include "Vector.h"
+#include "Box.h"
 
 namespace RTE {
 
@@ -14,6 +14,11 @@ namespace RTE {
 
 	public:
 
+		/// <summary>
+		/// Enumeration of the different types of GraphicalPrimitive. Used to pool primitives by type and to batch consecutive primitives of the same type when drawing.
+		/// </summary>
+		enum class PrimitiveType { Line, Arc, Spline, Box, BoxFill, RoundedBox, RoundedBoxFill, Circle, CircleFill, Ellipse, EllipseFill, Triangle, TriangleFill, Text, Bitmap, PrimitiveTypeCount };
+
 		Vector m_StartPos; //!< Start position of the primitive.
 		Vector m_EndPos; //!< End position of the primitive.
 		unsigned short m_Color; //!< Color to draw this primitive with.		
@@ -36,6 +41,23 @@ namespace RTE {
 		/// </remarks>
 		void TranslateCoordinates(Vector targetPos, Vector scenePos, Vector & drawLeftPos, Vector & drawRightPos) const;
 
+		/// <summary>
+		/// Destructor method used to clean up a GraphicalPrimitive object before deletion from system memory.
+		/// </summary>
+		virtual ~GraphicalPrimitive() = default;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		virtual PrimitiveType GetPrimitiveType() const = 0;
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens. Defaults to the box spanned by the start and end positions.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		virtual Box GetBoundingBox() const { return Box(m_StartPos, m_EndPos); }
+
 		/// <summary>
 		/// Draws this primitive on provided bitmap.
 		/// </summary>
@@ -53,6 +75,8 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::Line; //!< The type of this primitive.
+
 		/// <summary>
 		/// Constructor method for LinePrimitive object.
 		/// </summary>
@@ -73,6 +97,20 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Draws a run of consecutive LinePrimitives on provided bitmap in one go, so the scene wrapping state and bitmap locking are only dealt with once per run.
+		/// </summary>
+		/// <param name="drawScreen">Bitmap to draw on.</param>
+		/// <param name="targetPos">Position of graphical primitive.</param>
+		/// <param name="batch">The primitives to draw. All of them must be LinePrimitives.</param>
+		static void DrawBatch(BITMAP *drawScreen, const Vector &targetPos, const std::vector<GraphicalPrimitive *> &batch);
 	};
 #pragma endregion
 
@@ -84,6 +122,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::Arc; //!< The type of this primitive.
 		float m_StartAngle; //!< The angle from which the arc begins.
 		float m_EndAngle; //!< The angle at which the arc ends.
 		short m_Radius; //!< Radius of the arc primitive.
@@ -114,6 +153,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -125,6 +176,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::Spline; //!< The type of this primitive.
 		Vector m_GuidePointAPos; //!< A guide point that controls the curve of the spline.
 		Vector m_GuidePointBPos; //!< A guide point that controls the curve of the spline.
 
@@ -152,6 +204,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -163,6 +227,8 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::Box; //!< The type of this primitive.
+
 		/// <summary>
 		/// Constructor method for BoxPrimitive object.
 		/// </summary>
@@ -183,6 +249,20 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Draws a run of consecutive BoxPrimitives on provided bitmap in one go, so the scene wrapping state and bitmap locking are only dealt with once per run.
+		/// </summary>
+		/// <param name="drawScreen">Bitmap to draw on.</param>
+		/// <param name="targetPos">Position of graphical primitive.</param>
+		/// <param name="batch">The primitives to draw. All of them must be BoxPrimitives.</param>
+		static void DrawBatch(BITMAP *drawScreen, const Vector &targetPos, const std::vector<GraphicalPrimitive *> &batch);
 	};
 #pragma endregion
 
@@ -194,6 +274,8 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::BoxFill; //!< The type of this primitive.
+
 		/// <summary>
 		/// Constructor method for BoxFillPrimitive object.
 		/// </summary>
@@ -214,6 +296,20 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Draws a run of consecutive BoxFillPrimitives on provided bitmap in one go, so the scene wrapping state and bitmap locking are only dealt with once per run.
+		/// </summary>
+		/// <param name="drawScreen">Bitmap to draw on.</param>
+		/// <param name="targetPos">Position of graphical primitive.</param>
+		/// <param name="batch">The primitives to draw. All of them must be BoxFillPrimitives.</param>
+		static void DrawBatch(BITMAP *drawScreen, const Vector &targetPos, const std::vector<GraphicalPrimitive *> &batch);
 	};
 #pragma endregion
 
@@ -225,6 +321,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::RoundedBox; //!< The type of this primitive.
 		short m_CornerRadius; //!< The radius of the corners of the box.
 
 		/// <summary>
@@ -249,6 +346,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -260,6 +369,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::RoundedBoxFill; //!< The type of this primitive.
 		short m_CornerRadius; //!< The radius of the corners of the box.
 
 		/// <summary>
@@ -284,6 +394,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -295,6 +417,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::Circle; //!< The type of this primitive.
 		short m_Radius; //!< Radius of the circle primitive.
 
 		/// <summary>
@@ -317,6 +440,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -328,6 +463,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::CircleFill; //!< The type of this primitive.
 		short m_Radius; //!< Radius of the circle primitive.
 
 		/// <summary>
@@ -350,6 +486,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -361,6 +509,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::Ellipse; //!< The type of this primitive.
 		short m_HorizRadius; //!< The horizontal radius of the ellipse primitive.
 		short m_VertRadius; //!< The vertical radius of the ellipse primitive.
 
@@ -386,6 +535,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -397,6 +558,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::EllipseFill; //!< The type of this primitive.
 		short m_HorizRadius; //!< The horizontal radius of the ellipse primitive.
 		short m_VertRadius; //!< The vertical radius of the ellipse primitive.
 
@@ -421,6 +583,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -432,6 +606,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::Triangle; //!< The type of this primitive.
 		Vector m_PointAPos; //!< First point of the triangle.
 		Vector m_PointBPos; //!< Second point of the triangle.
 		Vector m_PointCPos; //!< Third point of the triangle.
@@ -458,6 +633,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -469,6 +656,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::TriangleFill; //!< The type of this primitive.
 		Vector m_PointAPos; //!< First point of the triangle.
 		Vector m_PointBPos; //!< Second point of the triangle.
 		Vector m_PointCPos; //!< Third point of the triangle.
@@ -495,6 +683,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -506,6 +706,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::Text; //!< The type of this primitive.
 		bool m_IsSmall; //!< Use small or large font. True for small font.
 		short m_Alignment; //!< Alignment of text.
 		std::string m_Text; //!< String containing text to draw.
@@ -532,6 +733,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 
@@ -543,6 +756,7 @@ namespace RTE {
 
 	public:
 
+		static constexpr PrimitiveType c_PrimitiveType = PrimitiveType::Bitmap; //!< The type of this primitive.
 		float m_RotAngle; //!< Angle to rotate bitmap in radians.
 		BITMAP *m_Bitmap; //!< Bitmap to draw.
 		bool m_HFlipped; //!< Whether the Bitmap to draw should be horizontally flipped.
@@ -572,6 +786,18 @@ namespace RTE {
 		/// <param name="drawScreen">Bitmap to draw on.</param>
 		/// <param name="targetPos">Position of graphical primitive.</param>
 		void Draw(BITMAP *drawScreen, Vector targetPos) override;
+
+		/// <summary>
+		/// Gets the type of this primitive.
+		/// </summary>
+		/// <returns>The PrimitiveType of this primitive.</returns>
+		PrimitiveType GetPrimitiveType() const override { return c_PrimitiveType; }
+
+		/// <summary>
+		/// Gets the area of the scene this primitive covers, used to cull it against player screens.
+		/// </summary>
+		/// <returns>A Box enclosing this primitive in scene coordinates.</returns>
+		Box GetBoundingBox() const override;
 	};
 #pragma endregion
 }
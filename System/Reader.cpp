@@ -2,6 +2,7 @@
 #include "RTETools.h"
 #include "PresetMan.h"
 #include "SettingsMan.h"
+#include "LoadProfiler.h"
 
 namespace RTE {
 
@@ -10,7 +11,9 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void Reader::Clear() {
-		m_Stream = 0;
+		m_File = nullptr;
+		m_ReadPosition = nullptr;
+		m_FileEnd = nullptr;
 		m_FilePath.clear();
 		m_CurrentLine = 1;
 		m_StreamStack.clear();
@@ -25,11 +28,14 @@ namespace RTE {
 		m_DataModuleID = -1;
 		m_OverwriteExisting = false;
 		m_SkipIncludes = false;
+		m_PresetCache = nullptr;
+		m_NestedReads = 0;
+		m_ProfilerSection = -1;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	int Reader::Create(const char *fileName, bool overwrites, ProgressCallback fpProgressCallback, bool failOK) {
+	int Reader::Create(const char *fileName, bool overwrites, ProgressCallback fpProgressCallback, bool failOK, PresetCache *presetCache) {
 		m_FilePath = fileName;
 
 		if (m_FilePath.empty()) {
@@ -47,28 +53,52 @@ namespace RTE {
 		m_DataModuleName = m_FilePath.substr(0, firstSlashPos);
 		m_DataModuleID = g_PresetMan.GetModuleID(m_DataModuleName);
 
-		m_Stream = new std::ifstream(fileName);
-		if (!failOK) { RTEAssert(m_Stream->good(), "Failed to open data file \'" + std::string(fileName) + "\'!"); }
-
 		m_OverwriteExisting = overwrites;
+		m_ReportProgress = fpProgressCallback;
+		m_PresetCache = presetCache;
+
+		// Everything this would read from the file was recorded, so don't even open it
+		if (m_PresetCache && m_PresetCache->IsReplaying()) {
+			m_PresetCache->ReplayFileStart(m_FilePath);
+			m_ProfilerSection = LoadProfiler::BeginSection(LoadProfiler::DataFileSection, m_FilePath);
+			if (m_ReportProgress) {
+				char report[512];
+				std::snprintf(report, sizeof(report), "\t%s on line %i", m_FileName.c_str(), m_CurrentLine);
+				m_ReportProgress(std::string(report), true);
+			}
+			return 0;
+		}
+
+		m_File = new MappedFile(m_FilePath);
+		if (!failOK) { RTEAssert(m_File->IsOpen(), "Failed to open data file \'" + std::string(fileName) + "\'!"); }
+		if (!m_File->IsOpen()) {
+			return -1;
+		}
+		m_ReadPosition = m_File->GetData();
+		m_FileEnd = m_ReadPosition + m_File->GetSize();
+		m_ProfilerSection = LoadProfiler::BeginSection(LoadProfiler::DataFileSection, m_FilePath);
+		LoadProfiler::AddBytesRead(m_File->GetSize());
+
+		if (m_PresetCache && m_PresetCache->IsRecording()) { m_PresetCache->RecordFileStart(m_FilePath); }
 
 		// Report that we're starting a new file
-		m_ReportProgress = fpProgressCallback;
-		if (m_ReportProgress && m_Stream->good()) {
+		if (m_ReportProgress) {
 			char report[512];
 			std::snprintf(report, sizeof(report), "\t%s on line %i", m_FileName.c_str(), m_CurrentLine);
 			m_ReportProgress(std::string(report), true);
 		}
-		return m_Stream->good() ? 0 : -1;
+		return 0;
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void Reader::Destroy() {
-		delete m_Stream;
-		// Delete all the streams in the stream stack
-		for (const StreamInfo &streamInfo : m_StreamStack) {
-			delete streamInfo.Stream;
+		LoadProfiler::EndSection(m_ProfilerSection);
+		delete m_File;
+		// Delete all the files in the stream stack
+		for (std::vector<StreamInfo>::const_reverse_iterator streamItr = m_StreamStack.rbegin(); streamItr != m_StreamStack.rend(); ++streamItr) {
+			LoadProfiler::EndSection(streamItr->ProfilerSection);
+			delete streamItr->File;
 		}
 		Clear();
 	}
@@ -83,136 +113,137 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	void Reader::ReadLine(char *locString, int size) {
-		DiscardEmptySpace();
+		if (m_PresetCache) {
+			std::string line = CachedRead<std::string>(PresetCache::Line, [this, locString, size]() { ReadUncachedLine(locString, size); return std::string(locString); });
+			std::strcpy(locString, line.c_str());
+		} else {
+			ReadUncachedLine(locString, size);
+		}
+	}
 
-		char temp;
-		char peek = m_Stream->peek();
-		int i = 0;
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		for (i = 0; i < size - 1 && peek != '\n' && peek != '\r' && peek != '\t'; ++i) {
-			temp = m_Stream->get();
-			// Check for line comment "//"
-			if (peek == '/' && m_Stream->peek() == '/') {
-				m_Stream->putback(temp);
-				break;
-			}
-			if (m_Stream->eof()) {
-				EndIncludeFile();
-				break;
-			}
-			if (!m_Stream->good()) { ReportError("Stream failed for some reason"); }
+	void Reader::ReadUncachedLine(char *locString, int size) {
+		DiscardEmptySpace();
 
-			locString[i] = temp;
-			peek = m_Stream->peek();
-		}
-		locString[i] = '\0';
+		const char *lineEnd = FindLineEnd();
+		size_t length = std::min(static_cast<size_t>(lineEnd - m_ReadPosition), static_cast<size_t>(std::max(size - 1, 0)));
+		std::memcpy(locString, m_ReadPosition, length);
+		locString[length] = '\0';
+		m_ReadPosition += length;
+
+		if (length < static_cast<size_t>(size - 1) && IsEndOfFile()) { EndIncludeFile(); }
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	std::string Reader::ReadLine() {
-		DiscardEmptySpace();
+		return CachedRead<std::string>(PresetCache::Line, [this]() {
+			DiscardEmptySpace();
 
-		std::string retString;
-		char temp;
-		char peek = m_Stream->peek();
+			const char *lineStart = m_ReadPosition;
+			m_ReadPosition = FindLineEnd();
+			return std::string(lineStart, m_ReadPosition);
+		});
+	}
 
-		while (peek != '\n' && peek != '\r' && peek != '\t') {
-			temp = m_Stream->get();
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+	const char * Reader::FindLineEnd() const {
+		for (const char *lineEnd = m_ReadPosition; lineEnd < m_FileEnd; ++lineEnd) {
+			char character = *lineEnd;
 			// Check for line comment "//"
-			if (peek == '/' && m_Stream->peek() == '/') {
-				m_Stream->unget();
-				break;
+			if (character == '\n' || character == '\r' || character == '\t' || (character == '/' && lineEnd + 1 < m_FileEnd && lineEnd[1] == '/')) {
+				return lineEnd;
 			}
+		}
+		return m_FileEnd;
+	}
 
-			if (m_Stream->eof()) { break; }
-			if (!m_Stream->good()) { ReportError("Stream failed for some reason"); }
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-			retString.append(1, temp);
-			peek = m_Stream->peek();
+	std::string_view Reader::ReadWord() {
+		const char *wordStart = m_ReadPosition;
+		while (m_ReadPosition < m_FileEnd && !std::isspace(static_cast<unsigned char>(*m_ReadPosition))) {
+			++m_ReadPosition;
 		}
-		return retString;
+		return std::string_view(wordStart, m_ReadPosition - wordStart);
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	std::string Reader::ReadTo(char terminator, bool discardTerminator) {
-		std::string retString;
-		char temp;
-		char peek = m_Stream->peek();
-
-		while (peek != terminator) {
-			temp = m_Stream->get();
-
-			if (m_Stream->eof()) { break; }
-			if (!m_Stream->good()) { ReportError("Stream failed for some reason"); }
-
-			retString.append(1, temp);
-			peek = m_Stream->peek();
-		}
-		// Discard the terminator if instructed to
-		if (discardTerminator && peek == terminator) { m_Stream->get(); }
-		return retString;
+		return CachedRead<std::string>(PresetCache::ReadTo, [this, terminator, discardTerminator]() {
+			const char *terminatorPosition = static_cast<const char *>(std::memchr(m_ReadPosition, terminator, m_FileEnd - m_ReadPosition));
+			if (!terminatorPosition) { terminatorPosition = m_FileEnd; }
+
+			std::string retString(m_ReadPosition, terminatorPosition);
+			// The file isn't read through a text mode stream anymore, so drop carriage returns the way it used to on Windows
+			retString.erase(std::remove(retString.begin(), retString.end(), '\r'), retString.end());
+
+			m_ReadPosition = terminatorPosition;
+			// Discard the terminator if instructed to
+			if (discardTerminator && m_ReadPosition < m_FileEnd) { ++m_ReadPosition; }
+			return retString;
+		});
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	bool Reader::NextProperty() {
-		if (!DiscardEmptySpace() || m_EndOfStreams) {
-			return false;
-		}
-		// If there are fewer tabs on the last line eaten this time,
-		// that means there are no more properties to read on this object
-		if (m_ObjectEndings < -m_IndentDifference) {
-			m_ObjectEndings++;
-			return false;
-		}
-		m_ObjectEndings = 0;
-		return true;
+		return CachedRead<bool>(PresetCache::NextProperty, [this]() {
+			if (!DiscardEmptySpace() || m_EndOfStreams) {
+				return false;
+			}
+			// If there are fewer tabs on the last line eaten this time,
+			// that means there are no more properties to read on this object
+			if (m_ObjectEndings < -m_IndentDifference) {
+				m_ObjectEndings++;
+				return false;
+			}
+			m_ObjectEndings = 0;
+			return true;
+		});
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	std::string Reader::ReadPropName() {
-		DiscardEmptySpace();
+		return CachedRead<std::string>(PresetCache::PropName, [this]() { return ReadUncachedPropName(); });
+	}
 
-		std::string retString;
-		char temp;
-		char peek;
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		while (true) {
-			peek = m_Stream->peek();
-			if (peek == '=') {
-				m_Stream->ignore(1);
-				break;
-			}
-			if (peek == '\n' || peek == '\r' || peek == '\t') {
-				ReportError("Property name wasn't followed by a value");
-			}
-			temp = m_Stream->get();
-			if (m_Stream->eof()) {
-				EndIncludeFile();
-				break;
-			}
-			if (!m_Stream->good()) { ReportError("Stream failed for some reason"); }
-			retString.append(1, temp);
+	std::string Reader::ReadUncachedPropName() {
+		DiscardEmptySpace();
+
+		const char *nameEnd = m_ReadPosition;
+		while (nameEnd < m_FileEnd && *nameEnd != '=') {
+			if (*nameEnd == '\n' || *nameEnd == '\r' || *nameEnd == '\t') { ReportError("Property name wasn't followed by a value"); }
+			++nameEnd;
+		}
+		// Trim the name of whitespace
+		std::string retString(TrimSpaces(std::string_view(m_ReadPosition, nameEnd - m_ReadPosition)));
+
+		if (nameEnd < m_FileEnd) {
+			m_ReadPosition = nameEnd + 1;
+		} else {
+			m_ReadPosition = nameEnd;
+			EndIncludeFile();
 		}
-		// Trim the string of whitespace
-		retString = TrimString(retString);
-		
+
 		// If the property name turns out to be the special IncludeFile,and we're not skipping include files then open that file and read the first property from it instead.
 		if (retString == "IncludeFile") {
 			if (m_SkipIncludes) {
 				// Discard IncludeFile value
 				std::string val = ReadPropValue();
 				DiscardEmptySpace();
-				retString = ReadPropName();
+				retString = ReadUncachedPropName();
 			} else {
 				StartIncludeFile();
 				// Return the first property name in the new file, this is to make the file inclusion seamless.
 				// Alternatively, if StartIncludeFile failed, this will just grab the next prop name and ignore the failed IncludeFile property.
-				retString = ReadPropName();
+				retString = ReadUncachedPropName();
 			}
 		}
 		return retString;
@@ -221,37 +252,49 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	std::string Reader::ReadPropValue() {
-		std::string fullLine = ReadLine();
-		int begin = fullLine.find_first_of('=');
-		std::string subStr = (begin == std::string::npos) ? fullLine : fullLine.substr(begin + 1);
-		return TrimString(subStr);
+		return CachedRead<std::string>(PresetCache::PropValue, [this]() {
+			DiscardEmptySpace();
+
+			std::string_view fullLine(m_ReadPosition, FindLineEnd() - m_ReadPosition);
+			m_ReadPosition += fullLine.size();
+			size_t begin = fullLine.find_first_of('=');
+			return std::string(TrimSpaces((begin == std::string_view::npos) ? fullLine : fullLine.substr(begin + 1)));
+		});
 	}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	bool Reader::DiscardEmptySpace() {
-		char peek;
+		bool moreToRead = CachedRead<bool>(PresetCache::DiscardEmptySpace, [this]() { return DiscardUncachedEmptySpace(); });
+		// A replaying Reader never gets to the end of its file, so this is where it finds out it's done with it
+		if (!moreToRead) {
+			LoadProfiler::EndSection(m_ProfilerSection);
+			m_ProfilerSection = -1;
+		}
+		return moreToRead;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool Reader::DiscardUncachedEmptySpace() {
 		unsigned short indent = 0;
 		bool discardedLine = false;
 		char report[512];
 
 		while (true) {
-			peek = m_Stream->peek();
-
 			// If we have hit the end and don't have any files to resume, then quit and indicate that
-			if (m_Stream->eof()) {
+			if (m_ReadPosition >= m_FileEnd) {
 				return EndIncludeFile();
 			}
-			// Not end-of-file but still got junk back... something went to shit
-			if (peek == -1) { ReportError("Something went wrong reading the line; make sure it is providing the expected type"); }
+			char peek = *m_ReadPosition;
 
 			// Discard spaces
 			if (peek == ' ') {
-				m_Stream->ignore(1);
+				++m_ReadPosition;
 			// Discard tabs, and count them
 			} else if (peek == '\t') {
 				indent++;
-				m_Stream->ignore(1);
+				++m_ReadPosition;
 			// Discard newlines and reset the tab count for the new line, also count the lines
 			} else if (peek == '\n' || peek == '\r') {
 				// So we don't count lines twice when there are both newline and carriage return at the end of lines
@@ -265,32 +308,24 @@ namespace RTE {
 				}
 				indent = 0;
 				discardedLine = true;
-				m_Stream->ignore(1);
+				++m_ReadPosition;
 
 			// Comment line?
-			} else if (m_Stream->peek() == '/') {
-				char temp = m_Stream->get();
-				char temp2;
-
-				// Confirm that it's a comment line, if so discard it and continue
-				if (m_Stream->peek() == '/') {
-					while (m_Stream->peek() != '\n' && m_Stream->peek() != '\r' && !m_Stream->eof()) { m_Stream->ignore(1); }
-				// Block comment
-				} else if (m_Stream->peek() == '*') {
-					// Find the matching "*/"
-					while (!((temp2 = m_Stream->get()) == '*' && m_Stream->peek() == '/') && !m_Stream->eof()) {
-						// Count the lines within the comment though
-						if (temp2 == '\n') { ++m_CurrentLine; }
-					}
-					// Discard that final '/'
-					if (!m_Stream->eof()) { m_Stream->ignore(1); }
-
-				// Not a comment, so it's data, so quit.
+			} else if (peek == '/' && m_ReadPosition + 1 < m_FileEnd && (m_ReadPosition[1] == '/' || m_ReadPosition[1] == '*')) {
+				// Line comment, discard up to the end of the line
+				if (m_ReadPosition[1] == '/') {
+					while (m_ReadPosition < m_FileEnd && *m_ReadPosition != '\n' && *m_ReadPosition != '\r') { ++m_ReadPosition; }
+				// Block comment, find the matching "*/" and discard up to and including it
 				} else {
-					m_Stream->putback(temp);
-					break;
+					std::string_view blockComment(m_ReadPosition + 2, m_FileEnd - m_ReadPosition - 2);
+					size_t blockCommentEnd = blockComment.find("*/");
+					const char *resumePosition = (blockCommentEnd == std::string_view::npos) ? m_FileEnd : blockComment.data() + blockCommentEnd + 2;
+					// Count the lines within the comment though
+					m_CurrentLine += static_cast<unsigned int>(std::count(m_ReadPosition, resumePosition, '\n'));
+					m_ReadPosition = resumePosition;
 				}
-			} else { 
+			// Not a comment, so it's data, so quit.
+			} else {
 				break;
 			}
 		}
@@ -308,17 +343,17 @@ namespace RTE {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 	std::string Reader::TrimString(std::string &stringToTrim) {
-		if (stringToTrim.empty()) {
-			return "";
-		}
-		int start = stringToTrim.find_first_not_of(' ');
-		int end = stringToTrim.find_last_not_of(' ');
+		return std::string(TrimSpaces(stringToTrim));
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		if (start > end) {
-			return "";
-		} else if (start == 0 && end == stringToTrim.size() - 1) {
-			return stringToTrim;
+	std::string_view Reader::TrimSpaces(std::string_view stringToTrim) {
+		size_t start = stringToTrim.find_first_not_of(' ');
+		if (start == std::string_view::npos) {
+			return std::string_view();
 		}
+		size_t end = stringToTrim.find_last_not_of(' ');
 		return stringToTrim.substr(start, (end - start) + 1);
 	}
 
@@ -339,19 +374,21 @@ namespace RTE {
 			std::snprintf(report, sizeof(report), "%s%s on line %i includes:", m_ReportTabs.c_str(), m_FileName.c_str(), m_CurrentLine);
 			m_ReportProgress(std::string(report), false);
 		}
-		// Push the current stream onto the StreamStack for future retrieval when the new include file has run out of data.
-		m_StreamStack.push_back(StreamInfo(m_Stream, m_FilePath, m_CurrentLine, m_PreviousIndent));
-
-		// Get the file path from the stream
-		m_FilePath = ReadPropValue();
-		m_Stream = new std::ifstream(m_FilePath.c_str());
-		if (m_Stream->fail()) {
-			// Backpedal and set up to read the next property in the old stream
-			delete m_Stream;
-			m_Stream = m_StreamStack.back().Stream;
+		// Get the file path from the current file, and only then push it onto the StreamStack so reading resumes after the path when the new include file has run out of data.
+		std::string includeFilePath = ReadPropValue();
+		m_StreamStack.push_back(StreamInfo(m_File, m_ReadPosition, m_FilePath, m_CurrentLine, m_PreviousIndent, m_ProfilerSection));
+
+		m_FilePath = includeFilePath;
+		m_File = new MappedFile(m_FilePath);
+		if (!m_File->IsOpen()) {
+			// Backpedal and set up to read the next property in the old file
+			delete m_File;
+			m_File = m_StreamStack.back().File;
+			m_ReadPosition = m_StreamStack.back().ReadPosition;
 			m_FilePath = m_StreamStack.back().FilePath;
 			m_CurrentLine = m_StreamStack.back().CurrentLine;
 			m_PreviousIndent = m_StreamStack.back().PreviousIndent;
+			m_ProfilerSection = m_StreamStack.back().ProfilerSection;
 			m_StreamStack.pop_back();
 
 			ReportError("Failed to open included data file");
@@ -360,6 +397,13 @@ namespace RTE {
 			return false;
 		}
 
+		if (m_PresetCache && m_PresetCache->IsRecording()) { m_PresetCache->AddContributingFile(m_FilePath); }
+
+		m_ReadPosition = m_File->GetData();
+		m_FileEnd = m_ReadPosition + m_File->GetSize();
+		m_ProfilerSection = LoadProfiler::BeginSection(LoadProfiler::DataFileSection, m_FilePath);
+		LoadProfiler::AddBytesRead(m_File->GetSize());
+
 		// Line counting starts with 1, not 0
 		m_CurrentLine = 1;
 		// This is set to 0, because locally in the included file, all properties start at that count
@@ -395,17 +439,22 @@ namespace RTE {
 			std::snprintf(report, sizeof(report), "%s%s - done! %c", m_ReportTabs.c_str(), m_FileName.c_str(), -42);
 			m_ReportProgress(std::string(report), false);
 		}
+		LoadProfiler::EndSection(m_ProfilerSection);
+		m_ProfilerSection = -1;
 		if (m_StreamStack.empty()) {
 			m_EndOfStreams = true;
 			return false;
 		}
-		// Replace the current included stream with the parent one
-		delete m_Stream;
-		m_Stream = m_StreamStack.back().Stream;
+		// Replace the current included file with the parent one
+		delete m_File;
+		m_File = m_StreamStack.back().File;
+		m_ReadPosition = m_StreamStack.back().ReadPosition;
+		m_FileEnd = m_File->GetData() + m_File->GetSize();
 		m_FilePath = m_StreamStack.back().FilePath;
 		m_CurrentLine = m_StreamStack.back().CurrentLine;
 		// Observe it's being added, not just replaced. This is to keep proper track when exiting out of a file
 		m_PreviousIndent += m_StreamStack.back().PreviousIndent;
+		m_ProfilerSection = m_StreamStack.back().ProfilerSection;
 		m_StreamStack.pop_back();
 
 		// Extract just the filename
@@ -428,4 +477,33 @@ namespace RTE {
 		DiscardEmptySpace();
 		return true;
 	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void Reader::ReplayPosition() {
+		std::string filePath = m_FilePath;
+		unsigned int line = m_CurrentLine;
+		if (!m_PresetCache->ReplayPosition(filePath, line)) {
+			return;
+		}
+		bool fileChanged = filePath != m_FilePath;
+		bool reportLine = m_ReportProgress && line != m_CurrentLine && (line % g_SettingsMan.LoadingScreenReportPrecision() == 0);
+		m_CurrentLine = line;
+
+		if (fileChanged) {
+			m_FilePath = filePath;
+			int firstSlashPos = m_FilePath.find_first_of('/');
+			if (firstSlashPos == std::string::npos) { firstSlashPos = m_FilePath.find_first_of('\\'); }
+			m_FileName = m_FilePath.substr(firstSlashPos + 1);
+		}
+		if (m_ReportProgress && (fileChanged || reportLine)) {
+			char report[512];
+			if (fileChanged) {
+				std::snprintf(report, sizeof(report), "%s%s on line %i", m_ReportTabs.c_str(), m_FileName.c_str(), m_CurrentLine);
+			} else {
+				std::snprintf(report, sizeof(report), "%s%s reading line %i", m_ReportTabs.c_str(), m_FileName.c_str(), m_CurrentLine);
+			}
+			m_ReportProgress(std::string(report), fileChanged);
+		}
+	}
 }
\ No newline at end of file
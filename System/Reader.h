@@ -1,12 +1,15 @@
 #ifndef _RTEREADER_
 #define _RTEREADER_
 
+#include "MappedFile.h"
+#include "PresetCache.h"
+
 namespace RTE {
 
 	typedef std::function<void(std::string, bool)> ProgressCallback; //!< Convenient name definition for the progress report callback function.
 
 	/// <summary>
-	/// Reads RTE objects from std::istreams.
+	/// Reads RTE objects from files, which are mapped into memory and read in place.
 	/// </summary>
 	class Reader {
 
@@ -37,8 +40,9 @@ namespace RTE {
 		/// <param name="overwrites"> Whether object definitions read here overwrite existing ones with the same names.</param>
 		/// <param name="fpProgressCallback">A function pointer to a function that will be called and sent a string with information about the progress of this Reader's reading.</param>
 		/// <param name="failOK">Whether it's ok for the file to not be there, ie we're only trying to open, and if it's not there, then fail silently.</param>
+		/// <param name="presetCache">A PresetCache to record everything read from the file to, or to replay it from instead of reading the file if it's replaying. Ownership is NOT transferred!</param>
 		/// <returns>An error return value signaling success or any particular failure.  Anything below 0 is an error signal.</returns>
-		int Create(const char *fileName, bool overwrites = false, ProgressCallback fpProgressCallback = 0, bool failOK = false);
+		int Create(const char *fileName, bool overwrites = false, ProgressCallback fpProgressCallback = 0, bool failOK = false, PresetCache *presetCache = nullptr);
 #pragma endregion
 
 #pragma region Destruction
@@ -67,10 +71,10 @@ namespace RTE {
 		int GetReadModuleID() const;
 
 		/// <summary>
-		/// Gets a pointer to the istream of this reader.
+		/// Gets whether everything in the file currently being read has been read.
 		/// </summary>
-		/// <returns>A pointer to the istream object for this reader.</returns>
-		std::istream * GetStream() const { return m_Stream; }
+		/// <returns>Whether the end of the current file was reached.</returns>
+		bool IsEndOfFile() const { return m_ReadPosition >= m_FileEnd; }
 
 		/// <summary>
 		/// Gets the path of the current file this reader is reading from.
@@ -176,7 +180,7 @@ namespace RTE {
 		/// Shows whether this is still OK to read from. If file isn't present, etc, this will return false.
 		/// </summary>
 		/// <returns>Whether this Reader's stream is OK or not.</returns>
-		bool IsOK() const { return m_Stream && m_Stream->good(); }
+		bool IsOK() const { return (m_File && m_File->IsOpen() && !m_EndOfStreams) || (m_PresetCache && m_PresetCache->IsReplaying()); }
 
 		/// <summary>
 		/// Makes an error message box pop up for the user that tells them something went wrong with the reading, and where.
@@ -191,18 +195,18 @@ namespace RTE {
 		/// </summary>
 		/// <param name="var">A reference to the variable that will be filled by the extracted data.</param>
 		/// <returns>A Reader reference for further use in an expression.</returns>
-		Reader & operator>>(bool &var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
-		Reader & operator>>(char &var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
-		Reader & operator>>(unsigned char &var) { DiscardEmptySpace(); int temp; *m_Stream >> temp; var = temp; return *this; }
-		Reader & operator>>(short &var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
-		Reader & operator>>(unsigned short &var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
-		Reader & operator>>(int &var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
-		Reader & operator>>(unsigned int &var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
-		Reader & operator>>(long &var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
-		Reader & operator>>(unsigned long &var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
-		Reader & operator>>(float &var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
-		Reader & operator>>(double &var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
-		Reader & operator>>(char * var) { DiscardEmptySpace(); *m_Stream >> var; return *this; }
+		Reader & operator>>(bool &var) { return ReadValue(PresetCache::Bool, var); }
+		Reader & operator>>(char &var) { var = CachedRead<char>(PresetCache::Char, [this, &var]() { DiscardEmptySpace(); return IsEndOfFile() ? var : *m_ReadPosition++; }); return *this; }
+		Reader & operator>>(unsigned char &var) { var = CachedRead<unsigned char>(PresetCache::UnsignedChar, [this]() { DiscardEmptySpace(); int temp; ParseNumber(temp); return static_cast<unsigned char>(temp); }); return *this; }
+		Reader & operator>>(short &var) { return ReadValue(PresetCache::Short, var); }
+		Reader & operator>>(unsigned short &var) { return ReadValue(PresetCache::UnsignedShort, var); }
+		Reader & operator>>(int &var) { return ReadValue(PresetCache::Int, var); }
+		Reader & operator>>(unsigned int &var) { return ReadValue(PresetCache::UnsignedInt, var); }
+		Reader & operator>>(long &var) { return ReadValue(PresetCache::Long, var); }
+		Reader & operator>>(unsigned long &var) { return ReadValue(PresetCache::UnsignedLong, var); }
+		Reader & operator>>(float &var) { return ReadValue(PresetCache::Float, var); }
+		Reader & operator>>(double &var) { return ReadValue(PresetCache::Double, var); }
+		Reader & operator>>(char * var) { std::strcpy(var, CachedRead<std::string>(PresetCache::CString, [this]() { DiscardEmptySpace(); return std::string(ReadWord()); }).c_str()); return *this; }
 		Reader & operator>>(std::string &var) { var.assign(ReadLine()); return *this; }
 #pragma endregion
 
@@ -217,22 +221,26 @@ namespace RTE {
 	protected:
 
 		/// <summary>
-		/// A struct containing information from the currently used stream.
+		/// A struct containing information from the currently used file.
 		/// </summary>
 		struct StreamInfo {
-			StreamInfo(std::ifstream *stream, std::string filePath, int currentLine, int prevIndent) : Stream(stream), FilePath(filePath), CurrentLine(currentLine), PreviousIndent(prevIndent) {}
+			StreamInfo(MappedFile *file, const char *readPosition, std::string filePath, int currentLine, int prevIndent, int profilerSection) : File(file), ReadPosition(readPosition), FilePath(filePath), CurrentLine(currentLine), PreviousIndent(prevIndent), ProfilerSection(profilerSection) {}
 
 			// NOTE: These members are owned by the reader that owns this struct, so are not deleted when this is destroyed.
-			std::ifstream *Stream; //!< Currently used stream, is not on the StreamStack until a new stream is opened.
-			std::string FilePath; //!< Currently used stream's filepath.
-			unsigned int CurrentLine; //!< The line number the stream is on.
+			MappedFile *File; //!< Currently used file, is not on the StreamStack until a new file is opened.
+			const char *ReadPosition; //!< The position in the file to resume reading from.
+			std::string FilePath; //!< Currently used file's filepath.
+			unsigned int CurrentLine; //!< The line number the file is on.
 			unsigned short PreviousIndent; //!< Count of tabs encountered on the last line DiscardEmptySpace() discarded.
+			int ProfilerSection; //!< The LoadProfiler section timing the file, or -1 if it isn't being profiled.
 		};
 
 		static const std::string c_ClassName; //!< A string with the friendly-formatted type name of this.
 
-		std::ifstream *m_Stream; //!< Currently used stream, is not on the StreamStack until a new stream is opened.
-		std::list<StreamInfo> m_StreamStack; //!< Stack of stream and filepath pairs, each one representing a file opened to read from within another.
+		MappedFile *m_File; //!< Currently used file, is not on the StreamStack until a new file is opened.
+		const char *m_ReadPosition; //!< The position in the current file that will be read from next.
+		const char *m_FileEnd; //!< The position just past the end of the current file.
+		std::vector<StreamInfo> m_StreamStack; //!< Stack of files and their filepaths, each one representing a file opened to read from within another.
 		bool m_EndOfStreams; //!< All streams have been depleted.
 
 		ProgressCallback m_ReportProgress; //!< Function pointer to report our reading progress to, by calling it and passing a descriptive string to it.
@@ -251,6 +259,10 @@ namespace RTE {
 		bool m_OverwriteExisting; //!< Whether object instances read from this should overwrite any already existing ones with the same names.
 		bool m_SkipIncludes; //!< Indicates whether reader should skip included files
 
+		PresetCache *m_PresetCache; //!< The PresetCache this records everything it reads to, or replays it from instead of reading the file. Not owned.
+		int m_NestedReads; //!< How many reading operations are running inside the one called from outside, which are part of its result and so aren't recorded separately.
+		int m_ProfilerSection; //!< The LoadProfiler section timing the currently read file, or -1 if it isn't being profiled.
+
 		/// <summary>
 		/// When NextProperty() has returned false, indicating that there were no more properties to read on that object,
 		/// this is incremented until it matches -m_IndentDifference, and then NextProperty will start returning true again.
@@ -262,17 +274,142 @@ namespace RTE {
 #pragma region Reading Operations
 		/// <summary>
 		/// When ReadPropName encounters the property name "IncludeFile", it will automatically call this function to get started reading on that file.
-		/// This will create a new stream to the include file.
+		/// This will map the include file and start reading from it.
 		/// </summary>
 		/// <returns>Whether the include file was found and opened ok or not.</returns>
 		bool StartIncludeFile();
 
 		/// <summary>
-		/// This should be called when end-of-file is detected in an included file stream.
-		/// It will destroy the current stream pop the top stream off the stream stack to resume reading from it instead.
+		/// This should be called when end-of-file is detected in an included file.
+		/// It will destroy the current file and pop the top file off the stream stack to resume reading from it instead.
 		/// </summary>
-		/// <returns>Whether there were any stream on the stack to resume.</returns>
+		/// <returns>Whether there were any files on the stack to resume.</returns>
 		bool EndIncludeFile();
+
+		/// <summary>
+		/// Finds where the line being read ends, which is at the first newline, tab or line comment, or at the end of the file.
+		/// </summary>
+		/// <returns>The position just past the last character of the line.</returns>
+		const char * FindLineEnd() const;
+
+		/// <summary>
+		/// Reads up to the next whitespace, the same way extracting a C-string from a stream would.
+		/// </summary>
+		/// <returns>A view of what was read, which stays valid until the current file is closed.</returns>
+		std::string_view ReadWord();
+
+		/// <summary>
+		/// Parses a number at the current position and moves past it, the same way extracting it from a stream would. Reports an error if there is no valid number there.
+		/// </summary>
+		/// <param name="value">A reference to the variable that will be filled by the parsed number.</param>
+		template <typename Type> void ParseNumber(Type &value) {
+			// std::from_chars doesn't accept the leading plus sign stream extraction does
+			const char *numberStart = (m_ReadPosition < m_FileEnd && *m_ReadPosition == '+') ? m_ReadPosition + 1 : m_ReadPosition;
+			std::from_chars_result result;
+			if constexpr (std::is_same_v<Type, bool>) {
+				int boolValue = 0;
+				result = std::from_chars(numberStart, m_FileEnd, boolValue);
+				if (result.ec == std::errc() && boolValue != 0 && boolValue != 1) { result.ec = std::errc::invalid_argument; }
+				value = boolValue != 0;
+			} else if constexpr (std::is_unsigned_v<Type>) {
+				// Stream extraction wraps negative numbers around for unsigned types instead of failing, and some data relies on that
+				if (numberStart < m_FileEnd && *numberStart == '-') {
+					long long signedValue = 0;
+					result = std::from_chars(numberStart, m_FileEnd, signedValue);
+					value = static_cast<Type>(signedValue);
+				} else {
+					result = std::from_chars(numberStart, m_FileEnd, value);
+				}
+			} else if constexpr (std::is_floating_point_v<Type>) {
+				// Floating point std::from_chars needs newer compilers than we support, so parse a null-terminated copy of the number with strtod instead
+				char numberBuffer[128];
+				size_t numberLength = 0;
+				while (numberStart + numberLength < m_FileEnd && numberLength < sizeof(numberBuffer) - 1 && (std::isdigit(static_cast<unsigned char>(numberStart[numberLength])) || (numberStart[numberLength] != '\0' && std::strchr("+-.eE", numberStart[numberLength])))) {
+					numberBuffer[numberLength] = numberStart[numberLength];
+					numberLength++;
+				}
+				numberBuffer[numberLength] = '\0';
+
+				char *numberEnd = nullptr;
+				errno = 0;
+				value = std::is_same_v<Type, float> ? std::strtof(numberBuffer, &numberEnd) : static_cast<Type>(std::strtod(numberBuffer, &numberEnd));
+				result.ptr = numberStart + (numberEnd - numberBuffer);
+				result.ec = (numberEnd == numberBuffer || (errno == ERANGE && std::isinf(value))) ? std::errc::invalid_argument : std::errc();
+			} else {
+				result = std::from_chars(numberStart, m_FileEnd, value);
+			}
+			if (result.ec != std::errc()) { ReportError("Something went wrong reading the line; make sure it is providing the expected type"); }
+			m_ReadPosition = result.ptr;
+		}
+
+		/// <summary>
+		/// Takes out spaces from the beginning and the end of a string without copying it.
+		/// </summary>
+		/// <param name="stringToTrim">String to remove spaces from.</param>
+		/// <returns>A view of the string that was passed in, sans spaces in the front and end.</returns>
+		static std::string_view TrimSpaces(std::string_view stringToTrim);
+#pragma endregion
+
+#pragma region Preset Cache Handling
+		/// <summary>
+		/// Runs a reading operation and records its result to the PresetCache, or replays its result from the PresetCache instead of running it.
+		/// Only operations called from outside are recorded, the ones they run themselves are part of their result.
+		/// </summary>
+		/// <param name="entryType">The reading operation, to check against the recording when replaying.</param>
+		/// <param name="readOperation">The reading operation to run when not replaying.</param>
+		/// <returns>The result of the reading operation.</returns>
+		template <typename Type, typename ReadOperation> Type CachedRead(PresetCache::EntryType entryType, ReadOperation readOperation) {
+			if (!m_PresetCache || m_NestedReads > 0) {
+				return readOperation();
+			}
+			Type value;
+			if (m_PresetCache->IsReplaying()) {
+				m_PresetCache->Replay(entryType, value);
+				ReplayPosition();
+				return value;
+			}
+			m_NestedReads++;
+			value = readOperation();
+			m_NestedReads--;
+			m_PresetCache->Record(entryType, value);
+			m_PresetCache->RecordPosition(m_FilePath, m_CurrentLine);
+			return value;
+		}
+
+		/// <summary>
+		/// Parses a value of an elemental type from the file, or replays it from the PresetCache.
+		/// </summary>
+		/// <param name="entryType">The reading operation, to check against the recording when replaying.</param>
+		/// <param name="var">A reference to the variable that will be filled by the extracted data.</param>
+		/// <returns>A Reader reference for further use in an expression.</returns>
+		template <typename Type> Reader & ReadValue(PresetCache::EntryType entryType, Type &var) {
+			var = CachedRead<Type>(entryType, [this, &var]() { Type value = var; DiscardEmptySpace(); ParseNumber(value); return value; });
+			return *this;
+		}
+
+		/// <summary>
+		/// Reads the rest of the line from the file into a C-string buffer, without going through the PresetCache.
+		/// </summary>
+		/// <param name="locString">The c-string that will be filled out with the line.</param>
+		/// <param name="size">An int specifying the max size of the c-string.</param>
+		void ReadUncachedLine(char *locString, int size);
+
+		/// <summary>
+		/// Reads the next property name from the file, opening any included files on the way, without going through the PresetCache.
+		/// </summary>
+		/// <returns>A string with the name of the next property in the file.</returns>
+		std::string ReadUncachedPropName();
+
+		/// <summary>
+		/// Discards all whitespace, newlines and comment lines from the file, without going through the PresetCache.
+		/// </summary>
+		/// <returns>Whether there is more data to read from the file streams.</returns>
+		bool DiscardUncachedEmptySpace();
+
+		/// <summary>
+		/// Moves this to the file and line the PresetCache recorded it at after the last replayed reading operation, reporting progress the same way reading the files would.
+		/// </summary>
+		void ReplayPosition();
 #pragma endregion
 
 		/// <summary>
@@ -88,6 +88,52 @@ namespace RTE {
 			return -1;
 		}
 
+		/// <summary>
+		/// A function reading a property of an object of a specific Serializable class from a Reader lined up to the property's value.
+		/// </summary>
+		template <typename Type> using PropertyReader = void (*)(Type &object, Reader &reader);
+
+		/// <summary>
+		/// Maps the names of the properties a Serializable class reads to the functions reading them, so ReadProperty finds the one to use with a single hash lookup instead of comparing the name to every property of the class in turn.
+		/// Each class keeps one as a static in its ReadProperty and calls the ReadProperty of its parent class with any property it doesn't have a function for.
+		/// </summary>
+		template <typename Type> class PropertyReaderMap {
+
+		public:
+
+			/// <summary>
+			/// Constructor method used to instantiate a PropertyReaderMap object in system memory and fill it.
+			/// </summary>
+			/// <param name="propertyReaders">The names of each property, and the function reading them. Properties with several names list them all.</param>
+			PropertyReaderMap(std::initializer_list<std::pair<std::initializer_list<const char *>, PropertyReader<Type>>> propertyReaders) {
+				for (const std::pair<std::initializer_list<const char *>, PropertyReader<Type>> &propertyReader : propertyReaders) {
+					for (const char *propName : propertyReader.first) {
+						m_PropertyReaders.try_emplace(propName, propertyReader.second);
+					}
+				}
+			}
+
+			/// <summary>
+			/// Reads a property into an object with the function mapped to its name, if there is one.
+			/// </summary>
+			/// <param name="object">The object to read the property into.</param>
+			/// <param name="propName">The name of the property to be read.</param>
+			/// <param name="reader">A Reader lined up to the value of the property to be read.</param>
+			/// <returns>Whether there was a function for the property and it was read. If not, the Reader's position is untouched.</returns>
+			bool Read(Type &object, const std::string &propName, Reader &reader) const {
+				typename std::unordered_map<std::string, PropertyReader<Type>>::const_iterator propertyReader = m_PropertyReaders.find(propName);
+				if (propertyReader == m_PropertyReaders.end()) {
+					return false;
+				}
+				propertyReader->second(object, reader);
+				return true;
+			}
+
+		private:
+
+			std::unordered_map<std::string, PropertyReader<Type>> m_PropertyReaders; //!< The function reading each property, by the property's name.
+		};
+
 		/// <summary>
 		/// Saves the complete state of this Serializable to an output stream for later recreation with Create(istream &stream).
 		/// </summary>
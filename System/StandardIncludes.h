@@ -13,6 +13,8 @@
 #include <mutex>
 #include <cctype>
 #include <string>
+#include <string_view>
+#include <charconv>
 #include <cstring>
 #include <vector>
 #include <list>
@@ -18,6 +18,20 @@ namespace RTE {
 		System() { m_LogToCLI = false; }
 #pragma endregion
 
+#pragma region Getters and Setters
+		/// <summary>
+		/// Gets the path of the running executable.
+		/// </summary>
+		/// <returns>The path of the running executable, as it was started with. Empty if it wasn't set.</returns>
+		const std::string & GetExecutablePath() const { return m_ExecutablePath; }
+
+		/// <summary>
+		/// Sets the path of the running executable.
+		/// </summary>
+		/// <param name="executablePath">The path of the running executable, as it was started with.</param>
+		void SetExecutablePath(const std::string &executablePath) { m_ExecutablePath = executablePath; }
+#pragma endregion
+
 #pragma region Directories
 		/// <summary>
 		/// Returns current working directory.
@@ -61,6 +75,7 @@ namespace RTE {
 	protected:
 
 		bool m_LogToCLI; //!< Bool to tell whether to print the loading log and anything specified with PrintToCLI to command-line or not.
+		std::string m_ExecutablePath; //!< The path of the running executable, as it was started with.
 	};
 
 	extern System g_System;
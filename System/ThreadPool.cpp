@@ -0,0 +1,106 @@
+#include "ThreadPool.h"
+
+namespace RTE {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ThreadPool::Clear() {
+		m_Threads.clear();
+		m_Jobs = std::queue<std::function<void()>>();
+		m_Stopping = false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	int ThreadPool::Create(unsigned int threadCount) {
+		if (threadCount == 0) { threadCount = std::max(std::thread::hardware_concurrency(), 2U) - 1; }
+
+		m_Threads.reserve(threadCount);
+		for (unsigned int i = 0; i < threadCount; i++) {
+			m_Threads.emplace_back(&ThreadPool::WorkerThreadFunction, this);
+		}
+		return 0;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ThreadPool::Destroy() {
+		m_JobMutex.lock();
+		m_Stopping = true;
+		m_JobMutex.unlock();
+		m_JobAvailable.notify_all();
+
+		for (std::thread &thread : m_Threads) {
+			if (thread.joinable()) { thread.join(); }
+		}
+		Clear();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	std::future<void> ThreadPool::AddJob(std::function<void()> job) {
+		// std::function needs a copyable target, so the move-only task is shared instead
+		std::shared_ptr<std::packaged_task<void()>> task = std::make_shared<std::packaged_task<void()>>(std::move(job));
+		std::future<void> jobFuture = task->get_future();
+
+		if (m_Threads.empty()) {
+			// Without workers there's no one else to run the job, so run it right away
+			(*task)();
+			return jobFuture;
+		}
+
+		m_JobMutex.lock();
+		m_Jobs.emplace([task]() { (*task)(); });
+		m_JobMutex.unlock();
+		m_JobAvailable.notify_one();
+
+		return jobFuture;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ThreadPool::WaitForJob(std::future<void> &jobFuture) {
+		while (jobFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+			if (!RunPendingJob()) { jobFuture.wait_for(std::chrono::microseconds(100)); }
+		}
+		jobFuture.get();
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	bool ThreadPool::RunPendingJob() {
+		std::function<void()> job;
+
+		m_JobMutex.lock();
+		if (!m_Jobs.empty()) {
+			job = std::move(m_Jobs.front());
+			m_Jobs.pop();
+		}
+		m_JobMutex.unlock();
+
+		if (job) {
+			job();
+			return true;
+		}
+		return false;
+	}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	void ThreadPool::WorkerThreadFunction() {
+		while (true) {
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> jobLock(m_JobMutex);
+				m_JobAvailable.wait(jobLock, [this]() { return m_Stopping || !m_Jobs.empty(); });
+
+				if (m_Jobs.empty()) {
+					return;
+				}
+				job = std::move(m_Jobs.front());
+				m_Jobs.pop();
+			}
+			job();
+		}
+	}
+}
@@ -0,0 +1,101 @@
+#ifndef _RTETHREADPOOL_
+#define _RTETHREADPOOL_
+
+#include <condition_variable>
+#include <future>
+
+namespace RTE {
+
+	/// <summary>
+	/// A fixed set of worker threads that run queued jobs, so work can be spread over the available cores without spawning a thread for every task.
+	/// </summary>
+	class ThreadPool {
+
+	public:
+
+#pragma region Creation
+		/// <summary>
+		/// Constructor method used to instantiate a ThreadPool object in system memory. Create() should be called before using the object.
+		/// </summary>
+		ThreadPool() { Clear(); }
+
+		/// <summary>
+		/// Constructor method used to instantiate a ThreadPool object in system memory and make it ready for use.
+		/// </summary>
+		/// <param name="threadCount">The number of worker threads to start. 0 means one less than the number of hardware threads, so the main thread keeps a core to itself.</param>
+		explicit ThreadPool(unsigned int threadCount) { Clear(); Create(threadCount); }
+
+		/// <summary>
+		/// Makes the ThreadPool object ready for use by starting its worker threads.
+		/// </summary>
+		/// <param name="threadCount">The number of worker threads to start. 0 means one less than the number of hardware threads, so the main thread keeps a core to itself.</param>
+		/// <returns>An error return value signaling success or any particular failure. Anything below 0 is an error signal.</returns>
+		int Create(unsigned int threadCount = 0);
+#pragma endregion
+
+#pragma region Destruction
+		/// <summary>
+		/// Destructor method used to clean up a ThreadPool object before deletion from system memory.
+		/// </summary>
+		~ThreadPool() { Destroy(); }
+
+		/// <summary>
+		/// Finishes all queued jobs, stops the worker threads and resets (through Clear()) the ThreadPool object.
+		/// </summary>
+		void Destroy();
+#pragma endregion
+
+#pragma region Getters
+		/// <summary>
+		/// Gets the number of worker threads of this ThreadPool.
+		/// </summary>
+		/// <returns>The number of worker threads.</returns>
+		unsigned int GetThreadCount() const { return static_cast<unsigned int>(m_Threads.size()); }
+#pragma endregion
+
+#pragma region Concrete Methods
+		/// <summary>
+		/// Queues a job to be run by one of the worker threads.
+		/// </summary>
+		/// <param name="job">The job to run.</param>
+		/// <returns>A future that becomes ready once the job has finished running. Exceptions thrown by the job are rethrown when getting it.</returns>
+		std::future<void> AddJob(std::function<void()> job);
+
+		/// <summary>
+		/// Waits for a job to finish, running other queued jobs on the calling thread in the meantime.
+		/// This has to be used instead of waiting on the future directly when waiting from inside a job, otherwise all workers could end up waiting for jobs none of them is free to run.
+		/// </summary>
+		/// <param name="jobFuture">The future of the job to wait for.</param>
+		void WaitForJob(std::future<void> &jobFuture);
+#pragma endregion
+
+	private:
+
+		std::vector<std::thread> m_Threads; //!< The worker threads.
+		std::queue<std::function<void()>> m_Jobs; //!< The jobs waiting to be run.
+		std::mutex m_JobMutex; //!< Mutex guarding the job queue.
+		std::condition_variable m_JobAvailable; //!< Signaled when a job is queued or the workers should stop.
+		bool m_Stopping; //!< Whether the worker threads should stop once the job queue is empty.
+
+		/// <summary>
+		/// The function each worker thread runs, taking jobs off the queue until told to stop.
+		/// </summary>
+		void WorkerThreadFunction();
+
+		/// <summary>
+		/// Takes a single job off the queue and runs it on the calling thread, if there is one.
+		/// </summary>
+		/// <returns>Whether a job was run.</returns>
+		bool RunPendingJob();
+
+		/// <summary>
+		/// Clears all the member variables of this ThreadPool, effectively resetting the members of this abstraction level only.
+		/// </summary>
+		void Clear();
+
+		// Disallow the use of some implicit methods.
+		ThreadPool(const ThreadPool &reference) = delete;
+		ThreadPool & operator=(const ThreadPool &rhs) = delete;
+	};
+}
+#endif